@@ -1,5 +1,5 @@
 /*
- * Copyright 2011-2022 Branimir Karadzic. All rights reserved.
+ * Copyright 2011-2023 Branimir Karadzic. All rights reserved.
  * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
  */
 
@@ -2011,6 +2011,27 @@ public static class bgfx
 		Count
 	}
 	
+	[AllowDuplicates]
+	public enum UploadPriority : uint32
+	{
+		/// <summary>
+		/// Issued after all other updates.
+		/// </summary>
+		Low,
+	
+		/// <summary>
+		/// Default priority.
+		/// </summary>
+		Normal,
+	
+		/// <summary>
+		/// Issued before all other updates.
+		/// </summary>
+		High,
+	
+		Count
+	}
+	
 	[AllowDuplicates]
 	public enum RenderFrame : uint32
 	{
@@ -2126,6 +2147,7 @@ public static class bgfx
 			public uint32 minResourceCbSize;
 			public uint32 transientVbSize;
 			public uint32 transientIbSize;
+			public uint32 uploadBudget;
 		}
 	
 		public RendererType type;
@@ -2137,6 +2159,9 @@ public static class bgfx
 		public PlatformData platformData;
 		public Resolution resolution;
 		public Limits limits;
+		public uint32 handoffSpin;
+		public uint64 renderThreadAffinity;
+		public int8_t renderThreadPriority;
 		public void* callback;
 		public void* allocator;
 	}
@@ -2220,6 +2245,13 @@ public static class bgfx
 		public uint16 num;
 	}
 	
+	[CRepr]
+	public struct SpecializationConstant
+	{
+		public uint32 id;
+		public uint32 value;
+	}
+	
 	[CRepr]
 	public struct ViewStats
 	{
@@ -2282,6 +2314,28 @@ public static class bgfx
 		public ViewStats* viewStats;
 		public uint8 numEncoders;
 		public EncoderStats* encoderStats;
+		public uint32 numUploadsPending;
+		public uint32 uploadQueueSize;
+		public uint32 numTransientFrameBuffers;
+		public uint32 numTransientFrameBufferAllocs;
+		public uint32 numRecycleHits;
+		public uint32 numRecycleMisses;
+		public uint32 numRecycled;
+		public uint32 numPipelinesCreated;
+		public uint32 numPipelinesPrecached;
+		public uint32 numGpuMemoryBlocks;
+		public uint32 numGpuMemoryAllocations;
+		public uint32 numGpuMemoryDedicated;
+		public int64 gpuMemoryAllocated;
+		public int64 gpuMemoryBound;
+		public uint32 numBarriers;
+		public uint32 numImageBarriers;
+		public int64 shaderCompileTime;
+		public uint32 numProgramsCompiling;
+		public uint32 numStateCallsIssued;
+		public uint32 numStateCallsElided;
+		public int64 handoffSubmit;
+		public int64 handoffRender;
 	}
 	
 	[CRepr]
@@ -2595,6 +2649,21 @@ public static class bgfx
 	[LinkName("bgfx_frame")]
 	public static extern uint32 frame(bool _capture);
 	
+	/// <summary>
+	/// Returns number of last frame which GPU finished executing. Frame
+	/// numbers are the ones returned by `bgfx::frame`. Per-frame data
+	/// owned outside the library, and referenced by that frame or any
+	/// frame before it, can be reused.
+	/// @remarks
+	///   Renderers that don't track GPU completion return an estimate,
+	///   last rendered frame number minus `BGFX_CONFIG_MAX_FRAME_LATENCY`.
+	///   Estimate is not guaranteed, since it assumes GPU never falls more
+	///   than maximum frame latency behind.
+	/// </summary>
+	///
+	[LinkName("bgfx_get_gpu_completed_frame")]
+	public static extern uint32 get_gpu_completed_frame();
+	
 	/// <summary>
 	/// Returns current renderer backend API type.
 	/// @remarks
@@ -2630,6 +2699,16 @@ public static class bgfx
 	[LinkName("bgfx_alloc")]
 	public static extern Memory* alloc(uint32 _size);
 	
+	/// <summary>
+	/// Allocate buffer to pass to bgfx calls. Data will be freed inside bgfx.
+	/// </summary>
+	///
+	/// <param name="_size">Size to allocate.</param>
+	/// <param name="_persistent">Memory is expected to be held for longer than a few frames before it's passed to bgfx. When false, small blocks are allocated from internal linear arena.</param>
+	///
+	[LinkName("bgfx_alloc_persistent")]
+	public static extern Memory* alloc_persistent(uint32 _size, bool _persistent);
+	
 	/// <summary>
 	/// Allocate buffer and copy data into it. Data will be freed inside bgfx.
 	/// </summary>
@@ -2640,6 +2719,17 @@ public static class bgfx
 	[LinkName("bgfx_copy")]
 	public static extern Memory* copy(void* _data, uint32 _size);
 	
+	/// <summary>
+	/// Allocate buffer and copy data into it. Data will be freed inside bgfx.
+	/// </summary>
+	///
+	/// <param name="_data">Pointer to data to be copied.</param>
+	/// <param name="_size">Size of data to be copied.</param>
+	/// <param name="_persistent">Memory is expected to be held for longer than a few frames before it's passed to bgfx. When false, small blocks are allocated from internal linear arena.</param>
+	///
+	[LinkName("bgfx_copy_persistent")]
+	public static extern Memory* copy_persistent(void* _data, uint32 _size, bool _persistent);
+	
 	/// <summary>
 	/// Make reference to data to pass to bgfx. Unlike `bgfx::alloc`, this call
 	/// doesn't allocate memory for data. It just copies the _data pointer. You
@@ -3055,6 +3145,42 @@ public static class bgfx
 	[LinkName("bgfx_create_compute_program")]
 	public static extern ProgramHandle create_compute_program(ShaderHandle _csh, bool _destroyShaders);
 	
+	/// <summary>
+	/// Create program with vertex and fragment shaders, and specialization
+	/// constant values.
+	/// @remarks
+	///   Constants are declared in shader with `SPECIALIZATION_CONSTANT(id,
+	///   type, name, default)` from `bgfx_shader.sh`. Only Vulkan renderer
+	///   specializes shaders, on other renderers macro declares regular
+	///   constant and values are ignored. Constant ids must be unique.
+	/// </summary>
+	///
+	/// <param name="_vsh">Vertex shader.</param>
+	/// <param name="_fsh">Fragment shader.</param>
+	/// <param name="_num">Number of specialization constants.</param>
+	/// <param name="_constants">Specialization constant values. Constants not listed keep default value declared in shader.</param>
+	/// <param name="_destroyShaders">If true, shaders will be destroyed when program is destroyed.</param>
+	///
+	[LinkName("bgfx_create_program_specialized")]
+	public static extern ProgramHandle create_program_specialized(ShaderHandle _vsh, ShaderHandle _fsh, uint8 _num, SpecializationConstant* _constants, bool _destroyShaders);
+	
+	/// <summary>
+	/// Create program with compute shader, and specialization constant values.
+	/// @remarks
+	///   Constants are declared in shader with `SPECIALIZATION_CONSTANT(id,
+	///   type, name, default)` from `bgfx_shader.sh`. Only Vulkan renderer
+	///   specializes shaders, on other renderers macro declares regular
+	///   constant and values are ignored. Constant ids must be unique.
+	/// </summary>
+	///
+	/// <param name="_csh">Compute shader.</param>
+	/// <param name="_num">Number of specialization constants.</param>
+	/// <param name="_constants">Specialization constant values. Constants not listed keep default value declared in shader.</param>
+	/// <param name="_destroyShaders">If true, shaders will be destroyed when program is destroyed.</param>
+	///
+	[LinkName("bgfx_create_compute_program_specialized")]
+	public static extern ProgramHandle create_compute_program_specialized(ShaderHandle _csh, uint8 _num, SpecializationConstant* _constants, bool _destroyShaders);
+	
 	/// <summary>
 	/// Destroy program.
 	/// </summary>
@@ -3064,6 +3190,27 @@ public static class bgfx
 	[LinkName("bgfx_destroy_program")]
 	public static extern void destroy_program(ProgramHandle _handle);
 	
+	/// <summary>
+	/// Compile pipeline state permutations for program ahead of first use, to
+	/// avoid hitches when draw call needs pipeline state that wasn't created yet.
+	/// Permutations are all combinations of passed states, vertex layouts and
+	/// frame buffers.
+	/// @remarks
+	///   Only Vulkan renderer compiles pipelines on worker threads, other
+	///   renderers ignore this call.
+	/// </summary>
+	///
+	/// <param name="_handle">Program handle.</param>
+	/// <param name="_numStates">Number of render states.</param>
+	/// <param name="_states">Render states. See: `BGFX_STATE_*`.</param>
+	/// <param name="_numLayouts">Number of vertex layouts. When 0, pipelines are compiled without vertex streams.</param>
+	/// <param name="_layouts">Vertex layouts.</param>
+	/// <param name="_numFrameBuffers">Number of frame buffers. When 0, pipelines are compiled for back buffer.</param>
+	/// <param name="_frameBuffers">Frame buffer handles. Invalid handle means back buffer.</param>
+	///
+	[LinkName("bgfx_precache_pipelines")]
+	public static extern void precache_pipelines(ProgramHandle _handle, uint16 _numStates, uint64_t* _states, uint16 _numLayouts, VertexLayout* _layouts, uint16 _numFrameBuffers, FrameBufferHandle* _frameBuffers);
+	
 	/// <summary>
 	/// Validate texture parameters.
 	/// </summary>
@@ -3241,6 +3388,52 @@ public static class bgfx
 	[LinkName("bgfx_read_texture")]
 	public static extern uint32 read_texture(TextureHandle _handle, void* _data, uint8 _mip);
 	
+	/// <summary>
+	/// Set upload priority of texture updates.
+	/// @remarks
+	///   Priority is used only when `Init::Limits::uploadBudget` is not 0. Updates
+	///   already waiting in upload queue are moved to new priority.
+	/// </summary>
+	///
+	/// <param name="_handle">Texture handle.</param>
+	/// <param name="_priority">Upload priority. See: `UploadPriority::Enum`.</param>
+	///
+	[LinkName("bgfx_set_upload_priority")]
+	public static extern void set_upload_priority(TextureHandle _handle, UploadPriority _priority);
+	
+	/// <summary>
+	/// Returns frame number when all texture updates issued so far will be
+	/// executed by renderer.
+	/// </summary>
+	///
+	/// <param name="_handle">Texture handle.</param>
+	///
+	[LinkName("bgfx_get_upload_frame")]
+	public static extern uint32 get_upload_frame(TextureHandle _handle);
+	
+	/// <summary>
+	/// Set lowest mip level of texture that renderer is allowed to sample from.
+	/// @remarks
+	///   Implemented as min LOD clamp in renderer's sampler or view state, texture
+	///   storage is not reallocated and handle stays valid.
+	/// </summary>
+	///
+	/// <param name="_handle">Texture handle.</param>
+	/// <param name="_minMip">Most detailed resident mip level. Mip levels above it (more detailed) are not sampled, and can be streamed in later with `bgfx::updateTexture*`, or ignored by application under memory pressure. 0 makes whole mip chain resident.</param>
+	///
+	[LinkName("bgfx_set_texture_resident_mips")]
+	public static extern void set_texture_resident_mips(TextureHandle _handle, uint8 _minMip);
+	
+	/// <summary>
+	/// Returns texture streaming feedback.
+	/// </summary>
+	///
+	/// <param name="_handle">Texture handle.</param>
+	/// <param name="_minMip">Most detailed resident mip level, set with `bgfx::setTextureResidentMips`. Can be NULL.</param>
+	///
+	[LinkName("bgfx_get_texture_used_frame")]
+	public static extern uint32 get_texture_used_frame(TextureHandle _handle, uint8* _minMip);
+	
 	/// <summary>
 	/// Set texture debug name.
 	/// </summary>
@@ -3296,6 +3489,28 @@ public static class bgfx
 	[LinkName("bgfx_create_frame_buffer_scaled")]
 	public static extern FrameBufferHandle create_frame_buffer_scaled(BackbufferRatio _ratio, TextureFormat _format, uint64 _textureFlags);
 	
+	/// <summary>
+	/// Allocate transient frame buffer. Frame buffer is valid only for current
+	/// frame, and only inside views from `_firstView` to `_lastView`.
+	/// @remarks
+	///   Transient frame buffers with same size, format and flags, whose view lifetimes
+	///   don't overlap, share the same render target. Content doesn't persist between
+	///   lifetimes. Lifetime is in view execution order, with `bgfx::setViewOrder`
+	///   remapping applied, so view order must be set before allocation.
+	/// @attention Handle must not be destroyed, render targets are released once not
+	///   allocated for `BGFX_CONFIG_TRANSIENT_FRAME_BUFFER_MAX_AGE` frames.
+	/// </summary>
+	///
+	/// <param name="_width">Texture width.</param>
+	/// <param name="_height">Texture height.</param>
+	/// <param name="_format">Texture format. See: `TextureFormat::Enum`.</param>
+	/// <param name="_firstView">First view in which frame buffer is written or sampled.</param>
+	/// <param name="_lastView">Last view in which frame buffer is written or sampled.</param>
+	/// <param name="_textureFlags">Texture creation (see `BGFX_TEXTURE_*`.), and sampler (see `BGFX_SAMPLER_*`) flags.</param>
+	///
+	[LinkName("bgfx_alloc_transient_frame_buffer")]
+	public static extern FrameBufferHandle alloc_transient_frame_buffer(uint16 _width, uint16 _height, TextureFormat _format, ViewId _firstView, ViewId _lastView, uint64 _textureFlags);
+	
 	/// <summary>
 	/// Create MRT frame buffer from texture handles (simple).
 	/// </summary>
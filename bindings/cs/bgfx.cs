@@ -1,5 +1,5 @@
 /*
- * Copyright 2011-2022 Branimir Karadzic. All rights reserved.
+ * Copyright 2011-2023 Branimir Karadzic. All rights reserved.
  * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
  */
 
@@ -1997,6 +1997,26 @@ public static partial class bgfx
 		Count
 	}
 	
+	public enum UploadPriority
+	{
+		/// <summary>
+		/// Issued after all other updates.
+		/// </summary>
+		Low,
+	
+		/// <summary>
+		/// Default priority.
+		/// </summary>
+		Normal,
+	
+		/// <summary>
+		/// Issued before all other updates.
+		/// </summary>
+		High,
+	
+		Count
+	}
+	
 	public enum RenderFrame
 	{
 		/// <summary>
@@ -2103,6 +2123,7 @@ public static partial class bgfx
 			public uint minResourceCbSize;
 			public uint transientVbSize;
 			public uint transientIbSize;
+			public uint uploadBudget;
 		}
 	
 		public RendererType type;
@@ -2114,6 +2135,9 @@ public static partial class bgfx
 		public PlatformData platformData;
 		public Resolution resolution;
 		public Limits limits;
+		public uint handoffSpin;
+		public ulong renderThreadAffinity;
+		public int8_t renderThreadPriority;
 		public IntPtr callback;
 		public IntPtr allocator;
 	}
@@ -2189,6 +2213,12 @@ public static partial class bgfx
 		public ushort num;
 	}
 	
+	public unsafe struct SpecializationConstant
+	{
+		public uint id;
+		public uint value;
+	}
+	
 	public unsafe struct ViewStats
 	{
 		public fixed byte name[256];
@@ -2248,6 +2278,28 @@ public static partial class bgfx
 		public ViewStats* viewStats;
 		public byte numEncoders;
 		public EncoderStats* encoderStats;
+		public uint numUploadsPending;
+		public uint uploadQueueSize;
+		public uint numTransientFrameBuffers;
+		public uint numTransientFrameBufferAllocs;
+		public uint numRecycleHits;
+		public uint numRecycleMisses;
+		public uint numRecycled;
+		public uint numPipelinesCreated;
+		public uint numPipelinesPrecached;
+		public uint numGpuMemoryBlocks;
+		public uint numGpuMemoryAllocations;
+		public uint numGpuMemoryDedicated;
+		public long gpuMemoryAllocated;
+		public long gpuMemoryBound;
+		public uint numBarriers;
+		public uint numImageBarriers;
+		public long shaderCompileTime;
+		public uint numProgramsCompiling;
+		public uint numStateCallsIssued;
+		public uint numStateCallsElided;
+		public long handoffSubmit;
+		public long handoffRender;
 	}
 	
 	public unsafe struct VertexLayout
@@ -2549,6 +2601,21 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_frame", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe uint frame(bool _capture);
 	
+	/// <summary>
+	/// Returns number of last frame which GPU finished executing. Frame
+	/// numbers are the ones returned by `bgfx::frame`. Per-frame data
+	/// owned outside the library, and referenced by that frame or any
+	/// frame before it, can be reused.
+	/// @remarks
+	///   Renderers that don't track GPU completion return an estimate,
+	///   last rendered frame number minus `BGFX_CONFIG_MAX_FRAME_LATENCY`.
+	///   Estimate is not guaranteed, since it assumes GPU never falls more
+	///   than maximum frame latency behind.
+	/// </summary>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_get_gpu_completed_frame", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe uint get_gpu_completed_frame();
+	
 	/// <summary>
 	/// Returns current renderer backend API type.
 	/// @remarks
@@ -2584,6 +2651,16 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_alloc", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe Memory* alloc(uint _size);
 	
+	/// <summary>
+	/// Allocate buffer to pass to bgfx calls. Data will be freed inside bgfx.
+	/// </summary>
+	///
+	/// <param name="_size">Size to allocate.</param>
+	/// <param name="_persistent">Memory is expected to be held for longer than a few frames before it's passed to bgfx. When false, small blocks are allocated from internal linear arena.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_alloc_persistent", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe Memory* alloc_persistent(uint _size, bool _persistent);
+	
 	/// <summary>
 	/// Allocate buffer and copy data into it. Data will be freed inside bgfx.
 	/// </summary>
@@ -2594,6 +2671,17 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_copy", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe Memory* copy(void* _data, uint _size);
 	
+	/// <summary>
+	/// Allocate buffer and copy data into it. Data will be freed inside bgfx.
+	/// </summary>
+	///
+	/// <param name="_data">Pointer to data to be copied.</param>
+	/// <param name="_size">Size of data to be copied.</param>
+	/// <param name="_persistent">Memory is expected to be held for longer than a few frames before it's passed to bgfx. When false, small blocks are allocated from internal linear arena.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_copy_persistent", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe Memory* copy_persistent(void* _data, uint _size, bool _persistent);
+	
 	/// <summary>
 	/// Make reference to data to pass to bgfx. Unlike `bgfx::alloc`, this call
 	/// doesn't allocate memory for data. It just copies the _data pointer. You
@@ -3010,6 +3098,42 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_create_compute_program", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe ProgramHandle create_compute_program(ShaderHandle _csh, bool _destroyShaders);
 	
+	/// <summary>
+	/// Create program with vertex and fragment shaders, and specialization
+	/// constant values.
+	/// @remarks
+	///   Constants are declared in shader with `SPECIALIZATION_CONSTANT(id,
+	///   type, name, default)` from `bgfx_shader.sh`. Only Vulkan renderer
+	///   specializes shaders, on other renderers macro declares regular
+	///   constant and values are ignored. Constant ids must be unique.
+	/// </summary>
+	///
+	/// <param name="_vsh">Vertex shader.</param>
+	/// <param name="_fsh">Fragment shader.</param>
+	/// <param name="_num">Number of specialization constants.</param>
+	/// <param name="_constants">Specialization constant values. Constants not listed keep default value declared in shader.</param>
+	/// <param name="_destroyShaders">If true, shaders will be destroyed when program is destroyed.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_create_program_specialized", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe ProgramHandle create_program_specialized(ShaderHandle _vsh, ShaderHandle _fsh, byte _num, SpecializationConstant* _constants, bool _destroyShaders);
+	
+	/// <summary>
+	/// Create program with compute shader, and specialization constant values.
+	/// @remarks
+	///   Constants are declared in shader with `SPECIALIZATION_CONSTANT(id,
+	///   type, name, default)` from `bgfx_shader.sh`. Only Vulkan renderer
+	///   specializes shaders, on other renderers macro declares regular
+	///   constant and values are ignored. Constant ids must be unique.
+	/// </summary>
+	///
+	/// <param name="_csh">Compute shader.</param>
+	/// <param name="_num">Number of specialization constants.</param>
+	/// <param name="_constants">Specialization constant values. Constants not listed keep default value declared in shader.</param>
+	/// <param name="_destroyShaders">If true, shaders will be destroyed when program is destroyed.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_create_compute_program_specialized", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe ProgramHandle create_compute_program_specialized(ShaderHandle _csh, byte _num, SpecializationConstant* _constants, bool _destroyShaders);
+	
 	/// <summary>
 	/// Destroy program.
 	/// </summary>
@@ -3019,6 +3143,27 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_destroy_program", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void destroy_program(ProgramHandle _handle);
 	
+	/// <summary>
+	/// Compile pipeline state permutations for program ahead of first use, to
+	/// avoid hitches when draw call needs pipeline state that wasn't created yet.
+	/// Permutations are all combinations of passed states, vertex layouts and
+	/// frame buffers.
+	/// @remarks
+	///   Only Vulkan renderer compiles pipelines on worker threads, other
+	///   renderers ignore this call.
+	/// </summary>
+	///
+	/// <param name="_handle">Program handle.</param>
+	/// <param name="_numStates">Number of render states.</param>
+	/// <param name="_states">Render states. See: `BGFX_STATE_*`.</param>
+	/// <param name="_numLayouts">Number of vertex layouts. When 0, pipelines are compiled without vertex streams.</param>
+	/// <param name="_layouts">Vertex layouts.</param>
+	/// <param name="_numFrameBuffers">Number of frame buffers. When 0, pipelines are compiled for back buffer.</param>
+	/// <param name="_frameBuffers">Frame buffer handles. Invalid handle means back buffer.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_precache_pipelines", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void precache_pipelines(ProgramHandle _handle, ushort _numStates, uint64_t* _states, ushort _numLayouts, VertexLayout* _layouts, ushort _numFrameBuffers, FrameBufferHandle* _frameBuffers);
+	
 	/// <summary>
 	/// Validate texture parameters.
 	/// </summary>
@@ -3198,6 +3343,52 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_read_texture", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe uint read_texture(TextureHandle _handle, void* _data, byte _mip);
 	
+	/// <summary>
+	/// Set upload priority of texture updates.
+	/// @remarks
+	///   Priority is used only when `Init::Limits::uploadBudget` is not 0. Updates
+	///   already waiting in upload queue are moved to new priority.
+	/// </summary>
+	///
+	/// <param name="_handle">Texture handle.</param>
+	/// <param name="_priority">Upload priority. See: `UploadPriority::Enum`.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_set_upload_priority", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void set_upload_priority(TextureHandle _handle, UploadPriority _priority);
+	
+	/// <summary>
+	/// Returns frame number when all texture updates issued so far will be
+	/// executed by renderer.
+	/// </summary>
+	///
+	/// <param name="_handle">Texture handle.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_get_upload_frame", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe uint get_upload_frame(TextureHandle _handle);
+	
+	/// <summary>
+	/// Set lowest mip level of texture that renderer is allowed to sample from.
+	/// @remarks
+	///   Implemented as min LOD clamp in renderer's sampler or view state, texture
+	///   storage is not reallocated and handle stays valid.
+	/// </summary>
+	///
+	/// <param name="_handle">Texture handle.</param>
+	/// <param name="_minMip">Most detailed resident mip level. Mip levels above it (more detailed) are not sampled, and can be streamed in later with `bgfx::updateTexture*`, or ignored by application under memory pressure. 0 makes whole mip chain resident.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_set_texture_resident_mips", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void set_texture_resident_mips(TextureHandle _handle, byte _minMip);
+	
+	/// <summary>
+	/// Returns texture streaming feedback.
+	/// </summary>
+	///
+	/// <param name="_handle">Texture handle.</param>
+	/// <param name="_minMip">Most detailed resident mip level, set with `bgfx::setTextureResidentMips`. Can be NULL.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_get_texture_used_frame", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe uint get_texture_used_frame(TextureHandle _handle, byte* _minMip);
+	
 	/// <summary>
 	/// Set texture debug name.
 	/// </summary>
@@ -3253,6 +3444,28 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_create_frame_buffer_scaled", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe FrameBufferHandle create_frame_buffer_scaled(BackbufferRatio _ratio, TextureFormat _format, ulong _textureFlags);
 	
+	/// <summary>
+	/// Allocate transient frame buffer. Frame buffer is valid only for current
+	/// frame, and only inside views from `_firstView` to `_lastView`.
+	/// @remarks
+	///   Transient frame buffers with same size, format and flags, whose view lifetimes
+	///   don't overlap, share the same render target. Content doesn't persist between
+	///   lifetimes. Lifetime is in view execution order, with `bgfx::setViewOrder`
+	///   remapping applied, so view order must be set before allocation.
+	/// @attention Handle must not be destroyed, render targets are released once not
+	///   allocated for `BGFX_CONFIG_TRANSIENT_FRAME_BUFFER_MAX_AGE` frames.
+	/// </summary>
+	///
+	/// <param name="_width">Texture width.</param>
+	/// <param name="_height">Texture height.</param>
+	/// <param name="_format">Texture format. See: `TextureFormat::Enum`.</param>
+	/// <param name="_firstView">First view in which frame buffer is written or sampled.</param>
+	/// <param name="_lastView">Last view in which frame buffer is written or sampled.</param>
+	/// <param name="_textureFlags">Texture creation (see `BGFX_TEXTURE_*`.), and sampler (see `BGFX_SAMPLER_*`) flags.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_alloc_transient_frame_buffer", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe FrameBufferHandle alloc_transient_frame_buffer(ushort _width, ushort _height, TextureFormat _format, ushort _firstView, ushort _lastView, ulong _textureFlags);
+	
 	/// <summary>
 	/// Create MRT frame buffer from texture handles (simple).
 	/// </summary>
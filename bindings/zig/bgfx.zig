@@ -1,4 +1,4 @@
-// Copyright 2011-2022 Branimir Karadzic. All rights reserved.
+// Copyright 2011-2023 Branimir Karadzic. All rights reserved.
 // License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
 
 
@@ -1257,6 +1257,19 @@ pub const ViewMode = enum(c_int) {
     Count
 };
 
+pub const UploadPriority = enum(c_int) {
+    /// Issued after all other updates.
+    Low,
+
+    /// Default priority.
+    Normal,
+
+    /// Issued before all other updates.
+    High,
+
+    Count
+};
+
 pub const RenderFrame = enum(c_int) {
     /// Renderer context is not created yet.
     NoContext,
@@ -1346,6 +1359,7 @@ pub const Init = extern struct {
         minResourceCbSize: u32,
         transientVbSize: u32,
         transientIbSize: u32,
+        uploadBudget: u32,
     };
 
         type: RendererType,
@@ -1357,6 +1371,9 @@ pub const Init = extern struct {
         platformData: PlatformData,
         resolution: Resolution,
         limits: Limits,
+        handoffSpin: u32,
+        renderThreadAffinity: u64,
+        renderThreadPriority: int8_t,
         callback: ?*anyopaque,
         allocator: ?*anyopaque,
     };
@@ -1434,6 +1451,11 @@ pub const Init = extern struct {
         num: u16,
     };
 
+    pub const SpecializationConstant = extern struct {
+        id: u32,
+        value: u32,
+    };
+
     pub const ViewStats = extern struct {
         name: [256]u8,
         view: ViewId,
@@ -1490,6 +1512,28 @@ pub const Init = extern struct {
         viewStats: [*c]ViewStats,
         numEncoders: u8,
         encoderStats: [*c]EncoderStats,
+        numUploadsPending: u32,
+        uploadQueueSize: u32,
+        numTransientFrameBuffers: u32,
+        numTransientFrameBufferAllocs: u32,
+        numRecycleHits: u32,
+        numRecycleMisses: u32,
+        numRecycled: u32,
+        numPipelinesCreated: u32,
+        numPipelinesPrecached: u32,
+        numGpuMemoryBlocks: u32,
+        numGpuMemoryAllocations: u32,
+        numGpuMemoryDedicated: u32,
+        gpuMemoryAllocated: i64,
+        gpuMemoryBound: i64,
+        numBarriers: u32,
+        numImageBarriers: u32,
+        shaderCompileTime: i64,
+        numProgramsCompiling: u32,
+        numStateCallsIssued: u32,
+        numStateCallsElided: u32,
+        handoffSubmit: i64,
+        handoffRender: i64,
     };
 
     pub const VertexLayout = extern struct {
@@ -2088,6 +2132,20 @@ pub inline fn frame(_capture: bool) u32 {
 }
 extern fn bgfx_frame(_capture: bool) u32;
 
+/// Returns number of last frame which GPU finished executing. Frame
+/// numbers are the ones returned by `bgfx::frame`. Per-frame data
+/// owned outside the library, and referenced by that frame or any
+/// frame before it, can be reused.
+/// @remarks
+///   Renderers that don't track GPU completion return an estimate,
+///   last rendered frame number minus `BGFX_CONFIG_MAX_FRAME_LATENCY`.
+///   Estimate is not guaranteed, since it assumes GPU never falls more
+///   than maximum frame latency behind.
+pub inline fn getGpuCompletedFrame() u32 {
+    return bgfx_get_gpu_completed_frame();
+}
+extern fn bgfx_get_gpu_completed_frame() u32;
+
 /// Returns current renderer backend API type.
 /// @remarks
 ///   Library must be initialized.
@@ -2118,6 +2176,14 @@ pub inline fn alloc(_size: u32) [*c]const Memory {
 }
 extern fn bgfx_alloc(_size: u32) [*c]const Memory;
 
+/// Allocate buffer to pass to bgfx calls. Data will be freed inside bgfx.
+/// <param name="_size">Size to allocate.</param>
+/// <param name="_persistent">Memory is expected to be held for longer than a few frames before it's passed to bgfx. When false, small blocks are allocated from internal linear arena.</param>
+pub inline fn allocPersistent(_size: u32, _persistent: bool) [*c]const Memory {
+    return bgfx_alloc_persistent(_size, _persistent);
+}
+extern fn bgfx_alloc_persistent(_size: u32, _persistent: bool) [*c]const Memory;
+
 /// Allocate buffer and copy data into it. Data will be freed inside bgfx.
 /// <param name="_data">Pointer to data to be copied.</param>
 /// <param name="_size">Size of data to be copied.</param>
@@ -2126,6 +2192,15 @@ pub inline fn copy(_data: ?*const anyopaque, _size: u32) [*c]const Memory {
 }
 extern fn bgfx_copy(_data: ?*const anyopaque, _size: u32) [*c]const Memory;
 
+/// Allocate buffer and copy data into it. Data will be freed inside bgfx.
+/// <param name="_data">Pointer to data to be copied.</param>
+/// <param name="_size">Size of data to be copied.</param>
+/// <param name="_persistent">Memory is expected to be held for longer than a few frames before it's passed to bgfx. When false, small blocks are allocated from internal linear arena.</param>
+pub inline fn copyPersistent(_data: ?*const anyopaque, _size: u32, _persistent: bool) [*c]const Memory {
+    return bgfx_copy_persistent(_data, _size, _persistent);
+}
+extern fn bgfx_copy_persistent(_data: ?*const anyopaque, _size: u32, _persistent: bool) [*c]const Memory;
+
 /// Make reference to data to pass to bgfx. Unlike `bgfx::alloc`, this call
 /// doesn't allocate memory for data. It just copies the _data pointer. You
 /// can pass `ReleaseFn` function pointer to release this memory after it's
@@ -2444,6 +2519,38 @@ pub inline fn createComputeProgram(_csh: ShaderHandle, _destroyShaders: bool) Pr
 }
 extern fn bgfx_create_compute_program(_csh: ShaderHandle, _destroyShaders: bool) ProgramHandle;
 
+/// Create program with vertex and fragment shaders, and specialization
+/// constant values.
+/// @remarks
+///   Constants are declared in shader with `SPECIALIZATION_CONSTANT(id,
+///   type, name, default)` from `bgfx_shader.sh`. Only Vulkan renderer
+///   specializes shaders, on other renderers macro declares regular
+///   constant and values are ignored. Constant ids must be unique.
+/// <param name="_vsh">Vertex shader.</param>
+/// <param name="_fsh">Fragment shader.</param>
+/// <param name="_num">Number of specialization constants.</param>
+/// <param name="_constants">Specialization constant values. Constants not listed keep default value declared in shader.</param>
+/// <param name="_destroyShaders">If true, shaders will be destroyed when program is destroyed.</param>
+pub inline fn createProgramSpecialized(_vsh: ShaderHandle, _fsh: ShaderHandle, _num: u8, _constants: [*c]const SpecializationConstant, _destroyShaders: bool) ProgramHandle {
+    return bgfx_create_program_specialized(_vsh, _fsh, _num, _constants, _destroyShaders);
+}
+extern fn bgfx_create_program_specialized(_vsh: ShaderHandle, _fsh: ShaderHandle, _num: u8, _constants: [*c]const SpecializationConstant, _destroyShaders: bool) ProgramHandle;
+
+/// Create program with compute shader, and specialization constant values.
+/// @remarks
+///   Constants are declared in shader with `SPECIALIZATION_CONSTANT(id,
+///   type, name, default)` from `bgfx_shader.sh`. Only Vulkan renderer
+///   specializes shaders, on other renderers macro declares regular
+///   constant and values are ignored. Constant ids must be unique.
+/// <param name="_csh">Compute shader.</param>
+/// <param name="_num">Number of specialization constants.</param>
+/// <param name="_constants">Specialization constant values. Constants not listed keep default value declared in shader.</param>
+/// <param name="_destroyShaders">If true, shaders will be destroyed when program is destroyed.</param>
+pub inline fn createComputeProgramSpecialized(_csh: ShaderHandle, _num: u8, _constants: [*c]const SpecializationConstant, _destroyShaders: bool) ProgramHandle {
+    return bgfx_create_compute_program_specialized(_csh, _num, _constants, _destroyShaders);
+}
+extern fn bgfx_create_compute_program_specialized(_csh: ShaderHandle, _num: u8, _constants: [*c]const SpecializationConstant, _destroyShaders: bool) ProgramHandle;
+
 /// Destroy program.
 /// <param name="_handle">Program handle.</param>
 pub inline fn destroyProgram(_handle: ProgramHandle) void {
@@ -2451,6 +2558,25 @@ pub inline fn destroyProgram(_handle: ProgramHandle) void {
 }
 extern fn bgfx_destroy_program(_handle: ProgramHandle) void;
 
+/// Compile pipeline state permutations for program ahead of first use, to
+/// avoid hitches when draw call needs pipeline state that wasn't created yet.
+/// Permutations are all combinations of passed states, vertex layouts and
+/// frame buffers.
+/// @remarks
+///   Only Vulkan renderer compiles pipelines on worker threads, other
+///   renderers ignore this call.
+/// <param name="_handle">Program handle.</param>
+/// <param name="_numStates">Number of render states.</param>
+/// <param name="_states">Render states. See: `BGFX_STATE_*`.</param>
+/// <param name="_numLayouts">Number of vertex layouts. When 0, pipelines are compiled without vertex streams.</param>
+/// <param name="_layouts">Vertex layouts.</param>
+/// <param name="_numFrameBuffers">Number of frame buffers. When 0, pipelines are compiled for back buffer.</param>
+/// <param name="_frameBuffers">Frame buffer handles. Invalid handle means back buffer.</param>
+pub inline fn precachePipelines(_handle: ProgramHandle, _numStates: u16, _states: [*c]const uint64_t, _numLayouts: u16, _layouts: [*c]const VertexLayout, _numFrameBuffers: u16, _frameBuffers: [*c]const FrameBufferHandle) void {
+    return bgfx_precache_pipelines(_handle, _numStates, _states, _numLayouts, _layouts, _numFrameBuffers, _frameBuffers);
+}
+extern fn bgfx_precache_pipelines(_handle: ProgramHandle, _numStates: u16, _states: [*c]const uint64_t, _numLayouts: u16, _layouts: [*c]const VertexLayout, _numFrameBuffers: u16, _frameBuffers: [*c]const FrameBufferHandle) void;
+
 /// Validate texture parameters.
 /// <param name="_depth">Depth dimension of volume texture.</param>
 /// <param name="_cubeMap">Indicates that texture contains cubemap.</param>
@@ -2604,6 +2730,44 @@ pub inline fn readTexture(_handle: TextureHandle, _data: ?*anyopaque, _mip: u8)
 }
 extern fn bgfx_read_texture(_handle: TextureHandle, _data: ?*anyopaque, _mip: u8) u32;
 
+/// Set upload priority of texture updates.
+/// @remarks
+///   Priority is used only when `Init::Limits::uploadBudget` is not 0. Updates
+///   already waiting in upload queue are moved to new priority.
+/// <param name="_handle">Texture handle.</param>
+/// <param name="_priority">Upload priority. See: `UploadPriority::Enum`.</param>
+pub inline fn setUploadPriority(_handle: TextureHandle, _priority: UploadPriority) void {
+    return bgfx_set_upload_priority(_handle, _priority);
+}
+extern fn bgfx_set_upload_priority(_handle: TextureHandle, _priority: UploadPriority) void;
+
+/// Returns frame number when all texture updates issued so far will be
+/// executed by renderer.
+/// <param name="_handle">Texture handle.</param>
+pub inline fn getUploadFrame(_handle: TextureHandle) u32 {
+    return bgfx_get_upload_frame(_handle);
+}
+extern fn bgfx_get_upload_frame(_handle: TextureHandle) u32;
+
+/// Set lowest mip level of texture that renderer is allowed to sample from.
+/// @remarks
+///   Implemented as min LOD clamp in renderer's sampler or view state, texture
+///   storage is not reallocated and handle stays valid.
+/// <param name="_handle">Texture handle.</param>
+/// <param name="_minMip">Most detailed resident mip level. Mip levels above it (more detailed) are not sampled, and can be streamed in later with `bgfx::updateTexture*`, or ignored by application under memory pressure. 0 makes whole mip chain resident.</param>
+pub inline fn setTextureResidentMips(_handle: TextureHandle, _minMip: u8) void {
+    return bgfx_set_texture_resident_mips(_handle, _minMip);
+}
+extern fn bgfx_set_texture_resident_mips(_handle: TextureHandle, _minMip: u8) void;
+
+/// Returns texture streaming feedback.
+/// <param name="_handle">Texture handle.</param>
+/// <param name="_minMip">Most detailed resident mip level, set with `bgfx::setTextureResidentMips`. Can be NULL.</param>
+pub inline fn getTextureUsedFrame(_handle: TextureHandle, _minMip: [*c]u8) u32 {
+    return bgfx_get_texture_used_frame(_handle, _minMip);
+}
+extern fn bgfx_get_texture_used_frame(_handle: TextureHandle, _minMip: [*c]u8) u32;
+
 /// Set texture debug name.
 /// <param name="_handle">Texture handle.</param>
 /// <param name="_name">Texture name.</param>
@@ -2649,6 +2813,26 @@ pub inline fn createFrameBufferScaled(_ratio: BackbufferRatio, _format: TextureF
 }
 extern fn bgfx_create_frame_buffer_scaled(_ratio: BackbufferRatio, _format: TextureFormat, _textureFlags: u64) FrameBufferHandle;
 
+/// Allocate transient frame buffer. Frame buffer is valid only for current
+/// frame, and only inside views from `_firstView` to `_lastView`.
+/// @remarks
+///   Transient frame buffers with same size, format and flags, whose view lifetimes
+///   don't overlap, share the same render target. Content doesn't persist between
+///   lifetimes. Lifetime is in view execution order, with `bgfx::setViewOrder`
+///   remapping applied, so view order must be set before allocation.
+/// @attention Handle must not be destroyed, render targets are released once not
+///   allocated for `BGFX_CONFIG_TRANSIENT_FRAME_BUFFER_MAX_AGE` frames.
+/// <param name="_width">Texture width.</param>
+/// <param name="_height">Texture height.</param>
+/// <param name="_format">Texture format. See: `TextureFormat::Enum`.</param>
+/// <param name="_firstView">First view in which frame buffer is written or sampled.</param>
+/// <param name="_lastView">Last view in which frame buffer is written or sampled.</param>
+/// <param name="_textureFlags">Texture creation (see `BGFX_TEXTURE_*`.), and sampler (see `BGFX_SAMPLER_*`) flags.</param>
+pub inline fn allocTransientFrameBuffer(_width: u16, _height: u16, _format: TextureFormat, _firstView: ViewId, _lastView: ViewId, _textureFlags: u64) FrameBufferHandle {
+    return bgfx_alloc_transient_frame_buffer(_width, _height, _format, _firstView, _lastView, _textureFlags);
+}
+extern fn bgfx_alloc_transient_frame_buffer(_width: u16, _height: u16, _format: TextureFormat, _firstView: ViewId, _lastView: ViewId, _textureFlags: u64) FrameBufferHandle;
+
 /// Create MRT frame buffer from texture handles (simple).
 /// <param name="_num">Number of texture handles.</param>
 /// <param name="_handles">Texture attachments.</param>
@@ -0,0 +1,439 @@
+/*
+ * Copyright 2011-2023 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include "common.h"
+#include "bgfx_utils.h"
+
+#include <bx/commandline.h>
+#include <bx/file.h>
+#include <bx/string.h>
+#include <bx/timer.h>
+
+#include <inttypes.h>
+
+namespace
+{
+
+struct PosColorVertex
+{
+	float m_x;
+	float m_y;
+	float m_z;
+	uint32_t m_abgr;
+
+	static void init()
+	{
+		ms_layout
+			.begin()
+			.add(bgfx::Attrib::Position, 3, bgfx::AttribType::Float)
+			.add(bgfx::Attrib::Color0,   4, bgfx::AttribType::Uint8, true)
+			.end();
+	};
+
+	static bgfx::VertexLayout ms_layout;
+};
+
+bgfx::VertexLayout PosColorVertex::ms_layout;
+
+static PosColorVertex s_cubeVertices[8] =
+{
+	{-1.0f,  1.0f,  1.0f, 0xff000000 },
+	{ 1.0f,  1.0f,  1.0f, 0xff0000ff },
+	{-1.0f, -1.0f,  1.0f, 0xff00ff00 },
+	{ 1.0f, -1.0f,  1.0f, 0xff00ffff },
+	{-1.0f,  1.0f, -1.0f, 0xffff0000 },
+	{ 1.0f,  1.0f, -1.0f, 0xffff00ff },
+	{-1.0f, -1.0f, -1.0f, 0xffffff00 },
+	{ 1.0f, -1.0f, -1.0f, 0xffffffff },
+};
+
+static const uint16_t s_cubeIndices[36] =
+{
+	0, 1, 2, // 0
+	1, 3, 2,
+	4, 6, 5, // 2
+	5, 6, 7,
+	0, 2, 4, // 4
+	4, 2, 6,
+	1, 5, 3, // 6
+	5, 7, 3,
+	0, 4, 1, // 8
+	4, 5, 1,
+	2, 3, 6, // 10
+	6, 3, 7,
+};
+
+static const uint64_t s_depthTest[] =
+{
+	BGFX_STATE_DEPTH_TEST_LESS,
+	BGFX_STATE_DEPTH_TEST_LEQUAL,
+	BGFX_STATE_DEPTH_TEST_EQUAL,
+	BGFX_STATE_DEPTH_TEST_GEQUAL,
+	BGFX_STATE_DEPTH_TEST_GREATER,
+	BGFX_STATE_DEPTH_TEST_NOTEQUAL,
+	BGFX_STATE_DEPTH_TEST_NEVER,
+	BGFX_STATE_DEPTH_TEST_ALWAYS,
+};
+
+static const uint64_t s_cull[] =
+{
+	UINT64_C(0),
+	BGFX_STATE_CULL_CW,
+	BGFX_STATE_CULL_CCW,
+};
+
+static const uint64_t s_blend[] =
+{
+	UINT64_C(0),
+	BGFX_STATE_BLEND_ALPHA,
+	BGFX_STATE_BLEND_ADD,
+	BGFX_STATE_BLEND_MULTIPLY,
+};
+
+static const uint64_t s_writeMask[] =
+{
+	BGFX_STATE_WRITE_RGB|BGFX_STATE_WRITE_A|BGFX_STATE_WRITE_Z,
+	BGFX_STATE_WRITE_RGB|BGFX_STATE_WRITE_Z,
+	BGFX_STATE_WRITE_RGB|BGFX_STATE_WRITE_A,
+	BGFX_STATE_WRITE_RGB,
+};
+
+static const uint32_t kNumStates = 0
+	+ BX_COUNTOF(s_depthTest)
+	* BX_COUNTOF(s_cull)
+	* BX_COUNTOF(s_blend)
+	* BX_COUNTOF(s_writeMask)
+	;
+
+uint64_t getState(uint32_t _idx)
+{
+	uint32_t idx = _idx;
+	const uint64_t depthTest = s_depthTest[idx % BX_COUNTOF(s_depthTest)]; idx /= BX_COUNTOF(s_depthTest);
+	const uint64_t cull      = s_cull[idx % BX_COUNTOF(s_cull)];           idx /= BX_COUNTOF(s_cull);
+	const uint64_t blend     = s_blend[idx % BX_COUNTOF(s_blend)];         idx /= BX_COUNTOF(s_blend);
+	const uint64_t writeMask = s_writeMask[idx % BX_COUNTOF(s_writeMask)];
+
+	return 0
+		| depthTest
+		| cull
+		| blend
+		| writeMask
+		| BGFX_STATE_MSAA
+		;
+}
+
+struct BgfxCallback : public bgfx::CallbackI
+{
+	BgfxCallback()
+		: m_cold(false)
+		, m_numReads(0)
+		, m_numWrites(0)
+		, m_readSize(0)
+		, m_writeSize(0)
+	{
+	}
+
+	virtual ~BgfxCallback()
+	{
+	}
+
+	virtual void fatal(const char* _filePath, uint16_t _line, bgfx::Fatal::Enum _code, const char* _str) override
+	{
+		BX_UNUSED(_filePath, _line);
+
+		bx::debugPrintf("Fatal error: 0x%08x: %s", _code, _str);
+		abort();
+	}
+
+	virtual void traceVargs(const char* _filePath, uint16_t _line, const char* _format, va_list _argList) override
+	{
+		bx::debugPrintf("%s (%d): ", _filePath, _line);
+		bx::debugPrintfVargs(_format, _argList);
+	}
+
+	virtual void profilerBegin(const char* /*_name*/, uint32_t /*_abgr*/, const char* /*_filePath*/, uint16_t /*_line*/) override
+	{
+	}
+
+	virtual void profilerBeginLiteral(const char* /*_name*/, uint32_t /*_abgr*/, const char* /*_filePath*/, uint16_t /*_line*/) override
+	{
+	}
+
+	virtual void profilerEnd() override
+	{
+	}
+
+	virtual uint32_t cacheReadSize(uint64_t _id) override
+	{
+		// Cold start pretends there is nothing cached, but still writes cache
+		// so that next run can measure warm start.
+		if (m_cold)
+		{
+			return 0;
+		}
+
+		char filePath[256];
+		bx::snprintf(filePath, sizeof(filePath), "temp/%016" PRIx64, _id);
+
+		bx::FileReaderI* reader = entry::getFileReader();
+		bx::Error err;
+		if (bx::open(reader, filePath, &err) )
+		{
+			uint32_t size = (uint32_t)bx::getSize(reader);
+			bx::close(reader);
+			return size;
+		}
+
+		return 0;
+	}
+
+	virtual bool cacheRead(uint64_t _id, void* _data, uint32_t _size) override
+	{
+		char filePath[256];
+		bx::snprintf(filePath, sizeof(filePath), "temp/%016" PRIx64, _id);
+
+		bx::FileReaderI* reader = entry::getFileReader();
+		bx::Error err;
+		if (bx::open(reader, filePath, &err) )
+		{
+			uint32_t result = bx::read(reader, _data, _size, &err);
+			bx::close(reader);
+
+			++m_numReads;
+			m_readSize += result;
+
+			return result == _size;
+		}
+
+		return false;
+	}
+
+	virtual void cacheWrite(uint64_t _id, const void* _data, uint32_t _size) override
+	{
+		char filePath[256];
+		bx::snprintf(filePath, sizeof(filePath), "temp/%016" PRIx64, _id);
+
+		bx::FileWriterI* writer = entry::getFileWriter();
+		bx::Error err;
+		if (bx::open(writer, filePath, false, &err) )
+		{
+			bx::write(writer, _data, _size, &err);
+			bx::close(writer);
+
+			++m_numWrites;
+			m_writeSize += _size;
+		}
+	}
+
+	virtual void screenShot(const char* /*_filePath*/, uint32_t /*_width*/, uint32_t /*_height*/, uint32_t /*_pitch*/, const void* /*_data*/, uint32_t /*_size*/, bool /*_yflip*/) override
+	{
+	}
+
+	virtual void captureBegin(uint32_t /*_width*/, uint32_t /*_height*/, uint32_t /*_pitch*/, bgfx::TextureFormat::Enum /*_format*/, bool /*_yflip*/) override
+	{
+	}
+
+	virtual void captureEnd() override
+	{
+	}
+
+	virtual void captureFrame(const void* /*_data*/, uint32_t /*_size*/) override
+	{
+	}
+
+	bool m_cold;
+	uint32_t m_numReads;
+	uint32_t m_numWrites;
+	uint64_t m_readSize;
+	uint64_t m_writeSize;
+};
+
+class ExamplePipelineCache : public entry::AppI
+{
+public:
+	ExamplePipelineCache(const char* _name, const char* _description, const char* _url)
+		: entry::AppI(_name, _description, _url)
+	{
+	}
+
+	void init(int32_t _argc, const char* const* _argv, uint32_t _width, uint32_t _height) override
+	{
+		Args args(_argc, _argv);
+
+		bx::CommandLine cmdLine(_argc, (const char**)_argv);
+		m_callback.m_cold = cmdLine.hasArg("cold");
+
+		m_width  = _width;
+		m_height = _height;
+		m_debug  = BGFX_DEBUG_TEXT;
+		m_reset  = BGFX_RESET_NONE;
+
+		m_frame       = 0;
+		m_timeInit    = 0;
+		m_timeStartup = 0;
+
+		const int64_t timeStart = bx::getHPCounter();
+
+		bgfx::Init init;
+		init.type     = args.m_type;
+		init.vendorId = args.m_pciId;
+		init.platformData.nwh  = entry::getNativeWindowHandle(entry::kDefaultWindowHandle);
+		init.platformData.ndt  = entry::getNativeDisplayHandle();
+		init.resolution.width  = m_width;
+		init.resolution.height = m_height;
+		init.resolution.reset  = m_reset;
+		init.callback = &m_callback;
+		bgfx::init(init);
+
+		m_timeStart = timeStart;
+		m_timeInit  = bx::getHPCounter() - timeStart;
+
+		bgfx::setDebug(m_debug);
+
+		bgfx::setViewClear(0
+			, BGFX_CLEAR_COLOR|BGFX_CLEAR_DEPTH
+			, 0x303030ff
+			, 1.0f
+			, 0
+			);
+
+		PosColorVertex::init();
+
+		m_vbh = bgfx::createVertexBuffer(
+			  bgfx::makeRef(s_cubeVertices, sizeof(s_cubeVertices) )
+			, PosColorVertex::ms_layout
+			);
+
+		m_ibh = bgfx::createIndexBuffer(bgfx::makeRef(s_cubeIndices, sizeof(s_cubeIndices) ) );
+
+		m_program = loadProgram("vs_cubes", "fs_cubes");
+	}
+
+	virtual int shutdown() override
+	{
+		bgfx::destroy(m_ibh);
+		bgfx::destroy(m_vbh);
+		bgfx::destroy(m_program);
+
+		// Pipeline cache is written at shutdown at the latest.
+		bgfx::shutdown();
+
+		bx::debugPrintf("Pipeline cache: %d write(s), %" PRIu64 " byte(s).\n"
+			, m_callback.m_numWrites
+			, m_callback.m_writeSize
+			);
+
+		return 0;
+	}
+
+	bool update() override
+	{
+		if (!entry::processEvents(m_width, m_height, m_debug, m_reset) )
+		{
+			const double toMs = 1000.0/double(bx::getHPFrequency() );
+
+			bgfx::dbgTextClear();
+			bgfx::dbgTextPrintf(0, 1, 0x0f, "%s start, %d pipeline state(s), renderer: %s."
+				, m_callback.m_cold ? "Cold" : "Warm"
+				, kNumStates
+				, bgfx::getRendererName(bgfx::getRendererType() )
+				);
+			bgfx::dbgTextPrintf(0, 2, 0x0f, "Cache read: %d blob(s), %" PRIu64 " byte(s)."
+				, m_callback.m_numReads
+				, m_callback.m_readSize
+				);
+
+			if (0 != m_timeStartup)
+			{
+				bgfx::dbgTextPrintf(0, 3, 0x0f, "    init: %10.3f [ms]", double(m_timeInit)*toMs);
+				bgfx::dbgTextPrintf(0, 4, 0x0f, " startup: %10.3f [ms]", double(m_timeStartup)*toMs);
+			}
+
+			const bx::Vec3 at  = { 0.0f, 0.0f,   0.0f };
+			const bx::Vec3 eye = { 0.0f, 0.0f, -70.0f };
+
+			float view[16];
+			bx::mtxLookAt(view, eye, at);
+
+			float proj[16];
+			bx::mtxProj(proj, 60.0f, float(m_width)/float(m_height), 0.1f, 200.0f, bgfx::getCaps()->homogeneousDepth);
+			bgfx::setViewTransform(0, view, proj);
+			bgfx::setViewRect(0, 0, 0, uint16_t(m_width), uint16_t(m_height) );
+
+			bgfx::touch(0);
+
+			// Every cube uses different render state, so every cube requires
+			// its own pipeline on renderers with pipeline state objects.
+			const uint32_t dim = uint32_t(bx::ceil(bx::sqrt(float(kNumStates) ) ) );
+
+			for (uint32_t ii = 0; ii < kNumStates; ++ii)
+			{
+				const uint32_t xx = ii % dim;
+				const uint32_t yy = ii / dim;
+
+				float mtx[16];
+				bx::mtxRotateXY(mtx, xx*0.21f, yy*0.37f);
+				mtx[12] = -float(dim)*1.5f + float(xx)*3.0f;
+				mtx[13] = -float(dim)*1.5f + float(yy)*3.0f;
+				mtx[14] = 0.0f;
+
+				bgfx::setTransform(mtx);
+				bgfx::setVertexBuffer(0, m_vbh);
+				bgfx::setIndexBuffer(m_ibh);
+				bgfx::setState(getState(ii) );
+				bgfx::submit(0, m_program);
+			}
+
+			bgfx::frame();
+
+			// First frame creates all pipelines. Frame call waits for render
+			// thread to finish previous frame, so first frame is complete once
+			// second frame call returns.
+			if (1 == m_frame)
+			{
+				m_timeStartup = bx::getHPCounter() - m_timeStart;
+
+				bx::debugPrintf("%s start, %d pipeline state(s): init %.3f [ms], startup %.3f [ms], cache read %" PRIu64 " byte(s).\n"
+					, m_callback.m_cold ? "Cold" : "Warm"
+					, kNumStates
+					, double(m_timeInit)*toMs
+					, double(m_timeStartup)*toMs
+					, m_callback.m_readSize
+					);
+			}
+
+			++m_frame;
+
+			return true;
+		}
+
+		return false;
+	}
+
+	BgfxCallback m_callback;
+
+	uint32_t m_width;
+	uint32_t m_height;
+	uint32_t m_debug;
+	uint32_t m_reset;
+
+	bgfx::VertexBufferHandle m_vbh;
+	bgfx::IndexBufferHandle  m_ibh;
+	bgfx::ProgramHandle      m_program;
+
+	uint32_t m_frame;
+	int64_t  m_timeStart;
+	int64_t  m_timeInit;
+	int64_t  m_timeStartup;
+};
+
+} // namespace
+
+ENTRY_IMPLEMENT_MAIN(
+	  ExamplePipelineCache
+	, "50-pipelinecache"
+	, "Pipeline cache cold/warm startup benchmark."
+	, "https://bkaradzic.github.io/bgfx/examples.html#pipelinecache"
+	);
@@ -403,6 +403,23 @@ namespace bgfx
 		};
 	};
 
+	/// Upload priority sets order in which deferred texture updates are issued.
+	///
+	/// @attention C99's equivalent binding is `bgfx_upload_priority_t`.
+	///
+	struct UploadPriority
+	{
+		/// Upload priorities:
+		enum Enum
+		{
+			Low,    //!< Issued after all other updates.
+			Normal, //!< Default priority.
+			High,   //!< Issued before all other updates.
+
+			Count
+		};
+	};
+
 	static const uint16_t kInvalidHandle = UINT16_MAX;
 
 	BGFX_HANDLE(DynamicIndexBufferHandle)
@@ -700,10 +717,23 @@ namespace bgfx
 			uint32_t minResourceCbSize; //!< Minimum resource command buffer size.
 			uint32_t transientVbSize;   //!< Maximum transient vertex buffer size.
 			uint32_t transientIbSize;   //!< Maximum transient index buffer size.
+			uint32_t uploadBudget;      //!< Maximum size of texture updates issued per frame (0 - unlimited). Dynamic buffer updates are never deferred.
 		};
 
 		Limits limits; //!< Configurable runtime limits.
 
+		/// Time in microseconds API and render threads spin waiting for each other
+		/// at frame handoff before blocking on semaphore (0 - block immediately).
+		uint32_t handoffSpin;
+
+		/// Render thread CPU affinity mask (0 - default). Applies only to render
+		/// thread created by bgfx.
+		uint64_t renderThreadAffinity;
+
+		/// Render thread priority, from -2 (lowest) to 2 (highest) (0 - default).
+		/// Applies only to render thread created by bgfx.
+		int8_t renderThreadPriority;
+
 		/// Provide application specific callback interface.
 		/// See: `bgfx::CallbackI`
 		CallbackI* callback;
@@ -941,6 +971,16 @@ namespace bgfx
 		uint16_t num; //!< Number of matrices.
 	};
 
+	/// Specialization constant value.
+	///
+	/// @attention C99's equivalent binding is `bgfx_specialization_constant_t`.
+	///
+	struct SpecializationConstant
+	{
+		uint32_t id;    //!< Constant id, matches id declared with `SPECIALIZATION_CONSTANT` in shader.
+		uint32_t value; //!< Raw 32-bit value (bool, int, uint, or float bits).
+	};
+
 	/// View id.
 	typedef uint16_t ViewId;
 
@@ -1028,6 +1068,37 @@ namespace bgfx
 
 		uint8_t       numEncoders;          //!< Number of encoders used during frame.
 		EncoderStats* encoderStats;         //!< Array of encoder stats.
+
+		uint32_t numUploadsPending;         //!< Number of updates waiting in upload queue.
+		uint32_t uploadQueueSize;           //!< Size of updates waiting in upload queue.
+
+		uint32_t numTransientFrameBuffers;      //!< Number of frame buffers backing transient frame buffers.
+		uint32_t numTransientFrameBufferAllocs; //!< Number of transient frame buffers allocated during frame.
+
+		uint32_t numRecycleHits;            //!< Number of textures and frame buffers reused from recycle pool.
+		uint32_t numRecycleMisses;          //!< Number of textures and frame buffers not found in recycle pool.
+		uint32_t numRecycled;               //!< Number of textures and frame buffers waiting in recycle pool.
+
+		uint32_t numPipelinesCreated;       //!< Number of pipeline states created while submitting draw calls.
+		uint32_t numPipelinesPrecached;     //!< Number of pipeline states compiled by `bgfx::precachePipelines` that became ready.
+
+		uint32_t numGpuMemoryBlocks;        //!< Number of device memory blocks resources are sub-allocated from.
+		uint32_t numGpuMemoryAllocations;   //!< Number of resources sub-allocated from device memory blocks.
+		uint32_t numGpuMemoryDedicated;     //!< Number of resources with dedicated device memory allocation.
+		int64_t gpuMemoryAllocated;         //!< Amount of device memory allocated by renderer.
+		int64_t gpuMemoryBound;             //!< Amount of allocated device memory bound to resources.
+
+		uint32_t numBarriers;               //!< Number of pipeline barriers recorded during frame.
+		uint32_t numImageBarriers;          //!< Number of image layout transitions recorded during frame.
+
+		int64_t shaderCompileTime;          //!< Render thread CPU time spent compiling shaders and linking programs.
+		uint32_t numProgramsCompiling;      //!< Number of programs driver is still compiling in background.
+
+		uint32_t numStateCallsIssued;       //!< Number of state-setting graphics API calls issued during frame.
+		uint32_t numStateCallsElided;       //!< Number of redundant state-setting graphics API calls elided during frame.
+
+		int64_t handoffSubmit;              //!< Latency between API thread handing over frame and render thread waking up.
+		int64_t handoffRender;              //!< Latency between render thread finishing frame and API thread waking up.
 	};
 
 	/// Encoders are used for submitting draw calls from multiple threads. Only one encoder
@@ -2074,6 +2145,24 @@ namespace bgfx
 	///
 	uint32_t frame(bool _capture = false);
 
+	/// Returns number of last frame which GPU finished executing. Frame
+	///   numbers are the ones returned by `bgfx::frame`. Per-frame data
+	///   owned outside the library, and referenced by that frame or any
+	///   frame before it, can be reused.
+	///
+	/// @returns Last completed frame number, or `UINT32_MAX` if GPU hasn't
+	///   completed any frame yet.
+	///
+	/// @remarks
+	///   Renderers that don't track GPU completion return an estimate,
+	///   last rendered frame number minus `BGFX_CONFIG_MAX_FRAME_LATENCY`.
+	///   Estimate is not guaranteed, since it assumes GPU never falls more
+	///   than maximum frame latency behind.
+	///
+	/// @attention C99's equivalent binding is `bgfx_get_gpu_completed_frame`.
+	///
+	uint32_t getGpuCompletedFrame();
+
 	/// Returns current renderer backend API type.
 	///
 	/// @remarks
@@ -2109,6 +2198,20 @@ namespace bgfx
 	///
 	const Memory* alloc(uint32_t _size);
 
+	/// Allocate buffer to pass to bgfx calls. Data will be freed inside bgfx.
+	///
+	/// @param[in] _size Size to allocate.
+	/// @param[in] _persistent Memory is expected to be held for longer than
+	///   a few frames before it's passed to bgfx. When false, small blocks are
+	///   allocated from internal linear arena.
+	///
+	/// @attention C99's equivalent binding is `bgfx_alloc_persistent`.
+	///
+	const Memory* alloc(
+		  uint32_t _size
+		, bool _persistent
+		);
+
 	/// Allocate buffer and copy data into it. Data will be freed inside bgfx.
 	///
 	/// @param[in] _data Pointer to data to be copied.
@@ -2121,6 +2224,22 @@ namespace bgfx
 		, uint32_t _size
 		);
 
+	/// Allocate buffer and copy data into it. Data will be freed inside bgfx.
+	///
+	/// @param[in] _data Pointer to data to be copied.
+	/// @param[in] _size Size of data to be copied.
+	/// @param[in] _persistent Memory is expected to be held for longer than
+	///   a few frames before it's passed to bgfx. When false, small blocks are
+	///   allocated from internal linear arena.
+	///
+	/// @attention C99's equivalent binding is `bgfx_copy_persistent`.
+	///
+	const Memory* copy(
+		  const void* _data
+		, uint32_t _size
+		, bool _persistent
+		);
+
 	/// Make reference to data to pass to bgfx. Unlike `bgfx::alloc`, this call
 	/// doesn't allocate memory for data. It just copies the _data pointer. You
 	/// can pass `ReleaseFn` function pointer to release this memory after it's
@@ -2678,6 +2797,60 @@ namespace bgfx
 		, bool _destroyShader = false
 		);
 
+	/// Create program with vertex and fragment shaders, and specialization
+	/// constant values.
+	///
+	/// @param[in] _vsh Vertex shader.
+	/// @param[in] _fsh Fragment shader.
+	/// @param[in] _num Number of specialization constants.
+	/// @param[in] _constants Specialization constant values. Constants not
+	///   listed keep default value declared in shader.
+	/// @param[in] _destroyShaders If true, shaders will be destroyed when
+	///   program is destroyed.
+	/// @returns Program handle if vertex shader output and fragment shader
+	///   input are matching, otherwise returns invalid program handle.
+	///
+	/// @remarks
+	///   Constants are declared in shader with `SPECIALIZATION_CONSTANT(id,
+	///   type, name, default)` from `bgfx_shader.sh`. Only Vulkan renderer
+	///   specializes shaders, on other renderers macro declares regular
+	///   constant and values are ignored. Constant ids must be unique.
+	///
+	/// @attention C99's equivalent binding is `bgfx_create_program_specialized`.
+	///
+	ProgramHandle createProgram(
+		  ShaderHandle _vsh
+		, ShaderHandle _fsh
+		, uint8_t _num
+		, const SpecializationConstant* _constants
+		, bool _destroyShaders = false
+		);
+
+	/// Create program with compute shader, and specialization constant values.
+	///
+	/// @param[in] _csh Compute shader.
+	/// @param[in] _num Number of specialization constants.
+	/// @param[in] _constants Specialization constant values. Constants not
+	///   listed keep default value declared in shader.
+	/// @param[in] _destroyShader If true, shader will be destroyed when
+	///   program is destroyed.
+	/// @returns Program handle.
+	///
+	/// @remarks
+	///   Constants are declared in shader with `SPECIALIZATION_CONSTANT(id,
+	///   type, name, default)` from `bgfx_shader.sh`. Only Vulkan renderer
+	///   specializes shaders, on other renderers macro declares regular
+	///   constant and values are ignored. Constant ids must be unique.
+	///
+	/// @attention C99's equivalent binding is `bgfx_create_compute_program_specialized`.
+	///
+	ProgramHandle createProgram(
+		  ShaderHandle _csh
+		, uint8_t _num
+		, const SpecializationConstant* _constants
+		, bool _destroyShader = false
+		);
+
 	/// Destroy program.
 	///
 	/// @param[in] _handle Program handle.
@@ -2686,6 +2859,37 @@ namespace bgfx
 	///
 	void destroy(ProgramHandle _handle);
 
+	/// Compile pipeline state permutations for program ahead of first use, to
+	/// avoid hitches when draw call needs pipeline state that wasn't created yet.
+	/// Permutations are all combinations of passed states, vertex layouts and
+	/// frame buffers.
+	///
+	/// @param[in] _handle Program handle.
+	/// @param[in] _numStates Number of render states.
+	/// @param[in] _states Render states. See: `BGFX_STATE_*`.
+	/// @param[in] _numLayouts Number of vertex layouts. When 0, pipelines are
+	///   compiled without vertex streams.
+	/// @param[in] _layouts Vertex layouts.
+	/// @param[in] _numFrameBuffers Number of frame buffers. When 0, pipelines are
+	///   compiled for back buffer.
+	/// @param[in] _frameBuffers Frame buffer handles. Invalid handle means back buffer.
+	///
+	/// @remarks
+	///   Only Vulkan renderer compiles pipelines on worker threads, other
+	///   renderers ignore this call.
+	///
+	/// @attention C99's equivalent binding is `bgfx_precache_pipelines`.
+	///
+	void precachePipelines(
+		  ProgramHandle _handle
+		, uint16_t _numStates
+		, const uint64_t* _states
+		, uint16_t _numLayouts
+		, const VertexLayout* _layouts
+		, uint16_t _numFrameBuffers = 0
+		, const FrameBufferHandle* _frameBuffers = NULL
+		);
+
 	/// Validate texture parameters.
 	///
 	/// @param[in] _depth Depth dimension of volume texture.
@@ -3004,6 +3208,69 @@ namespace bgfx
 		, uint8_t _mip = 0
 		);
 
+	/// Set upload priority of texture updates.
+	///
+	/// @param[in] _handle Texture handle.
+	/// @param[in] _priority Upload priority. See: `UploadPriority::Enum`.
+	///
+	/// @remarks
+	///   Priority is used only when `Init::Limits::uploadBudget` is not 0. Updates
+	///   already waiting in upload queue are moved to new priority.
+	///
+	/// @attention C99's equivalent binding is `bgfx_set_upload_priority`.
+	///
+	void setUploadPriority(
+		  TextureHandle _handle
+		, UploadPriority::Enum _priority
+		);
+
+	/// Returns frame number when all texture updates issued so far will be
+	/// executed by renderer.
+	///
+	/// @param[in] _handle Texture handle.
+	///
+	/// @returns Frame number when updates will be executed. See: `bgfx::frame`.
+	///   `UINT32_MAX` is returned while updates are waiting in upload queue.
+	///
+	/// @attention C99's equivalent binding is `bgfx_get_upload_frame`.
+	///
+	uint32_t getUploadFrame(TextureHandle _handle);
+
+	/// Set lowest mip level of texture that renderer is allowed to sample from.
+	///
+	/// @param[in] _handle Texture handle.
+	/// @param[in] _minMip Most detailed resident mip level. Mip levels above it
+	///   (more detailed) are not sampled, and can be streamed in later with
+	///   `bgfx::updateTexture*`, or ignored by application under memory pressure.
+	///   0 makes whole mip chain resident.
+	///
+	/// @remarks
+	///   Implemented as min LOD clamp in renderer's sampler or view state, texture
+	///   storage is not reallocated and handle stays valid.
+	///
+	/// @attention C99's equivalent binding is `bgfx_set_texture_resident_mips`.
+	///
+	void setTextureResidentMips(
+		  TextureHandle _handle
+		, uint8_t _minMip
+		);
+
+	/// Returns texture streaming feedback.
+	///
+	/// @param[in] _handle Texture handle.
+	/// @param[out] _minMip Most detailed resident mip level, set with
+	///   `bgfx::setTextureResidentMips`. Can be NULL.
+	///
+	/// @returns Last frame number in which texture was bound for sampling with
+	///   `bgfx::setTexture`, or 0 if it was never bound. See: `bgfx::frame`.
+	///
+	/// @attention C99's equivalent binding is `bgfx_get_texture_used_frame`.
+	///
+	uint32_t getTextureUsedFrame(
+		  TextureHandle _handle
+		, uint8_t* _minMip = NULL
+		);
+
 	/// Set texture debug name.
 	///
 	/// @param[in] _handle Texture handle.
@@ -3089,6 +3356,38 @@ namespace bgfx
 		, uint64_t _textureFlags = BGFX_SAMPLER_U_CLAMP|BGFX_SAMPLER_V_CLAMP
 		);
 
+	/// Allocate transient frame buffer. Frame buffer is valid only for current
+	/// frame, and only inside views from `_firstView` to `_lastView`.
+	///
+	/// @param[in] _width Texture width.
+	/// @param[in] _height Texture height.
+	/// @param[in] _format Texture format. See: `TextureFormat::Enum`.
+	/// @param[in] _firstView First view in which frame buffer is written or sampled.
+	/// @param[in] _lastView Last view in which frame buffer is written or sampled.
+	/// @param[in] _textureFlags Texture creation (see `BGFX_TEXTURE_*`.), and sampler
+	///   (see `BGFX_SAMPLER_*`) flags.
+	///
+	/// @returns Handle to frame buffer object.
+	///
+	/// @remarks
+	///   Transient frame buffers with same size, format and flags, whose view lifetimes
+	///   don't overlap, share the same render target. Content doesn't persist between
+	///   lifetimes. Lifetime is in view execution order, with `bgfx::setViewOrder`
+	///   remapping applied, so view order must be set before allocation.
+	///
+	/// @attention Handle must not be destroyed, render targets are released once not
+	///   allocated for `BGFX_CONFIG_TRANSIENT_FRAME_BUFFER_MAX_AGE` frames.
+	/// @attention C99's equivalent binding is `bgfx_alloc_transient_frame_buffer`.
+	///
+	FrameBufferHandle allocTransientFrameBuffer(
+		  uint16_t _width
+		, uint16_t _height
+		, TextureFormat::Enum _format
+		, ViewId _firstView
+		, ViewId _lastView
+		, uint64_t _textureFlags = BGFX_SAMPLER_U_CLAMP|BGFX_SAMPLER_V_CLAMP
+		);
+
 	/// Create MRT frame buffer from texture handles (simple).
 	///
 	/// @param[in] _num Number of texture attachments.
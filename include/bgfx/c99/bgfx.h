@@ -391,6 +391,20 @@ typedef enum bgfx_view_mode
 
 } bgfx_view_mode_t;
 
+/**
+ * Upload priority sets order in which deferred texture updates are issued.
+ *
+ */
+typedef enum bgfx_upload_priority
+{
+    BGFX_UPLOAD_PRIORITY_LOW,                 /** ( 0) Issued after all other updates. */
+    BGFX_UPLOAD_PRIORITY_NORMAL,              /** ( 1) Default priority.              */
+    BGFX_UPLOAD_PRIORITY_HIGH,                /** ( 2) Issued before all other updates. */
+
+    BGFX_UPLOAD_PRIORITY_COUNT
+
+} bgfx_upload_priority_t;
+
 /**
  * Render frame enum.
  *
@@ -652,6 +666,7 @@ typedef struct bgfx_init_limits_s
     uint32_t             minResourceCbSize;  /** Minimum resource command buffer size.    */
     uint32_t             transientVbSize;    /** Maximum transient vertex buffer size.    */
     uint32_t             transientIbSize;    /** Maximum transient index buffer size.     */
+    uint32_t             uploadBudget;       /** Maximum size of texture updates issued per frame (0 - unlimited). Dynamic buffer updates are never deferred. */
 
 } bgfx_init_limits_t;
 
@@ -694,6 +709,24 @@ typedef struct bgfx_init_s
     bgfx_resolution_t    resolution;         /** Backbuffer resolution and reset parameters. See: `bgfx::Resolution`. */
     bgfx_init_limits_t   limits;             /** Configurable runtime limits parameters.  */
     
+    /**
+     * Time in microseconds API and render threads spin waiting for each other
+     * at frame handoff before blocking on semaphore (0 - block immediately).
+     */
+    uint32_t             handoffSpin;
+    
+    /**
+     * Render thread CPU affinity mask (0 - default). Applies only to render
+     * thread created by bgfx.
+     */
+    uint64_t             renderThreadAffinity;
+    
+    /**
+     * Render thread priority, from -2 (lowest) to 2 (highest) (0 - default).
+     * Applies only to render thread created by bgfx.
+     */
+    int8_t               renderThreadPriority;
+    
     /**
      * Provide application specific callback interface.
      * See: `bgfx::CallbackI`
@@ -821,6 +854,17 @@ typedef struct bgfx_transform_s
 
 } bgfx_transform_t;
 
+/**
+ * Specialization constant value.
+ *
+ */
+typedef struct bgfx_specialization_constant_s
+{
+    uint32_t             id;                 /** Constant id, matches id declared with `SPECIALIZATION_CONSTANT` in shader. */
+    uint32_t             value;              /** Raw 32-bit value (bool, int, uint, or float bits). */
+
+} bgfx_specialization_constant_t;
+
 /**
  * View stats.
  *
@@ -896,6 +940,28 @@ typedef struct bgfx_stats_s
     bgfx_view_stats_t*   viewStats;          /** Array of View stats.                     */
     uint8_t              numEncoders;        /** Number of encoders used during frame.    */
     bgfx_encoder_stats_t* encoderStats;      /** Array of encoder stats.                  */
+    uint32_t             numUploadsPending;  /** Number of updates waiting in upload queue. */
+    uint32_t             uploadQueueSize;    /** Size of updates waiting in upload queue. */
+    uint32_t             numTransientFrameBuffers; /** Number of frame buffers backing transient frame buffers. */
+    uint32_t             numTransientFrameBufferAllocs; /** Number of transient frame buffers allocated during frame. */
+    uint32_t             numRecycleHits;     /** Number of textures and frame buffers reused from recycle pool. */
+    uint32_t             numRecycleMisses;   /** Number of textures and frame buffers not found in recycle pool. */
+    uint32_t             numRecycled;        /** Number of textures and frame buffers waiting in recycle pool. */
+    uint32_t             numPipelinesCreated; /** Number of pipeline states created while submitting draw calls. */
+    uint32_t             numPipelinesPrecached; /** Number of pipeline states compiled by `bgfx::precachePipelines` that became ready. */
+    uint32_t             numGpuMemoryBlocks; /** Number of device memory blocks resources are sub-allocated from. */
+    uint32_t             numGpuMemoryAllocations; /** Number of resources sub-allocated from device memory blocks. */
+    uint32_t             numGpuMemoryDedicated; /** Number of resources with dedicated device memory allocation. */
+    int64_t              gpuMemoryAllocated; /** Amount of device memory allocated by renderer. */
+    int64_t              gpuMemoryBound;     /** Amount of allocated device memory bound to resources. */
+    uint32_t             numBarriers;        /** Number of pipeline barriers recorded during frame. */
+    uint32_t             numImageBarriers;   /** Number of image layout transitions recorded during frame. */
+    int64_t              shaderCompileTime;  /** Render thread CPU time spent compiling shaders and linking programs. */
+    uint32_t             numProgramsCompiling; /** Number of programs driver is still compiling in background. */
+    uint32_t             numStateCallsIssued; /** Number of state-setting graphics API calls issued during frame. */
+    uint32_t             numStateCallsElided; /** Number of redundant state-setting graphics API calls elided during frame. */
+    int64_t              handoffSubmit;      /** Latency between API thread handing over frame and render thread waking up. */
+    int64_t              handoffRender;      /** Latency between render thread finishing frame and API thread waking up. */
 
 } bgfx_stats_t;
 
@@ -1171,6 +1237,20 @@ BGFX_C_API void bgfx_reset(uint32_t _width, uint32_t _height, uint32_t _flags, b
  */
 BGFX_C_API uint32_t bgfx_frame(bool _capture);
 
+/**
+ * Returns number of last frame which GPU finished executing. Frame
+ * numbers are the ones returned by `bgfx::frame`. Per-frame data
+ * owned outside the library, and referenced by that frame or any
+ * frame before it, can be reused.
+ * @remarks
+ *   Renderers that don't track GPU completion return an estimate,
+ *   last rendered frame number minus `BGFX_CONFIG_MAX_FRAME_LATENCY`.
+ *   Estimate is not guaranteed, since it assumes GPU never falls more
+ *   than maximum frame latency behind.
+ *
+ */
+BGFX_C_API uint32_t bgfx_get_gpu_completed_frame(void);
+
 /**
  * Returns current renderer backend API type.
  * @remarks
@@ -1204,6 +1284,19 @@ BGFX_C_API const bgfx_stats_t* bgfx_get_stats(void);
  */
 BGFX_C_API const bgfx_memory_t* bgfx_alloc(uint32_t _size);
 
+/**
+ * Allocate buffer to pass to bgfx calls. Data will be freed inside bgfx.
+ *
+ * @param[in] _size Size to allocate.
+ * @param[in] _persistent Memory is expected to be held for longer than
+ *  a few frames before it's passed to bgfx. When false, small blocks are
+ *  allocated from internal linear arena.
+ *
+ * @returns Allocated memory.
+ *
+ */
+BGFX_C_API const bgfx_memory_t* bgfx_alloc_persistent(uint32_t _size, bool _persistent);
+
 /**
  * Allocate buffer and copy data into it. Data will be freed inside bgfx.
  *
@@ -1215,6 +1308,20 @@ BGFX_C_API const bgfx_memory_t* bgfx_alloc(uint32_t _size);
  */
 BGFX_C_API const bgfx_memory_t* bgfx_copy(const void* _data, uint32_t _size);
 
+/**
+ * Allocate buffer and copy data into it. Data will be freed inside bgfx.
+ *
+ * @param[in] _data Pointer to data to be copied.
+ * @param[in] _size Size of data to be copied.
+ * @param[in] _persistent Memory is expected to be held for longer than
+ *  a few frames before it's passed to bgfx. When false, small blocks are
+ *  allocated from internal linear arena.
+ *
+ * @returns Allocated memory.
+ *
+ */
+BGFX_C_API const bgfx_memory_t* bgfx_copy_persistent(const void* _data, uint32_t _size, bool _persistent);
+
 /**
  * Make reference to data to pass to bgfx. Unlike `bgfx::alloc`, this call
  * doesn't allocate memory for data. It just copies the _data pointer. You
@@ -1711,6 +1818,47 @@ BGFX_C_API bgfx_program_handle_t bgfx_create_program(bgfx_shader_handle_t _vsh,
  */
 BGFX_C_API bgfx_program_handle_t bgfx_create_compute_program(bgfx_shader_handle_t _csh, bool _destroyShaders);
 
+/**
+ * Create program with vertex and fragment shaders, and specialization
+ * constant values.
+ * @remarks
+ *   Constants are declared in shader with `SPECIALIZATION_CONSTANT(id,
+ *   type, name, default)` from `bgfx_shader.sh`. Only Vulkan renderer
+ *   specializes shaders, on other renderers macro declares regular
+ *   constant and values are ignored. Constant ids must be unique.
+ *
+ * @param[in] _vsh Vertex shader.
+ * @param[in] _fsh Fragment shader.
+ * @param[in] _num Number of specialization constants.
+ * @param[in] _constants Specialization constant values. Constants not
+ *  listed keep default value declared in shader.
+ * @param[in] _destroyShaders If true, shaders will be destroyed when program is destroyed.
+ *
+ * @returns Program handle if vertex shader output and fragment shader
+ *  input are matching, otherwise returns invalid program handle.
+ *
+ */
+BGFX_C_API bgfx_program_handle_t bgfx_create_program_specialized(bgfx_shader_handle_t _vsh, bgfx_shader_handle_t _fsh, uint8_t _num, const bgfx_specialization_constant_t* _constants, bool _destroyShaders);
+
+/**
+ * Create program with compute shader, and specialization constant values.
+ * @remarks
+ *   Constants are declared in shader with `SPECIALIZATION_CONSTANT(id,
+ *   type, name, default)` from `bgfx_shader.sh`. Only Vulkan renderer
+ *   specializes shaders, on other renderers macro declares regular
+ *   constant and values are ignored. Constant ids must be unique.
+ *
+ * @param[in] _csh Compute shader.
+ * @param[in] _num Number of specialization constants.
+ * @param[in] _constants Specialization constant values. Constants not
+ *  listed keep default value declared in shader.
+ * @param[in] _destroyShaders If true, shaders will be destroyed when program is destroyed.
+ *
+ * @returns Program handle.
+ *
+ */
+BGFX_C_API bgfx_program_handle_t bgfx_create_compute_program_specialized(bgfx_shader_handle_t _csh, uint8_t _num, const bgfx_specialization_constant_t* _constants, bool _destroyShaders);
+
 /**
  * Destroy program.
  *
@@ -1719,6 +1867,28 @@ BGFX_C_API bgfx_program_handle_t bgfx_create_compute_program(bgfx_shader_handle_
  */
 BGFX_C_API void bgfx_destroy_program(bgfx_program_handle_t _handle);
 
+/**
+ * Compile pipeline state permutations for program ahead of first use, to
+ * avoid hitches when draw call needs pipeline state that wasn't created yet.
+ * Permutations are all combinations of passed states, vertex layouts and
+ * frame buffers.
+ * @remarks
+ *   Only Vulkan renderer compiles pipelines on worker threads, other
+ *   renderers ignore this call.
+ *
+ * @param[in] _handle Program handle.
+ * @param[in] _numStates Number of render states.
+ * @param[in] _states Render states. See: `BGFX_STATE_*`.
+ * @param[in] _numLayouts Number of vertex layouts. When 0, pipelines are
+ *  compiled without vertex streams.
+ * @param[in] _layouts Vertex layouts.
+ * @param[in] _numFrameBuffers Number of frame buffers. When 0, pipelines are
+ *  compiled for back buffer.
+ * @param[in] _frameBuffers Frame buffer handles. Invalid handle means back buffer.
+ *
+ */
+BGFX_C_API void bgfx_precache_pipelines(bgfx_program_handle_t _handle, uint16_t _numStates, const uint64_t* _states, uint16_t _numLayouts, const bgfx_vertex_layout_t* _layouts, uint16_t _numFrameBuffers, const bgfx_frame_buffer_handle_t* _frameBuffers);
+
 /**
  * Validate texture parameters.
  *
@@ -1953,6 +2123,58 @@ BGFX_C_API void bgfx_update_texture_cube(bgfx_texture_handle_t _handle, uint16_t
  */
 BGFX_C_API uint32_t bgfx_read_texture(bgfx_texture_handle_t _handle, void* _data, uint8_t _mip);
 
+/**
+ * Set upload priority of texture updates.
+ * @remarks
+ *   Priority is used only when `Init::Limits::uploadBudget` is not 0. Updates
+ *   already waiting in upload queue are moved to new priority.
+ *
+ * @param[in] _handle Texture handle.
+ * @param[in] _priority Upload priority. See: `UploadPriority::Enum`.
+ *
+ */
+BGFX_C_API void bgfx_set_upload_priority(bgfx_texture_handle_t _handle, bgfx_upload_priority_t _priority);
+
+/**
+ * Returns frame number when all texture updates issued so far will be
+ * executed by renderer.
+ *
+ * @param[in] _handle Texture handle.
+ *
+ * @returns Frame number when updates will be executed. See: `bgfx::frame`.
+ *  `UINT32_MAX` is returned while updates are waiting in upload queue.
+ *
+ */
+BGFX_C_API uint32_t bgfx_get_upload_frame(bgfx_texture_handle_t _handle);
+
+/**
+ * Set lowest mip level of texture that renderer is allowed to sample from.
+ * @remarks
+ *   Implemented as min LOD clamp in renderer's sampler or view state, texture
+ *   storage is not reallocated and handle stays valid.
+ *
+ * @param[in] _handle Texture handle.
+ * @param[in] _minMip Most detailed resident mip level. Mip levels above it
+ *  (more detailed) are not sampled, and can be streamed in later with
+ *  `bgfx::updateTexture*`, or ignored by application under memory pressure.
+ *  0 makes whole mip chain resident.
+ *
+ */
+BGFX_C_API void bgfx_set_texture_resident_mips(bgfx_texture_handle_t _handle, uint8_t _minMip);
+
+/**
+ * Returns texture streaming feedback.
+ *
+ * @param[in] _handle Texture handle.
+ * @param[out] _minMip Most detailed resident mip level, set with
+ *  `bgfx::setTextureResidentMips`. Can be NULL.
+ *
+ * @returns Last frame number in which texture was bound for sampling with
+ *  `bgfx::setTexture`, or 0 if it was never bound. See: `bgfx::frame`.
+ *
+ */
+BGFX_C_API uint32_t bgfx_get_texture_used_frame(bgfx_texture_handle_t _handle, uint8_t* _minMip);
+
 /**
  * Set texture debug name.
  *
@@ -2024,6 +2246,30 @@ BGFX_C_API bgfx_frame_buffer_handle_t bgfx_create_frame_buffer(uint16_t _width,
  */
 BGFX_C_API bgfx_frame_buffer_handle_t bgfx_create_frame_buffer_scaled(bgfx_backbuffer_ratio_t _ratio, bgfx_texture_format_t _format, uint64_t _textureFlags);
 
+/**
+ * Allocate transient frame buffer. Frame buffer is valid only for current
+ * frame, and only inside views from `_firstView` to `_lastView`.
+ * @remarks
+ *   Transient frame buffers with same size, format and flags, whose view lifetimes
+ *   don't overlap, share the same render target. Content doesn't persist between
+ *   lifetimes. Lifetime is in view execution order, with `bgfx::setViewOrder`
+ *   remapping applied, so view order must be set before allocation.
+ * @attention Handle must not be destroyed, render targets are released once not
+ *   allocated for `BGFX_CONFIG_TRANSIENT_FRAME_BUFFER_MAX_AGE` frames.
+ *
+ * @param[in] _width Texture width.
+ * @param[in] _height Texture height.
+ * @param[in] _format Texture format. See: `TextureFormat::Enum`.
+ * @param[in] _firstView First view in which frame buffer is written or sampled.
+ * @param[in] _lastView Last view in which frame buffer is written or sampled.
+ * @param[in] _textureFlags Texture creation (see `BGFX_TEXTURE_*`.), and sampler (see `BGFX_SAMPLER_*`)
+ *  flags.
+ *
+ * @returns Frame buffer handle.
+ *
+ */
+BGFX_C_API bgfx_frame_buffer_handle_t bgfx_alloc_transient_frame_buffer(uint16_t _width, uint16_t _height, bgfx_texture_format_t _format, bgfx_view_id_t _firstView, bgfx_view_id_t _lastView, uint64_t _textureFlags);
+
 /**
  * Create MRT frame buffer from texture handles (simple).
  *
@@ -3436,11 +3682,14 @@ typedef enum bgfx_function_id
     BGFX_FUNCTION_ID_SHUTDOWN,
     BGFX_FUNCTION_ID_RESET,
     BGFX_FUNCTION_ID_FRAME,
+    BGFX_FUNCTION_ID_GET_GPU_COMPLETED_FRAME,
     BGFX_FUNCTION_ID_GET_RENDERER_TYPE,
     BGFX_FUNCTION_ID_GET_CAPS,
     BGFX_FUNCTION_ID_GET_STATS,
     BGFX_FUNCTION_ID_ALLOC,
+    BGFX_FUNCTION_ID_ALLOC_PERSISTENT,
     BGFX_FUNCTION_ID_COPY,
+    BGFX_FUNCTION_ID_COPY_PERSISTENT,
     BGFX_FUNCTION_ID_MAKE_REF,
     BGFX_FUNCTION_ID_MAKE_REF_RELEASE,
     BGFX_FUNCTION_ID_SET_DEBUG,
@@ -3479,7 +3728,10 @@ typedef enum bgfx_function_id
     BGFX_FUNCTION_ID_DESTROY_SHADER,
     BGFX_FUNCTION_ID_CREATE_PROGRAM,
     BGFX_FUNCTION_ID_CREATE_COMPUTE_PROGRAM,
+    BGFX_FUNCTION_ID_CREATE_PROGRAM_SPECIALIZED,
+    BGFX_FUNCTION_ID_CREATE_COMPUTE_PROGRAM_SPECIALIZED,
     BGFX_FUNCTION_ID_DESTROY_PROGRAM,
+    BGFX_FUNCTION_ID_PRECACHE_PIPELINES,
     BGFX_FUNCTION_ID_IS_TEXTURE_VALID,
     BGFX_FUNCTION_ID_IS_FRAME_BUFFER_VALID,
     BGFX_FUNCTION_ID_CALC_TEXTURE_SIZE,
@@ -3492,11 +3744,16 @@ typedef enum bgfx_function_id
     BGFX_FUNCTION_ID_UPDATE_TEXTURE_3D,
     BGFX_FUNCTION_ID_UPDATE_TEXTURE_CUBE,
     BGFX_FUNCTION_ID_READ_TEXTURE,
+    BGFX_FUNCTION_ID_SET_UPLOAD_PRIORITY,
+    BGFX_FUNCTION_ID_GET_UPLOAD_FRAME,
+    BGFX_FUNCTION_ID_SET_TEXTURE_RESIDENT_MIPS,
+    BGFX_FUNCTION_ID_GET_TEXTURE_USED_FRAME,
     BGFX_FUNCTION_ID_SET_TEXTURE_NAME,
     BGFX_FUNCTION_ID_GET_DIRECT_ACCESS_PTR,
     BGFX_FUNCTION_ID_DESTROY_TEXTURE,
     BGFX_FUNCTION_ID_CREATE_FRAME_BUFFER,
     BGFX_FUNCTION_ID_CREATE_FRAME_BUFFER_SCALED,
+    BGFX_FUNCTION_ID_ALLOC_TRANSIENT_FRAME_BUFFER,
     BGFX_FUNCTION_ID_CREATE_FRAME_BUFFER_FROM_HANDLES,
     BGFX_FUNCTION_ID_CREATE_FRAME_BUFFER_FROM_ATTACHMENT,
     BGFX_FUNCTION_ID_CREATE_FRAME_BUFFER_FROM_NWH,
@@ -3638,11 +3895,14 @@ struct bgfx_interface_vtbl
     void (*shutdown)(void);
     void (*reset)(uint32_t _width, uint32_t _height, uint32_t _flags, bgfx_texture_format_t _format);
     uint32_t (*frame)(bool _capture);
+    uint32_t (*get_gpu_completed_frame)(void);
     bgfx_renderer_type_t (*get_renderer_type)(void);
     const bgfx_caps_t* (*get_caps)(void);
     const bgfx_stats_t* (*get_stats)(void);
     const bgfx_memory_t* (*alloc)(uint32_t _size);
+    const bgfx_memory_t* (*alloc_persistent)(uint32_t _size, bool _persistent);
     const bgfx_memory_t* (*copy)(const void* _data, uint32_t _size);
+    const bgfx_memory_t* (*copy_persistent)(const void* _data, uint32_t _size, bool _persistent);
     const bgfx_memory_t* (*make_ref)(const void* _data, uint32_t _size);
     const bgfx_memory_t* (*make_ref_release)(const void* _data, uint32_t _size, bgfx_release_fn_t _releaseFn, void* _userData);
     void (*set_debug)(uint32_t _debug);
@@ -3681,7 +3941,10 @@ struct bgfx_interface_vtbl
     void (*destroy_shader)(bgfx_shader_handle_t _handle);
     bgfx_program_handle_t (*create_program)(bgfx_shader_handle_t _vsh, bgfx_shader_handle_t _fsh, bool _destroyShaders);
     bgfx_program_handle_t (*create_compute_program)(bgfx_shader_handle_t _csh, bool _destroyShaders);
+    bgfx_program_handle_t (*create_program_specialized)(bgfx_shader_handle_t _vsh, bgfx_shader_handle_t _fsh, uint8_t _num, const bgfx_specialization_constant_t* _constants, bool _destroyShaders);
+    bgfx_program_handle_t (*create_compute_program_specialized)(bgfx_shader_handle_t _csh, uint8_t _num, const bgfx_specialization_constant_t* _constants, bool _destroyShaders);
     void (*destroy_program)(bgfx_program_handle_t _handle);
+    void (*precache_pipelines)(bgfx_program_handle_t _handle, uint16_t _numStates, const uint64_t* _states, uint16_t _numLayouts, const bgfx_vertex_layout_t* _layouts, uint16_t _numFrameBuffers, const bgfx_frame_buffer_handle_t* _frameBuffers);
     bool (*is_texture_valid)(uint16_t _depth, bool _cubeMap, uint16_t _numLayers, bgfx_texture_format_t _format, uint64_t _flags);
     bool (*is_frame_buffer_valid)(uint8_t _num, const bgfx_attachment_t* _attachment);
     void (*calc_texture_size)(bgfx_texture_info_t * _info, uint16_t _width, uint16_t _height, uint16_t _depth, bool _cubeMap, bool _hasMips, uint16_t _numLayers, bgfx_texture_format_t _format);
@@ -3694,11 +3957,16 @@ struct bgfx_interface_vtbl
     void (*update_texture_3d)(bgfx_texture_handle_t _handle, uint8_t _mip, uint16_t _x, uint16_t _y, uint16_t _z, uint16_t _width, uint16_t _height, uint16_t _depth, const bgfx_memory_t* _mem);
     void (*update_texture_cube)(bgfx_texture_handle_t _handle, uint16_t _layer, uint8_t _side, uint8_t _mip, uint16_t _x, uint16_t _y, uint16_t _width, uint16_t _height, const bgfx_memory_t* _mem, uint16_t _pitch);
     uint32_t (*read_texture)(bgfx_texture_handle_t _handle, void* _data, uint8_t _mip);
+    void (*set_upload_priority)(bgfx_texture_handle_t _handle, bgfx_upload_priority_t _priority);
+    uint32_t (*get_upload_frame)(bgfx_texture_handle_t _handle);
+    void (*set_texture_resident_mips)(bgfx_texture_handle_t _handle, uint8_t _minMip);
+    uint32_t (*get_texture_used_frame)(bgfx_texture_handle_t _handle, uint8_t* _minMip);
     void (*set_texture_name)(bgfx_texture_handle_t _handle, const char* _name, int32_t _len);
     void* (*get_direct_access_ptr)(bgfx_texture_handle_t _handle);
     void (*destroy_texture)(bgfx_texture_handle_t _handle);
     bgfx_frame_buffer_handle_t (*create_frame_buffer)(uint16_t _width, uint16_t _height, bgfx_texture_format_t _format, uint64_t _textureFlags);
     bgfx_frame_buffer_handle_t (*create_frame_buffer_scaled)(bgfx_backbuffer_ratio_t _ratio, bgfx_texture_format_t _format, uint64_t _textureFlags);
+    bgfx_frame_buffer_handle_t (*alloc_transient_frame_buffer)(uint16_t _width, uint16_t _height, bgfx_texture_format_t _format, bgfx_view_id_t _firstView, bgfx_view_id_t _lastView, uint64_t _textureFlags);
     bgfx_frame_buffer_handle_t (*create_frame_buffer_from_handles)(uint8_t _num, const bgfx_texture_handle_t* _handles, bool _destroyTexture);
     bgfx_frame_buffer_handle_t (*create_frame_buffer_from_attachment)(uint8_t _num, const bgfx_attachment_t* _attachment, bool _destroyTexture);
     bgfx_frame_buffer_handle_t (*create_frame_buffer_from_nwh)(void* _nwh, uint16_t _width, uint16_t _height, bgfx_texture_format_t _format, bgfx_texture_format_t _depthFormat);
@@ -15,7 +15,7 @@
 #ifndef BGFX_DEFINES_H_HEADER_GUARD
 #define BGFX_DEFINES_H_HEADER_GUARD
 
-#define BGFX_API_VERSION UINT32_C(118)
+#define BGFX_API_VERSION UINT32_C(132)
 
 /**
  * Color RGB/alpha/depth write. When it's not specified write will be disabled.
@@ -0,0 +1,27 @@
+--
+-- Copyright 2010-2023 Branimir Karadzic. All rights reserved.
+-- License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+--
+
+project "bgfx.test"
+	uuid (os.uuid("bgfx.test"))
+	kind "ConsoleApp"
+
+	includedirs {
+		path.join(BGFX_DIR, "include"),
+		path.join(BGFX_DIR, "src"),
+	}
+
+	files {
+		path.join(BGFX_DIR, "tests/**.cpp"),
+		path.join(BGFX_DIR, "tests/**.h"),
+	}
+
+	using_bx()
+
+	configuration { "osx* or linux*" }
+		links {
+			"pthread",
+		}
+
+	configuration {}
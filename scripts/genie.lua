@@ -50,6 +50,11 @@ newoption {
 	description = "Enable building examples.",
 }
 
+newoption {
+	trigger = "with-tests",
+	description = "Enable building tests.",
+}
+
 newoption {
 	trigger = "with-webgpu",
 	description = "Enable webgpu experimental renderer.",
@@ -594,6 +599,7 @@ or _OPTIONS["with-combined-examples"] then
 		, "47-pixelformats"
 		, "48-drawindirect"
 		, "49-hextile"
+		, "50-pipelinecache"
 		)
 
 	-- 17-drawstress requires multithreading, does not compile for singlethreaded wasm
@@ -615,3 +621,8 @@ if _OPTIONS["with-tools"] then
 	dofile "geometryc.lua"
 	dofile "geometryv.lua"
 end
+
+if _OPTIONS["with-tests"] then
+	group "tests"
+	dofile "bgfx.test.lua"
+end
@@ -21,6 +21,16 @@
 #	include <windows.h>
 #endif // BX_PLATFORM_OSX
 
+#if BX_PLATFORM_LINUX || BX_PLATFORM_ANDROID
+#	include <sched.h>
+#	include <sys/resource.h>
+#	include <sys/syscall.h>
+#	include <unistd.h>
+#elif BX_PLATFORM_BSD || BX_PLATFORM_OSX || BX_PLATFORM_IOS
+#	include <pthread.h>
+#	include <sched.h>
+#endif // BX_PLATFORM_LINUX || BX_PLATFORM_ANDROID
+
 BX_ERROR_RESULT(BGFX_ERROR_TEXTURE_VALIDATION,      BX_MAKEFOURCC('b', 'g', 0, 1) );
 BX_ERROR_RESULT(BGFX_ERROR_FRAME_BUFFER_VALIDATION, BX_MAKEFOURCC('b', 'g', 0, 2) );
 BX_ERROR_RESULT(BGFX_ERROR_IDENTIFIER_VALIDATION,   BX_MAKEFOURCC('b', 'g', 0, 3) );
@@ -250,8 +260,243 @@ namespace bgfx
 #endif // BGFX_CONFIG_MEMORY_TRACKING
 	};
 
+	/// Linear allocator for short lived `Memory` blocks returned by `bgfx::alloc`
+	/// and `bgfx::copy`. Arena is split into chunks, allocation is pointer bump
+	/// inside current chunk, and chunk is reused once all blocks allocated from
+	/// it are released.
+	class MemoryArena
+	{
+	public:
+		MemoryArena()
+			: m_allocator(NULL)
+			, m_chunk(NULL)
+			, m_data(NULL)
+			, m_numChunks(0)
+			, m_chunkSize(0)
+			, m_current(0)
+			, m_shutdown(false)
+		{
+		}
+
+		void init(bx::AllocatorI* _allocator, uint32_t _numChunks, uint32_t _chunkSize)
+		{
+			bx::AllocatorI* allocator = NULL != _allocator
+				? _allocator
+				: &m_defaultAllocator
+				;
+
+			bx::MutexScope scope(m_mutex);
+
+			if (NULL != m_data)
+			{
+				// Arena from previous initialization still has live blocks. Keep using
+				// it when it's owned by the same allocator, otherwise leave it disabled
+				// until its last block is released.
+				m_shutdown = allocator != m_allocator;
+				return;
+			}
+
+			if (0 == _numChunks
+			||  0 == _chunkSize)
+			{
+				return;
+			}
+
+			m_allocator = allocator;
+			m_numChunks = _numChunks;
+			m_chunkSize = bx::alignUp(_chunkSize, kAlignment);
+			m_chunk     = (Chunk*)BX_ALLOC(m_allocator, m_numChunks*sizeof(Chunk) );
+			m_data      = (uint8_t*)BX_ALIGNED_ALLOC(m_allocator, m_numChunks*m_chunkSize, kAlignment);
+			m_current   = 0;
+			m_shutdown  = false;
+
+			for (uint32_t ii = 0; ii < m_numChunks; ++ii)
+			{
+				m_chunk[ii].m_state = 0;
+			}
+		}
+
+		void shutdown()
+		{
+			bx::MutexScope scope(m_mutex);
+
+			if (NULL == m_data)
+			{
+				return;
+			}
+
+			m_shutdown = true;
+
+			const uint32_t live = getNumLive();
+			BX_WARN(0 == live, "Memory arena: %d blocks are not released, arena is freed after last one is.", live);
+
+			if (0 == live)
+			{
+				release();
+			}
+		}
+
+		Memory* alloc(uint32_t _size)
+		{
+			if (NULL == m_data
+			||  m_shutdown
+			||  _size > BGFX_CONFIG_MEMORY_ARENA_MAX_ALLOC_SIZE)
+			{
+				return NULL;
+			}
+
+			const uint32_t size = bx::alignUp(uint32_t(sizeof(Memory) ) + _size, kAlignment);
+
+			for (uint32_t retry = 0; retry <= m_numChunks; ++retry)
+			{
+				const uint32_t idx = m_current;
+				Chunk& chunk = m_chunk[idx];
+
+				// Offset and live count are bumped together, so bump of stale chunk
+				// index can't race with nextChunk rewinding offset of the chunk.
+				for (uint64_t state = chunk.m_state;;)
+				{
+					const uint32_t offset = getOffset(state);
+
+					if (offset + size > m_chunkSize)
+					{
+						break;
+					}
+
+					const uint64_t prev = bx::atomicCompareAndSwap<uint64_t>(&chunk.m_state, state, state + (uint64_t(size)<<32) + 1);
+
+					if (prev == state)
+					{
+						Memory* mem = (Memory*)&m_data[idx*m_chunkSize + offset];
+						mem->data = (uint8_t*)mem + sizeof(Memory);
+						mem->size = _size;
+						return mem;
+					}
+
+					state = prev;
+				}
+
+				if (!nextChunk(idx) )
+				{
+					break;
+				}
+			}
+
+			return NULL;
+		}
+
+		bool free(const Memory* _mem)
+		{
+			const uint8_t* ptr = (const uint8_t*)_mem;
+			if (ptr <  m_data
+			||  ptr >= m_data + m_numChunks*m_chunkSize)
+			{
+				return false;
+			}
+
+			const uint32_t idx = uint32_t(ptr - m_data) / m_chunkSize;
+			bx::atomicFetchAndSub<uint64_t>(&m_chunk[idx].m_state, 1);
+
+			if (m_shutdown)
+			{
+				bx::MutexScope scope(m_mutex);
+
+				if (m_shutdown
+				&&  NULL != m_data
+				&&  0 == getNumLive() )
+				{
+					release();
+				}
+			}
+
+			return true;
+		}
+
+	private:
+		static uint32_t getOffset(uint64_t _state)
+		{
+			return uint32_t(_state>>32);
+		}
+
+		static uint32_t getLive(uint64_t _state)
+		{
+			return uint32_t(_state);
+		}
+
+		uint32_t getNumLive()
+		{
+			uint32_t live = 0;
+			for (uint32_t ii = 0; ii < m_numChunks; ++ii)
+			{
+				live += getLive(bx::atomicFetchAndAdd<uint64_t>(&m_chunk[ii].m_state, 0) );
+			}
+
+			return live;
+		}
+
+		void release()
+		{
+			BX_ALIGNED_FREE(m_allocator, m_data, kAlignment);
+			BX_FREE(m_allocator, m_chunk);
+
+			m_allocator = NULL;
+			m_chunk     = NULL;
+			m_data      = NULL;
+			m_numChunks = 0;
+			m_chunkSize = 0;
+		}
+
+		bool nextChunk(uint32_t _full)
+		{
+			bx::MutexScope scope(m_mutex);
+
+			if (_full != m_current)
+			{
+				// Other thread already moved on.
+				return true;
+			}
+
+			for (uint32_t ii = 1; ii < m_numChunks; ++ii)
+			{
+				const uint32_t idx = (_full + ii) % m_numChunks;
+				Chunk& chunk = m_chunk[idx];
+
+				const uint64_t state = bx::atomicFetchAndAdd<uint64_t>(&chunk.m_state, 0);
+
+				// Rewind only if no block is live, and nobody bumped the chunk since.
+				if (0 == getLive(state)
+				&&  state == bx::atomicCompareAndSwap<uint64_t>(&chunk.m_state, state, 0) )
+				{
+					bx::atomicCompareAndSwap<uint32_t>(&m_current, _full, idx);
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		static constexpr uint32_t kAlignment = 16;
+
+		struct Chunk
+		{
+			// Offset in upper 32 bits, number of live blocks in lower 32 bits.
+			uint64_t m_state;
+		};
+
+		bx::DefaultAllocator m_defaultAllocator;
+		bx::Mutex       m_mutex;
+		bx::AllocatorI* m_allocator;
+		Chunk*          m_chunk;
+		uint8_t*        m_data;
+		uint32_t        m_numChunks;
+		uint32_t        m_chunkSize;
+		uint32_t        m_current;
+		volatile bool   m_shutdown;
+	};
+
 	static CallbackStub*  s_callbackStub  = NULL;
 	static AllocatorStub* s_allocatorStub = NULL;
+	static MemoryArena    s_memoryArena;
 	static bool s_graphicsDebuggerPresent = false;
 
 	CallbackI* g_callback = NULL;
@@ -384,6 +629,7 @@ namespace bgfx
 		}
 
 		rci->overrideInternal(_handle, _ptr);
+		s_ctx->m_textureRef[_handle.idx].m_recyclable = false;
 
 		return rci->getInternal(_handle);
 	}
@@ -1893,6 +2139,7 @@ namespace bgfx
 		m_init.resolution.reset &= ~BGFX_RESET_INTERNAL_FORCE;
 		m_init.resolution.numBackBuffers  = bx::clamp<uint8_t>(_init.resolution.numBackBuffers, 2, BGFX_CONFIG_MAX_BACK_BUFFERS);
 		m_init.resolution.maxFrameLatency = bx::min<uint8_t>(_init.resolution.maxFrameLatency, BGFX_CONFIG_MAX_FRAME_LATENCY);
+		m_handoffSpin = int64_t(_init.handoffSpin) * bx::getHPFrequency() / 1000000;
 		dump(m_init.resolution);
 
 		if (true
@@ -2049,6 +2296,17 @@ namespace bgfx
 
 	void Context::shutdown()
 	{
+		for (uint32_t ii = 0, num = uint32_t(m_uploadQueue.size() ); ii < num; ++ii)
+		{
+			release(m_uploadQueue[ii].m_mem);
+		}
+
+		m_uploadQueue.clear();
+		m_uploadQueueSize = 0;
+
+		transientFrameBufferGc(true);
+		recyclePoolGc(true);
+
 		getCommandBuffer(CommandBuffer::RendererShutdownBegin);
 		frame();
 
@@ -2332,9 +2590,87 @@ namespace bgfx
 		apiSemPost();
 	}
 
+	void Context::uploadQueueFlush()
+	{
+		const uint32_t budget = m_init.limits.uploadBudget;
+		uint32_t size = 0;
+		bool done = false;
+
+		for (uint32_t priority = UploadPriority::Count; 0 < priority && !done; --priority)
+		{
+			for (uint32_t ii = 0, num = uint32_t(m_uploadQueue.size() ); ii < num; ++ii)
+			{
+				UploadItem& item = m_uploadQueue[ii];
+
+				if (priority-1 != item.m_priority
+				||  NULL == item.m_mem)
+				{
+					continue;
+				}
+
+				// Always let at least one update through, otherwise an update
+				// larger than budget would never be issued. Stop at first update
+				// that doesn't fit to preserve order of updates to same resource.
+				const uint32_t itemSize = item.m_mem->size;
+				if (0 != size
+				&&  size + itemSize > budget)
+				{
+					done = true;
+					break;
+				}
+
+				size += itemSize;
+
+				switch (item.m_type)
+				{
+				case UploadItem::Texture:
+					--m_textureRef[item.m_handle].m_numPendingUploads;
+					updateTexture(item);
+					break;
+
+				default:
+					BX_ASSERT(false, "Invalid upload item type %d.", item.m_type);
+					break;
+				}
+
+				item.m_mem = NULL;
+			}
+		}
+
+		uint32_t num = 0;
+		for (uint32_t ii = 0, numItems = uint32_t(m_uploadQueue.size() ); ii < numItems; ++ii)
+		{
+			if (NULL != m_uploadQueue[ii].m_mem)
+			{
+				m_uploadQueue[num++] = m_uploadQueue[ii];
+			}
+		}
+
+		m_uploadQueue.resize(num);
+		m_uploadQueueSize -= size;
+	}
+
 	void Context::swap()
 	{
 		freeDynamicBuffers();
+
+		if (!m_uploadQueue.empty() )
+		{
+			BGFX_PROFILER_SCOPE("bgfx/Upload queue flush", 0xff2040ff);
+			uploadQueueFlush();
+		}
+
+		if (!m_transientFrameBuffers.empty() )
+		{
+			transientFrameBufferGc(false);
+		}
+
+		if (!m_texturePool.empty()
+		||  !m_frameBufferPool.empty() )
+		{
+			recyclePoolGc(false);
+		}
+
 		m_submit->m_resolution = m_init.resolution;
 		m_init.resolution.reset &= ~BGFX_RESET_INTERNAL_FORCE;
 		m_submit->m_debug = m_debug;
@@ -2378,6 +2714,9 @@ namespace bgfx
 		int64_t now = bx::getHPCounter();
 		m_submit->m_perfStats.cpuTimeFrame = now - m_frameTimeLast;
 		m_frameTimeLast = now;
+
+		m_submit->m_perfStats.numTransientFrameBufferAllocs = m_numTransientFrameBufferAllocs;
+		m_numTransientFrameBufferAllocs = 0;
 	}
 
 	///
@@ -2456,6 +2795,17 @@ namespace bgfx
 					m_flipped = false;
 				}
 
+				uint32_t gpuCompletedFrame;
+				if (!m_renderCtx->getGpuCompletedFrame(gpuCompletedFrame) )
+				{
+					gpuCompletedFrame = m_render->m_frameNum >= BGFX_CONFIG_MAX_FRAME_LATENCY
+						? m_render->m_frameNum - BGFX_CONFIG_MAX_FRAME_LATENCY
+						: UINT32_MAX
+						;
+				}
+
+				bx::atomicExchange<uint32_t>(&m_gpuCompletedFrame, gpuCompletedFrame);
+
 				{
 					BGFX_PROFILER_SCOPE("bgfx/Screenshot", 0xff2040ff);
 					for (uint8_t ii = 0, num = m_render->m_numScreenShots; ii < num; ++ii)
@@ -2490,6 +2840,73 @@ namespace bgfx
 			;
 	}
 
+	void setThreadScheduling(uint64_t _affinityMask, int8_t _priority)
+	{
+		if (0 != _affinityMask)
+		{
+#if BX_PLATFORM_WINDOWS
+			if (0 == SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(_affinityMask) ) )
+			{
+				BX_TRACE("Failed to set thread affinity mask 0x%016" PRIx64 ".", _affinityMask);
+			}
+#elif BX_PLATFORM_LINUX || BX_PLATFORM_ANDROID
+			cpu_set_t cpuSet;
+			CPU_ZERO(&cpuSet);
+
+			for (uint32_t ii = 0; ii < 64 && ii < CPU_SETSIZE; ++ii)
+			{
+				if (0 != (_affinityMask & (UINT64_C(1)<<ii) ) )
+				{
+					CPU_SET(ii, &cpuSet);
+				}
+			}
+
+			if (0 != sched_setaffinity(pid_t(syscall(SYS_gettid) ), sizeof(cpuSet), &cpuSet) )
+			{
+				BX_TRACE("Failed to set thread affinity mask 0x%016" PRIx64 ".", _affinityMask);
+			}
+#else
+			BX_TRACE("Thread affinity is not supported on this platform.");
+#endif // BX_PLATFORM_*
+		}
+
+		if (0 != _priority)
+		{
+			const int32_t priority = bx::clamp<int32_t>(_priority, -2, 2);
+
+#if BX_PLATFORM_WINDOWS
+			// THREAD_PRIORITY_LOWEST is -2, and THREAD_PRIORITY_HIGHEST is 2.
+			if (!SetThreadPriority(GetCurrentThread(), priority) )
+			{
+				BX_TRACE("Failed to set thread priority %d.", priority);
+			}
+#elif BX_PLATFORM_LINUX || BX_PLATFORM_ANDROID
+			// Nice value is per thread on Linux. Raising priority above default
+			// requires CAP_SYS_NICE.
+			if (0 != setpriority(PRIO_PROCESS, id_t(syscall(SYS_gettid) ), -priority*5) )
+			{
+				BX_TRACE("Failed to set thread priority %d.", priority);
+			}
+#elif BX_PLATFORM_BSD || BX_PLATFORM_OSX || BX_PLATFORM_IOS
+			int policy;
+			sched_param param;
+			if (0 == pthread_getschedparam(pthread_self(), &policy, &param) )
+			{
+				const int32_t min = sched_get_priority_min(policy);
+				const int32_t max = sched_get_priority_max(policy);
+				param.sched_priority = bx::clamp<int32_t>(param.sched_priority + priority*(max-min)/4, min, max);
+
+				if (0 != pthread_setschedparam(pthread_self(), policy, &param) )
+				{
+					BX_TRACE("Failed to set thread priority %d.", priority);
+				}
+			}
+#else
+			BX_TRACE("Thread priority is not supported on this platform.");
+#endif // BX_PLATFORM_*
+		}
+	}
+
 	void rendererUpdateUniforms(RendererContextI* _renderCtx, UniformBuffer* _uniformBuffer, uint32_t _begin, uint32_t _end)
 	{
 		_uniformBuffer->reset(_begin);
@@ -3083,7 +3500,16 @@ namespace bgfx
 					ShaderHandle fsh;
 					_cmdbuf.read(fsh);
 
-					m_renderCtx->createProgram(handle, vsh, fsh);
+					uint8_t num;
+					_cmdbuf.read(num);
+
+					SpecializationConstant constants[BGFX_CONFIG_MAX_SPECIALIZATION_CONSTANTS];
+					for (uint8_t ii = 0; ii < num; ++ii)
+					{
+						_cmdbuf.read(constants[ii]);
+					}
+
+					m_renderCtx->createProgram(handle, vsh, fsh, num, constants);
 				}
 				break;
 
@@ -3216,6 +3642,18 @@ namespace bgfx
 				}
 				break;
 
+			case CommandBuffer::SetTextureResidentMips:
+				{
+					TextureHandle handle;
+					_cmdbuf.read(handle);
+
+					uint8_t minMip;
+					_cmdbuf.read(minMip);
+
+					m_renderCtx->setTextureResidentMips(handle, minMip);
+				}
+				break;
+
 			case CommandBuffer::DestroyTexture:
 				{
 					BGFX_PROFILER_SCOPE("DestroyTexture", 0xff2040ff);
@@ -3269,6 +3707,32 @@ namespace bgfx
 				}
 				break;
 
+			case CommandBuffer::PrecachePipelines:
+				{
+					BGFX_PROFILER_SCOPE("PrecachePipelines", 0xff2040ff);
+
+					ProgramHandle handle;
+					_cmdbuf.read(handle);
+
+					uint16_t numStates;
+					_cmdbuf.read(numStates);
+					_cmdbuf.align(BX_ALIGNOF(uint64_t) );
+					const uint64_t* states = (const uint64_t*)_cmdbuf.skip(numStates*sizeof(uint64_t) );
+
+					uint16_t numLayouts;
+					_cmdbuf.read(numLayouts);
+					_cmdbuf.align(BX_ALIGNOF(VertexLayout) );
+					const VertexLayout* layouts = (const VertexLayout*)_cmdbuf.skip(numLayouts*sizeof(VertexLayout) );
+
+					uint16_t numFrameBuffers;
+					_cmdbuf.read(numFrameBuffers);
+					_cmdbuf.align(BX_ALIGNOF(FrameBufferHandle) );
+					const FrameBufferHandle* frameBuffers = (const FrameBufferHandle*)_cmdbuf.skip(numFrameBuffers*sizeof(FrameBufferHandle) );
+
+					m_renderCtx->precachePipelines(handle, numStates, states, numLayouts, layouts, numFrameBuffers, frameBuffers);
+				}
+				break;
+
 			case CommandBuffer::DestroyFrameBuffer:
 				{
 					BGFX_PROFILER_SCOPE("DestroyFrameBuffer", 0xff2040ff);
@@ -3440,6 +3904,7 @@ namespace bgfx
 		, minResourceCbSize(BGFX_CONFIG_MIN_RESOURCE_COMMAND_BUFFER_SIZE)
 		, transientVbSize(BGFX_CONFIG_TRANSIENT_VERTEX_BUFFER_SIZE)
 		, transientIbSize(BGFX_CONFIG_TRANSIENT_INDEX_BUFFER_SIZE)
+		, uploadBudget(BGFX_CONFIG_UPLOAD_BUDGET)
 	{
 	}
 
@@ -3450,6 +3915,9 @@ namespace bgfx
 		, capabilities(UINT64_MAX)
 		, debug(BX_ENABLED(BGFX_CONFIG_DEBUG) )
 		, profile(BX_ENABLED(BGFX_CONFIG_DEBUG_ANNOTATION) )
+		, handoffSpin(BGFX_CONFIG_HANDOFF_SPIN)
+		, renderThreadAffinity(0)
+		, renderThreadPriority(0)
 		, callback(NULL)
 		, allocator(NULL)
 	{
@@ -3510,6 +3978,8 @@ namespace bgfx
 				s_callbackStub = BX_NEW(g_allocator, CallbackStub);
 		}
 
+		s_memoryArena.init(init.allocator, BGFX_CONFIG_MEMORY_ARENA_NUM_CHUNKS, BGFX_CONFIG_MEMORY_ARENA_CHUNK_SIZE);
+
 		bx::memSet(&g_caps, 0, sizeof(g_caps) );
 		g_caps.limits.maxDrawCalls            = BGFX_CONFIG_MAX_DRAW_CALLS;
 		g_caps.limits.maxBlits                = BGFX_CONFIG_MAX_BLIT_ITEMS;
@@ -3567,6 +4037,8 @@ namespace bgfx
 			BX_FALLTHROUGH;
 
 		case ErrorState::Default:
+			s_memoryArena.shutdown();
+
 			if (NULL != s_callbackStub)
 			{
 				BX_DELETE(g_allocator, s_callbackStub);
@@ -3602,6 +4074,8 @@ namespace bgfx
 
 		BX_TRACE("Shutdown complete.");
 
+		s_memoryArena.shutdown();
+
 		if (NULL != s_allocatorStub)
 		{
 			s_allocatorStub->checkLeaks();
@@ -3836,11 +4310,19 @@ namespace bgfx
 
 		if (isValid(_handle) )
 		{
-			const TextureRef& ref = s_ctx->m_textureRef[_handle.idx];
+			TextureRef& ref = s_ctx->m_textureRef[_handle.idx];
 			BX_ASSERT(!ref.isReadBack()
 				, "Can't sample from texture which was created with BGFX_TEXTURE_READ_BACK. This is CPU only texture."
 				);
-			BX_UNUSED(ref);
+
+			// Encoders on multiple threads can bind same texture, all of them storing same
+			// frame number. Skip the store when it's already up to date, to avoid bouncing
+			// cache line between threads.
+			const uint32_t frameNum = s_ctx->m_submit->m_frameNum;
+			if (frameNum != ref.m_usedFrame)
+			{
+				bx::atomicExchange<uint32_t>(&ref.m_usedFrame, frameNum);
+			}
 		}
 
 		BGFX_ENCODER(setTexture(_stage, _sampler, _handle, _flags) );
@@ -4047,6 +4529,11 @@ namespace bgfx
 		return s_ctx->frame(_capture);
 	}
 
+	uint32_t getGpuCompletedFrame()
+	{
+		return s_ctx->getGpuCompletedFrame();
+	}
+
 	const Caps* getCaps()
 	{
 		return &g_caps;
@@ -4062,23 +4549,43 @@ namespace bgfx
 		return g_caps.rendererType;
 	}
 
-	const Memory* alloc(uint32_t _size)
+	const Memory* alloc(uint32_t _size, bool _persistent)
 	{
 		BX_ASSERT(0 < _size, "Invalid memory operation. _size is 0.");
+
+		if (!_persistent)
+		{
+			Memory* mem = s_memoryArena.alloc(_size);
+			if (NULL != mem)
+			{
+				return mem;
+			}
+		}
+
 		Memory* mem = (Memory*)BX_ALLOC(g_allocator, sizeof(Memory) + _size);
 		mem->size = _size;
 		mem->data = (uint8_t*)mem + sizeof(Memory);
 		return mem;
 	}
 
-	const Memory* copy(const void* _data, uint32_t _size)
+	const Memory* alloc(uint32_t _size)
+	{
+		return alloc(_size, false);
+	}
+
+	const Memory* copy(const void* _data, uint32_t _size, bool _persistent)
 	{
 		BX_ASSERT(0 < _size, "Invalid memory operation. _size is 0.");
-		const Memory* mem = alloc(_size);
+		const Memory* mem = alloc(_size, _persistent);
 		bx::memCopy(mem->data, _data, _size);
 		return mem;
 	}
 
+	const Memory* copy(const void* _data, uint32_t _size)
+	{
+		return copy(_data, _size, false);
+	}
+
 	struct MemoryRef
 	{
 		Memory mem;
@@ -4113,6 +4620,11 @@ namespace bgfx
 				memRef->releaseFn(mem->data, memRef->userData);
 			}
 		}
+		else if (s_memoryArena.free(mem) )
+		{
+			return;
+		}
+
 		BX_FREE(g_allocator, mem);
 	}
 
@@ -4387,12 +4899,43 @@ namespace bgfx
 			return createProgram(_vsh, _destroyShaders);
 		}
 
-		return s_ctx->createProgram(_vsh, _fsh, _destroyShaders);
+		return s_ctx->createProgram(_vsh, _fsh, 0, NULL, _destroyShaders);
 	}
 
 	ProgramHandle createProgram(ShaderHandle _csh, bool _destroyShader)
 	{
-		return s_ctx->createProgram(_csh, _destroyShader);
+		return s_ctx->createProgram(_csh, 0, NULL, _destroyShader);
+	}
+
+	ProgramHandle createProgram(ShaderHandle _vsh, ShaderHandle _fsh, uint8_t _num, const SpecializationConstant* _constants, bool _destroyShaders)
+	{
+		BX_ASSERT(_num <= BGFX_CONFIG_MAX_SPECIALIZATION_CONSTANTS
+			, "Number of specialization constants is larger than allowed %d (max: %d)."
+			, _num
+			, BGFX_CONFIG_MAX_SPECIALIZATION_CONSTANTS
+			);
+		BX_ASSERT(0 == _num || NULL != _constants, "_constants can't be NULL");
+		BX_ASSERT(0 == _num || Context::isSpecializationConstantIdUnique(_num, _constants), "Specialization constant ids must be unique.");
+
+		if (!isValid(_fsh) )
+		{
+			return createProgram(_vsh, _num, _constants, _destroyShaders);
+		}
+
+		return s_ctx->createProgram(_vsh, _fsh, _num, _constants, _destroyShaders);
+	}
+
+	ProgramHandle createProgram(ShaderHandle _csh, uint8_t _num, const SpecializationConstant* _constants, bool _destroyShader)
+	{
+		BX_ASSERT(_num <= BGFX_CONFIG_MAX_SPECIALIZATION_CONSTANTS
+			, "Number of specialization constants is larger than allowed %d (max: %d)."
+			, _num
+			, BGFX_CONFIG_MAX_SPECIALIZATION_CONSTANTS
+			);
+		BX_ASSERT(0 == _num || NULL != _constants, "_constants can't be NULL");
+		BX_ASSERT(0 == _num || Context::isSpecializationConstantIdUnique(_num, _constants), "Specialization constant ids must be unique.");
+
+		return s_ctx->createProgram(_csh, _num, _constants, _destroyShader);
 	}
 
 	void destroy(ProgramHandle _handle)
@@ -4400,6 +4943,14 @@ namespace bgfx
 		s_ctx->destroyProgram(_handle);
 	}
 
+	void precachePipelines(ProgramHandle _handle, uint16_t _numStates, const uint64_t* _states, uint16_t _numLayouts, const VertexLayout* _layouts, uint16_t _numFrameBuffers, const FrameBufferHandle* _frameBuffers)
+	{
+		BX_ASSERT(0 == _numStates || NULL != _states, "_states can't be NULL");
+		BX_ASSERT(0 == _numLayouts || NULL != _layouts, "_layouts can't be NULL");
+		BX_ASSERT(0 == _numFrameBuffers || NULL != _frameBuffers, "_frameBuffers can't be NULL");
+		s_ctx->precachePipelines(_handle, _numStates, _states, _numLayouts, _layouts, _numFrameBuffers, _frameBuffers);
+	}
+
 	void isFrameBufferValid(uint8_t _num, const Attachment* _attachment, bx::Error* _err)
 	{
 		BX_ERROR_SCOPE(_err, "Frame buffer validation");
@@ -5046,6 +5597,27 @@ namespace bgfx
 		return s_ctx->readTexture(_handle, _data, _mip);
 	}
 
+	void setUploadPriority(TextureHandle _handle, UploadPriority::Enum _priority)
+	{
+		BX_ASSERT(UploadPriority::Count > _priority, "Invalid upload priority %d.", _priority);
+		s_ctx->setUploadPriority(_handle, _priority);
+	}
+
+	uint32_t getUploadFrame(TextureHandle _handle)
+	{
+		return s_ctx->getUploadFrame(_handle);
+	}
+
+	void setTextureResidentMips(TextureHandle _handle, uint8_t _minMip)
+	{
+		s_ctx->setTextureResidentMips(_handle, _minMip);
+	}
+
+	uint32_t getTextureUsedFrame(TextureHandle _handle, uint8_t* _minMip)
+	{
+		return s_ctx->getTextureUsedFrame(_handle, _minMip);
+	}
+
 	FrameBufferHandle createFrameBuffer(uint16_t _width, uint16_t _height, TextureFormat::Enum _format, uint64_t _textureFlags)
 	{
 		_textureFlags |= _textureFlags&BGFX_TEXTURE_RT_MSAA_MASK ? 0 : BGFX_TEXTURE_RT;
@@ -5061,6 +5633,27 @@ namespace bgfx
 		return createFrameBuffer(1, &th, true);
 	}
 
+	FrameBufferHandle allocTransientFrameBuffer(uint16_t _width, uint16_t _height, TextureFormat::Enum _format, ViewId _firstView, ViewId _lastView, uint64_t _textureFlags)
+	{
+		BX_ASSERT(_firstView <= _lastView, "Invalid view lifetime %d-%d.", _firstView, _lastView);
+		BX_ASSERT(_lastView < BGFX_CONFIG_MAX_VIEWS, "Invalid view id: %d", _lastView);
+		_textureFlags |= _textureFlags&BGFX_TEXTURE_RT_MSAA_MASK ? 0 : BGFX_TEXTURE_RT;
+
+		FrameBufferHandle handle = s_ctx->transientFrameBufferFind(_width, _height, _format, _textureFlags, _firstView, _lastView);
+
+		if (!isValid(handle) )
+		{
+			handle = createFrameBuffer(_width, _height, _format, _textureFlags);
+
+			if (isValid(handle) )
+			{
+				s_ctx->transientFrameBufferAdd(handle, _width, _height, _format, _textureFlags, _firstView, _lastView);
+			}
+		}
+
+		return handle;
+	}
+
 	FrameBufferHandle createFrameBuffer(uint8_t _num, const TextureHandle* _handles, bool _destroyTextures)
 	{
 		Attachment attachment[BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS];
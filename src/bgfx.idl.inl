@@ -159,6 +159,11 @@ BGFX_C_API uint32_t bgfx_frame(bool _capture)
 	return bgfx::frame(_capture);
 }
 
+BGFX_C_API uint32_t bgfx_get_gpu_completed_frame(void)
+{
+	return bgfx::getGpuCompletedFrame();
+}
+
 BGFX_C_API bgfx_renderer_type_t bgfx_get_renderer_type(void)
 {
 	return (bgfx_renderer_type_t)bgfx::getRendererType();
@@ -179,11 +184,21 @@ BGFX_C_API const bgfx_memory_t* bgfx_alloc(uint32_t _size)
 	return (const bgfx_memory_t*)bgfx::alloc(_size);
 }
 
+BGFX_C_API const bgfx_memory_t* bgfx_alloc_persistent(uint32_t _size, bool _persistent)
+{
+	return (const bgfx_memory_t*)bgfx::alloc(_size, _persistent);
+}
+
 BGFX_C_API const bgfx_memory_t* bgfx_copy(const void* _data, uint32_t _size)
 {
 	return (const bgfx_memory_t*)bgfx::copy(_data, _size);
 }
 
+BGFX_C_API const bgfx_memory_t* bgfx_copy_persistent(const void* _data, uint32_t _size, bool _persistent)
+{
+	return (const bgfx_memory_t*)bgfx::copy(_data, _size, _persistent);
+}
+
 BGFX_C_API const bgfx_memory_t* bgfx_make_ref(const void* _data, uint32_t _size)
 {
 	return (const bgfx_memory_t*)bgfx::makeRef(_data, _size);
@@ -422,12 +437,35 @@ BGFX_C_API bgfx_program_handle_t bgfx_create_compute_program(bgfx_shader_handle_
 	return handle_ret.c;
 }
 
+BGFX_C_API bgfx_program_handle_t bgfx_create_program_specialized(bgfx_shader_handle_t _vsh, bgfx_shader_handle_t _fsh, uint8_t _num, const bgfx_specialization_constant_t* _constants, bool _destroyShaders)
+{
+	union { bgfx_shader_handle_t c; bgfx::ShaderHandle cpp; } vsh = { _vsh };
+	union { bgfx_shader_handle_t c; bgfx::ShaderHandle cpp; } fsh = { _fsh };
+	union { bgfx_program_handle_t c; bgfx::ProgramHandle cpp; } handle_ret;
+	handle_ret.cpp = bgfx::createProgram(vsh.cpp, fsh.cpp, _num, (const bgfx::SpecializationConstant*)_constants, _destroyShaders);
+	return handle_ret.c;
+}
+
+BGFX_C_API bgfx_program_handle_t bgfx_create_compute_program_specialized(bgfx_shader_handle_t _csh, uint8_t _num, const bgfx_specialization_constant_t* _constants, bool _destroyShaders)
+{
+	union { bgfx_shader_handle_t c; bgfx::ShaderHandle cpp; } csh = { _csh };
+	union { bgfx_program_handle_t c; bgfx::ProgramHandle cpp; } handle_ret;
+	handle_ret.cpp = bgfx::createProgram(csh.cpp, _num, (const bgfx::SpecializationConstant*)_constants, _destroyShaders);
+	return handle_ret.c;
+}
+
 BGFX_C_API void bgfx_destroy_program(bgfx_program_handle_t _handle)
 {
 	union { bgfx_program_handle_t c; bgfx::ProgramHandle cpp; } handle = { _handle };
 	bgfx::destroy(handle.cpp);
 }
 
+BGFX_C_API void bgfx_precache_pipelines(bgfx_program_handle_t _handle, uint16_t _numStates, const uint64_t* _states, uint16_t _numLayouts, const bgfx_vertex_layout_t* _layouts, uint16_t _numFrameBuffers, const bgfx_frame_buffer_handle_t* _frameBuffers)
+{
+	union { bgfx_program_handle_t c; bgfx::ProgramHandle cpp; } handle = { _handle };
+	bgfx::precachePipelines(handle.cpp, _numStates, _states, _numLayouts, (const bgfx::VertexLayout*)_layouts, _numFrameBuffers, (const bgfx::FrameBufferHandle*)_frameBuffers);
+}
+
 BGFX_C_API bool bgfx_is_texture_valid(uint16_t _depth, bool _cubeMap, uint16_t _numLayers, bgfx_texture_format_t _format, uint64_t _flags)
 {
 	return bgfx::isTextureValid(_depth, _cubeMap, _numLayers, (bgfx::TextureFormat::Enum)_format, _flags);
@@ -503,6 +541,30 @@ BGFX_C_API uint32_t bgfx_read_texture(bgfx_texture_handle_t _handle, void* _data
 	return bgfx::readTexture(handle.cpp, _data, _mip);
 }
 
+BGFX_C_API void bgfx_set_upload_priority(bgfx_texture_handle_t _handle, bgfx_upload_priority_t _priority)
+{
+	union { bgfx_texture_handle_t c; bgfx::TextureHandle cpp; } handle = { _handle };
+	bgfx::setUploadPriority(handle.cpp, (bgfx::UploadPriority::Enum)_priority);
+}
+
+BGFX_C_API uint32_t bgfx_get_upload_frame(bgfx_texture_handle_t _handle)
+{
+	union { bgfx_texture_handle_t c; bgfx::TextureHandle cpp; } handle = { _handle };
+	return bgfx::getUploadFrame(handle.cpp);
+}
+
+BGFX_C_API void bgfx_set_texture_resident_mips(bgfx_texture_handle_t _handle, uint8_t _minMip)
+{
+	union { bgfx_texture_handle_t c; bgfx::TextureHandle cpp; } handle = { _handle };
+	bgfx::setTextureResidentMips(handle.cpp, _minMip);
+}
+
+BGFX_C_API uint32_t bgfx_get_texture_used_frame(bgfx_texture_handle_t _handle, uint8_t* _minMip)
+{
+	union { bgfx_texture_handle_t c; bgfx::TextureHandle cpp; } handle = { _handle };
+	return bgfx::getTextureUsedFrame(handle.cpp, _minMip);
+}
+
 BGFX_C_API void bgfx_set_texture_name(bgfx_texture_handle_t _handle, const char* _name, int32_t _len)
 {
 	union { bgfx_texture_handle_t c; bgfx::TextureHandle cpp; } handle = { _handle };
@@ -535,6 +597,13 @@ BGFX_C_API bgfx_frame_buffer_handle_t bgfx_create_frame_buffer_scaled(bgfx_backb
 	return handle_ret.c;
 }
 
+BGFX_C_API bgfx_frame_buffer_handle_t bgfx_alloc_transient_frame_buffer(uint16_t _width, uint16_t _height, bgfx_texture_format_t _format, bgfx_view_id_t _firstView, bgfx_view_id_t _lastView, uint64_t _textureFlags)
+{
+	union { bgfx_frame_buffer_handle_t c; bgfx::FrameBufferHandle cpp; } handle_ret;
+	handle_ret.cpp = bgfx::allocTransientFrameBuffer(_width, _height, (bgfx::TextureFormat::Enum)_format, (bgfx::ViewId)_firstView, (bgfx::ViewId)_lastView, _textureFlags);
+	return handle_ret.c;
+}
+
 BGFX_C_API bgfx_frame_buffer_handle_t bgfx_create_frame_buffer_from_handles(uint8_t _num, const bgfx_texture_handle_t* _handles, bool _destroyTexture)
 {
 	union { bgfx_frame_buffer_handle_t c; bgfx::FrameBufferHandle cpp; } handle_ret;
@@ -1293,11 +1362,14 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_shutdown,
 			bgfx_reset,
 			bgfx_frame,
+			bgfx_get_gpu_completed_frame,
 			bgfx_get_renderer_type,
 			bgfx_get_caps,
 			bgfx_get_stats,
 			bgfx_alloc,
+			bgfx_alloc_persistent,
 			bgfx_copy,
+			bgfx_copy_persistent,
 			bgfx_make_ref,
 			bgfx_make_ref_release,
 			bgfx_set_debug,
@@ -1336,7 +1408,10 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_destroy_shader,
 			bgfx_create_program,
 			bgfx_create_compute_program,
+			bgfx_create_program_specialized,
+			bgfx_create_compute_program_specialized,
 			bgfx_destroy_program,
+			bgfx_precache_pipelines,
 			bgfx_is_texture_valid,
 			bgfx_is_frame_buffer_valid,
 			bgfx_calc_texture_size,
@@ -1349,11 +1424,16 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_update_texture_3d,
 			bgfx_update_texture_cube,
 			bgfx_read_texture,
+			bgfx_set_upload_priority,
+			bgfx_get_upload_frame,
+			bgfx_set_texture_resident_mips,
+			bgfx_get_texture_used_frame,
 			bgfx_set_texture_name,
 			bgfx_get_direct_access_ptr,
 			bgfx_destroy_texture,
 			bgfx_create_frame_buffer,
 			bgfx_create_frame_buffer_scaled,
+			bgfx_alloc_transient_frame_buffer,
 			bgfx_create_frame_buffer_from_handles,
 			bgfx_create_frame_buffer_from_attachment,
 			bgfx_create_frame_buffer_from_nwh,
@@ -144,6 +144,7 @@ namespace bgfx
 
 #include <bgfx/platform.h>
 #include <bimg/bimg.h>
+#include "handoffsemaphore.h"
 #include "shader.h"
 #include "vertexlayout.h"
 #include "version.h"
@@ -819,6 +820,65 @@ namespace bgfx
 		uint32_t m_values[maxKeys];
 	};
 
+	struct UploadItem
+	{
+		enum Enum
+		{
+			Texture,
+
+			Count
+		};
+
+		const Memory* m_mem;
+		Rect     m_rect;
+		uint16_t m_handle;
+		uint16_t m_z;
+		uint16_t m_depth;
+		uint16_t m_pitch;
+		uint8_t  m_type;
+		uint8_t  m_priority;
+		uint8_t  m_side;
+		uint8_t  m_mip;
+	};
+
+	struct TransientFrameBuffer
+	{
+		bool isAvailable(uint16_t _first, uint16_t _last) const
+		{
+			for (uint32_t ii = _first; ii <= _last; ++ii)
+			{
+				if (0 != (m_views[ii/32] & (UINT32_C(1) << (ii%32) ) ) )
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		void setViews(uint16_t _first, uint16_t _last)
+		{
+			for (uint32_t ii = _first; ii <= _last; ++ii)
+			{
+				m_views[ii/32] |= UINT32_C(1) << (ii%32);
+			}
+		}
+
+		FrameBufferHandle m_handle;
+		uint64_t m_flags;
+		uint32_t m_lastFrame;
+		uint32_t m_views[BGFX_CONFIG_MAX_VIEWS/32]; //!< View positions in which target is used this frame.
+		uint16_t m_width;
+		uint16_t m_height;
+		uint8_t  m_format;
+	};
+
+	struct RecycledResource
+	{
+		uint32_t m_frameNum; //!< Frame in which resource was destroyed.
+		uint16_t m_idx;
+	};
+
 	struct ClearQuad
 	{
 		ClearQuad()
@@ -910,7 +970,9 @@ namespace bgfx
 			CreateTexture,
 			UpdateTexture,
 			ResizeTexture,
+			SetTextureResidentMips,
 			CreateFrameBuffer,
+			PrecachePipelines,
 			CreateUniform,
 			UpdateViewName,
 			InvalidateOcclusionQuery,
@@ -1942,6 +2004,8 @@ namespace bgfx
 		ShaderHandle m_vsh;
 		ShaderHandle m_fsh;
 		int16_t      m_refCount;
+		uint8_t      m_numConstants;
+		SpecializationConstant m_constants[BGFX_CONFIG_MAX_SPECIALIZATION_CONSTANTS];
 	};
 
 	struct UniformRef
@@ -1984,6 +2048,13 @@ namespace bgfx
 			m_immutable   = _immutable;
 			m_cubeMap     = _cubeMap;
 			m_flags       = _flags;
+
+			m_uploadFrame       = 0;
+			m_usedFrame         = 0;
+			m_numPendingUploads = 0;
+			m_uploadPriority    = UploadPriority::Normal;
+			m_residentMip       = 0;
+			m_recyclable        = false;
 		}
 
 		bool isRt() const
@@ -2015,6 +2086,9 @@ namespace bgfx
 		void*    m_ptr;
 		uint64_t m_flags;
 		uint32_t m_storageSize;
+		uint32_t m_uploadFrame;
+		uint32_t m_usedFrame;
+		uint16_t m_numPendingUploads;
 		int16_t  m_refCount;
 		uint8_t  m_bbRatio;
 		uint16_t m_width;
@@ -2024,7 +2098,10 @@ namespace bgfx
 		uint8_t  m_numSamples;
 		uint8_t  m_numMips;
 		uint16_t m_numLayers;
+		uint8_t  m_uploadPriority;
+		uint8_t  m_residentMip;
 		bool     m_owned;
+		bool     m_recyclable;
 		bool     m_immutable;
 		bool     m_cubeMap;
 	};
@@ -2041,6 +2118,8 @@ namespace bgfx
 			void* m_nwh;
 		} un;
 
+		Attachment m_attachment[BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS];
+		uint8_t m_num;
 		bool m_window;
 	};
 
@@ -2157,6 +2236,8 @@ namespace bgfx
 		Frame()
 			: m_waitSubmit(0)
 			, m_waitRender(0)
+			, m_handoffSubmit(0)
+			, m_handoffRender(0)
 			, m_frameNum(0)
 			, m_capture(false)
 		{
@@ -2167,6 +2248,7 @@ namespace bgfx
 			m_sortValues[BGFX_CONFIG_MAX_DRAW_CALLS] = BGFX_CONFIG_MAX_DRAW_CALLS;
 			bx::memSet(m_occlusion, 0xff, sizeof(m_occlusion) );
 
+			bx::memSet(&m_perfStats, 0, sizeof(m_perfStats) );
 			m_perfStats.viewStats = m_viewStats;
 		}
 
@@ -2435,6 +2517,8 @@ namespace bgfx
 
 		int64_t m_waitSubmit;
 		int64_t m_waitRender;
+		int64_t m_handoffSubmit;
+		int64_t m_handoffRender;
 
 		uint32_t m_frameNum;
 
@@ -3059,6 +3143,7 @@ namespace bgfx
 		virtual RendererType::Enum getRendererType() const = 0;
 		virtual const char* getRendererName() const = 0;
 		virtual bool isDeviceRemoved() = 0;
+		virtual bool getGpuCompletedFrame(uint32_t& _outFrameNum) = 0;
 		virtual void flip() = 0;
 		virtual void createIndexBuffer(IndexBufferHandle _handle, const Memory* _mem, uint16_t _flags) = 0;
 		virtual void destroyIndexBuffer(IndexBufferHandle _handle) = 0;
@@ -3074,14 +3159,16 @@ namespace bgfx
 		virtual void destroyDynamicVertexBuffer(VertexBufferHandle _handle) = 0;
 		virtual void createShader(ShaderHandle _handle, const Memory* _mem) = 0;
 		virtual void destroyShader(ShaderHandle _handle) = 0;
-		virtual void createProgram(ProgramHandle _handle, ShaderHandle _vsh, ShaderHandle _fsh) = 0;
+		virtual void createProgram(ProgramHandle _handle, ShaderHandle _vsh, ShaderHandle _fsh, uint8_t _numConstants, const SpecializationConstant* _constants) = 0;
 		virtual void destroyProgram(ProgramHandle _handle) = 0;
+		virtual void precachePipelines(ProgramHandle _handle, uint16_t _numStates, const uint64_t* _states, uint16_t _numLayouts, const VertexLayout* _layouts, uint16_t _numFrameBuffers, const FrameBufferHandle* _frameBuffers) = 0;
 		virtual void* createTexture(TextureHandle _handle, const Memory* _mem, uint64_t _flags, uint8_t _skip) = 0;
 		virtual void updateTextureBegin(TextureHandle _handle, uint8_t _side, uint8_t _mip) = 0;
 		virtual void updateTexture(TextureHandle _handle, uint8_t _side, uint8_t _mip, const Rect& _rect, uint16_t _z, uint16_t _depth, uint16_t _pitch, const Memory* _mem) = 0;
 		virtual void updateTextureEnd() = 0;
 		virtual void readTexture(TextureHandle _handle, void* _data, uint8_t _mip) = 0;
 		virtual void resizeTexture(TextureHandle _handle, uint16_t _width, uint16_t _height, uint8_t _numMips, uint16_t _numLayers) = 0;
+		virtual void setTextureResidentMips(TextureHandle _handle, uint8_t _minMip) = 0;
 		virtual void overrideInternal(TextureHandle _handle, uintptr_t _ptr) = 0;
 		virtual uintptr_t getInternal(TextureHandle _handle) = 0;
 		virtual void destroyTexture(TextureHandle _handle) = 0;
@@ -3107,6 +3194,8 @@ namespace bgfx
 
 	void rendererUpdateUniforms(RendererContextI* _renderCtx, UniformBuffer* _uniformBuffer, uint32_t _begin, uint32_t _end);
 
+	void setThreadScheduling(uint64_t _affinityMask, int8_t _priority);
+
 #if BGFX_CONFIG_DEBUG
 #	define BGFX_API_FUNC(_func) BX_NO_INLINE _func
 #else
@@ -3125,14 +3214,20 @@ namespace bgfx
 			, m_numFreeOcclusionQueryHandles(0)
 			, m_colorPaletteDirty(0)
 			, m_frames(0)
+			, m_gpuCompletedFrame(UINT32_MAX)
 			, m_debug(BGFX_DEBUG_NONE)
 			, m_rtMemoryUsed(0)
 			, m_textureMemoryUsed(0)
+			, m_uploadQueueSize(0)
+			, m_numTransientFrameBufferAllocs(0)
+			, m_numRecycleHits(0)
+			, m_numRecycleMisses(0)
 			, m_renderCtx(NULL)
 			, m_rendererInitialized(false)
 			, m_exit(false)
 			, m_flipAfterRender(false)
 			, m_singleThreaded(false)
+			, m_handoffSpin(0)
 		{
 		}
 
@@ -3141,10 +3236,12 @@ namespace bgfx
 		}
 
 #if BX_CONFIG_SUPPORTS_THREADING
-		static int32_t renderThread(bx::Thread* /*_self*/, void* /*_userData*/)
+		static int32_t renderThread(bx::Thread* /*_self*/, void* _userData)
 		{
 			BX_TRACE("render thread start");
 			BGFX_PROFILER_SET_CURRENT_THREAD_NAME("bgfx - Render Thread");
+			const Context* ctx = (const Context*)_userData;
+			setThreadScheduling(ctx->m_init.renderThreadAffinity, ctx->m_init.renderThreadPriority);
 			while (RenderFrame::Exiting != bgfx::renderFrame() ) {};
 			BX_TRACE("render thread exit");
 			return bx::kExitSuccess;
@@ -3293,6 +3390,15 @@ namespace bgfx
 			stats.textureMemoryUsed = m_textureMemoryUsed;
 			stats.rtMemoryUsed      = m_rtMemoryUsed;
 
+			stats.numUploadsPending = uint32_t(m_uploadQueue.size() );
+			stats.uploadQueueSize   = m_uploadQueueSize;
+
+			stats.numTransientFrameBuffers = uint32_t(m_transientFrameBuffers.size() );
+
+			stats.numRecycleHits   = m_numRecycleHits;
+			stats.numRecycleMisses = m_numRecycleMisses;
+			stats.numRecycled      = uint32_t(m_texturePool.size() + m_frameBufferPool.size() );
+
 			return &stats;
 		}
 
@@ -3582,7 +3688,7 @@ namespace bgfx
 				return BGFX_INVALID_HANDLE;
 			}
 
-			update(handle, 0, _mem);
+			updateDynamicIndexBuffer(handle, 0, _mem);
 
 			return handle;
 		}
@@ -3593,6 +3699,13 @@ namespace bgfx
 
 			BGFX_CHECK_HANDLE("updateDynamicIndexBuffer", m_dynamicIndexBufferHandle, _handle);
 
+			// Buffer updates are never deferred by upload queue, draws submitted after
+			// update in the same frame must see updated data.
+			updateDynamicIndexBuffer(_handle, _startIndex, _mem);
+		}
+
+		void updateDynamicIndexBuffer(DynamicIndexBufferHandle _handle, uint32_t _startIndex, const Memory* _mem)
+		{
 			DynamicIndexBuffer& dib = m_dynamicIndexBuffers[_handle.idx];
 			BX_ASSERT(0 == (dib.m_flags &  BGFX_BUFFER_COMPUTE_WRITE), "Can't update GPU buffer from CPU.");
 			const uint32_t indexSize = 0 == (dib.m_flags & BGFX_BUFFER_INDEX32) ? 2 : 4;
@@ -3778,7 +3891,7 @@ namespace bgfx
 				return BGFX_INVALID_HANDLE;
 			}
 
-			update(handle, 0, _mem);
+			updateDynamicVertexBuffer(handle, 0, _mem);
 
 			return handle;
 		}
@@ -3789,6 +3902,13 @@ namespace bgfx
 
 			BGFX_CHECK_HANDLE("updateDynamicVertexBuffer", m_dynamicVertexBufferHandle, _handle);
 
+			// Buffer updates are never deferred by upload queue, draws submitted after
+			// update in the same frame must see updated data.
+			updateDynamicVertexBuffer(_handle, _startVertex, _mem);
+		}
+
+		void updateDynamicVertexBuffer(DynamicVertexBufferHandle _handle, uint32_t _startVertex, const Memory* _mem)
+		{
 			DynamicVertexBuffer& dvb = m_dynamicVertexBuffers[_handle.idx];
 			BX_ASSERT(0 == (dvb.m_flags &  BGFX_BUFFER_COMPUTE_WRITE), "Can't update GPU write buffer from CPU.");
 
@@ -4329,7 +4449,65 @@ namespace bgfx
 			}
 		}
 
-		BGFX_API_FUNC(ProgramHandle createProgram(ShaderHandle _vsh, ShaderHandle _fsh, bool _destroyShaders) )
+		static uint32_t getProgramKey(uint32_t _key, uint8_t _num, const SpecializationConstant* _constants)
+		{
+			if (0 == _num)
+			{
+				return _key;
+			}
+
+			bx::HashMurmur2A murmur;
+			murmur.begin();
+			murmur.add(_key);
+			murmur.add(_num);
+			murmur.add(_constants, _num*sizeof(SpecializationConstant) );
+			return murmur.end();
+		}
+
+		// Specialized program keys are hashes and can collide with each other or with plain
+		// shader pair keys, so cached program is reused only when it's an exact match.
+		static bool isProgramMatch(const ProgramRef& _pr, ShaderHandle _vsh, ShaderHandle _fsh, uint8_t _num, const SpecializationConstant* _constants)
+		{
+			return _pr.m_vsh.idx == _vsh.idx
+				&& _pr.m_fsh.idx == _fsh.idx
+				&& _pr.m_numConstants == _num
+				&& 0 == bx::memCmp(_pr.m_constants, _constants, _num*sizeof(SpecializationConstant) )
+				;
+		}
+
+		static bool isSpecializationConstantIdUnique(uint8_t _num, const SpecializationConstant* _constants)
+		{
+			for (uint8_t ii = 0; ii < _num; ++ii)
+			{
+				for (uint8_t jj = ii + 1; jj < _num; ++jj)
+				{
+					if (_constants[ii].id == _constants[jj].id)
+					{
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+
+		static void setProgramConstants(ProgramRef& _pr, uint8_t _num, const SpecializationConstant* _constants)
+		{
+			_pr.m_numConstants = _num;
+			bx::memCopy(_pr.m_constants, _constants, _num*sizeof(SpecializationConstant) );
+		}
+
+		void writeSpecializationConstants(CommandBuffer& _cmdbuf, uint8_t _num, const SpecializationConstant* _constants)
+		{
+			_cmdbuf.write(_num);
+
+			for (uint8_t ii = 0; ii < _num; ++ii)
+			{
+				_cmdbuf.write(_constants[ii]);
+			}
+		}
+
+		BGFX_API_FUNC(ProgramHandle createProgram(ShaderHandle _vsh, ShaderHandle _fsh, uint8_t _num, const SpecializationConstant* _constants, bool _destroyShaders) )
 		{
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
 
@@ -4340,7 +4518,18 @@ namespace bgfx
 				return BGFX_INVALID_HANDLE;
 			}
 
-			ProgramHandle handle = { m_programHashMap.find(uint32_t(_fsh.idx<<16)|_vsh.idx) };
+			const uint32_t key = getProgramKey(uint32_t(_fsh.idx<<16)|_vsh.idx, _num, _constants);
+
+			ProgramHandle handle = { m_programHashMap.find(key) };
+			const bool collision = isValid(handle)
+				&& !isProgramMatch(m_programRef[handle.idx], _vsh, _fsh, _num, _constants)
+				;
+			if (collision)
+			{
+				BX_TRACE("Program key collision (key: %x, handle: %3d), creating uncached program.", key, handle.idx);
+				handle = BGFX_INVALID_HANDLE;
+			}
+
 			if (isValid(handle) )
 			{
 				ProgramRef& pr = m_programRef[handle.idx];
@@ -4369,15 +4558,19 @@ namespace bgfx
 					pr.m_vsh = _vsh;
 					pr.m_fsh = _fsh;
 					pr.m_refCount = 1;
+					setProgramConstants(pr, _num, _constants);
 
-					const uint32_t key = uint32_t(_fsh.idx<<16)|_vsh.idx;
-					bool ok = m_programHashMap.insert(key, handle.idx);
-					BX_ASSERT(ok, "Program already exists (key: %x, handle: %3d)!", key, handle.idx); BX_UNUSED(ok);
+					if (!collision)
+					{
+						bool ok = m_programHashMap.insert(key, handle.idx);
+						BX_ASSERT(ok, "Program already exists (key: %x, handle: %3d)!", key, handle.idx); BX_UNUSED(ok);
+					}
 
 					CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateProgram);
 					cmdbuf.write(handle);
 					cmdbuf.write(_vsh);
 					cmdbuf.write(_fsh);
+					writeSpecializationConstants(cmdbuf, _num, _constants);
 				}
 			}
 
@@ -4390,7 +4583,7 @@ namespace bgfx
 			return handle;
 		}
 
-		BGFX_API_FUNC(ProgramHandle createProgram(ShaderHandle _vsh, bool _destroyShader) )
+		BGFX_API_FUNC(ProgramHandle createProgram(ShaderHandle _vsh, uint8_t _num, const SpecializationConstant* _constants, bool _destroyShader) )
 		{
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
 
@@ -4400,7 +4593,17 @@ namespace bgfx
 				return BGFX_INVALID_HANDLE;
 			}
 
-			ProgramHandle handle = { m_programHashMap.find(_vsh.idx) };
+			const uint32_t key = getProgramKey(uint32_t(_vsh.idx), _num, _constants);
+
+			ProgramHandle handle = { m_programHashMap.find(key) };
+			const bool collision = isValid(handle)
+				&& !isProgramMatch(m_programRef[handle.idx], _vsh, BGFX_INVALID_HANDLE, _num, _constants)
+				;
+			if (collision)
+			{
+				BX_TRACE("Program key collision (key: %x, handle: %3d), creating uncached program.", key, handle.idx);
+				handle = BGFX_INVALID_HANDLE;
+			}
 
 			if (isValid(handle) )
 			{
@@ -4421,15 +4624,19 @@ namespace bgfx
 					ShaderHandle fsh = BGFX_INVALID_HANDLE;
 					pr.m_fsh = fsh;
 					pr.m_refCount = 1;
+					setProgramConstants(pr, _num, _constants);
 
-					const uint32_t key = uint32_t(_vsh.idx);
-					bool ok = m_programHashMap.insert(key, handle.idx);
-					BX_ASSERT(ok, "Program already exists (key: %x, handle: %3d)!", key, handle.idx); BX_UNUSED(ok);
+					if (!collision)
+					{
+						bool ok = m_programHashMap.insert(key, handle.idx);
+						BX_ASSERT(ok, "Program already exists (key: %x, handle: %3d)!", key, handle.idx); BX_UNUSED(ok);
+					}
 
 					CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateProgram);
 					cmdbuf.write(handle);
 					cmdbuf.write(_vsh);
 					cmdbuf.write(fsh);
+					writeSpecializationConstants(cmdbuf, _num, _constants);
 				}
 			}
 
@@ -4468,6 +4675,38 @@ namespace bgfx
 			}
 		}
 
+		BGFX_API_FUNC(void precachePipelines(ProgramHandle _handle, uint16_t _numStates, const uint64_t* _states, uint16_t _numLayouts, const VertexLayout* _layouts, uint16_t _numFrameBuffers, const FrameBufferHandle* _frameBuffers) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			BGFX_CHECK_HANDLE("precachePipelines", m_programHandle, _handle);
+
+			for (uint16_t ii = 0; ii < _numFrameBuffers; ++ii)
+			{
+				BGFX_CHECK_HANDLE_INVALID_OK("precachePipelines", m_frameBufferHandle, _frameBuffers[ii]);
+			}
+
+			if (0 == _numStates)
+			{
+				return;
+			}
+
+			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::PrecachePipelines);
+			cmdbuf.write(_handle);
+
+			cmdbuf.write(_numStates);
+			cmdbuf.align(BX_ALIGNOF(uint64_t) );
+			cmdbuf.write(_states, _numStates*sizeof(uint64_t) );
+
+			cmdbuf.write(_numLayouts);
+			cmdbuf.align(BX_ALIGNOF(VertexLayout) );
+			cmdbuf.write(_layouts, _numLayouts*sizeof(VertexLayout) );
+
+			cmdbuf.write(_numFrameBuffers);
+			cmdbuf.align(BX_ALIGNOF(FrameBufferHandle) );
+			cmdbuf.write(_frameBuffers, _numFrameBuffers*sizeof(FrameBufferHandle) );
+		}
+
 		BGFX_API_FUNC(TextureHandle createTexture(const Memory* _mem, uint64_t _flags, uint8_t _skip, TextureInfo* _info, BackbufferRatio::Enum _ratio, bool _immutable) )
 		{
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
@@ -4507,16 +4746,31 @@ namespace bgfx
 
 			_flags |= imageContainer.m_srgb ? BGFX_TEXTURE_SRGB : 0;
 
-			TextureHandle handle = { m_textureHandle.alloc() };
-			BX_WARN(isValid(handle), "Failed to allocate texture handle.");
+			const bool recyclable = isTextureRecyclable(_mem, _skip, _immutable);
 
-			if (!isValid(handle) )
+			TextureHandle handle = BGFX_INVALID_HANDLE;
+			if (recyclable)
 			{
-				release(_mem);
-				return BGFX_INVALID_HANDLE;
+				handle = texturePoolFind(imageContainer, _info->format, _flags, _ratio);
+			}
+
+			const bool recycled = isValid(handle);
+			if (!recycled)
+			{
+				handle.idx = m_textureHandle.alloc();
+				BX_WARN(isValid(handle), "Failed to allocate texture handle.");
+
+				if (!isValid(handle) )
+				{
+					release(_mem);
+					return BGFX_INVALID_HANDLE;
+				}
 			}
 
 			TextureRef& ref = m_textureRef[handle.idx];
+			void* ptr = ref.m_ptr;
+			const uint8_t residentMip = ref.m_residentMip;
+
 			ref.init(
 				  _ratio
 				, uint16_t(imageContainer.m_width)
@@ -4531,21 +4785,39 @@ namespace bgfx
 				, imageContainer.m_cubeMap
 				, _flags
 				);
+			ref.m_recyclable = recyclable;
 
-			if (ref.isRt() )
+			if (recycled)
 			{
-				m_rtMemoryUsed += int64_t(ref.m_storageSize);
+				// Renderer texture is reused as is, and it's still accounted
+				// in memory stats.
+				ref.m_ptr = ptr;
+				release(_mem);
+
+				if (0 != residentMip)
+				{
+					CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::SetTextureResidentMips);
+					cmdbuf.write(handle);
+					cmdbuf.write(ref.m_residentMip);
+				}
 			}
 			else
 			{
-				m_textureMemoryUsed += int64_t(ref.m_storageSize);
-			}
+				if (ref.isRt() )
+				{
+					m_rtMemoryUsed += int64_t(ref.m_storageSize);
+				}
+				else
+				{
+					m_textureMemoryUsed += int64_t(ref.m_storageSize);
+				}
 
-			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateTexture);
-			cmdbuf.write(handle);
-			cmdbuf.write(_mem);
-			cmdbuf.write(_flags);
-			cmdbuf.write(_skip);
+				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateTexture);
+				cmdbuf.write(handle);
+				cmdbuf.write(_mem);
+				cmdbuf.write(_flags);
+				cmdbuf.write(_skip);
+			}
 
 			setDebugNameForHandle(handle);
 
@@ -4613,9 +4885,12 @@ namespace bgfx
 
 		void resizeTexture(TextureHandle _handle, uint16_t _width, uint16_t _height, uint8_t _numMips, uint16_t _numLayers)
 		{
-			const TextureRef& ref = m_textureRef[_handle.idx];
+			TextureRef& ref = m_textureRef[_handle.idx];
 			BX_ASSERT(BackbufferRatio::Count != ref.m_bbRatio, "");
 
+			// Renderer recreates texture, with whole mip chain resident.
+			ref.m_residentMip = 0;
+
 			getTextureSizeFromRatio(BackbufferRatio::Enum(ref.m_bbRatio), _width, _height);
 			_numMips = calcNumMips(1 < _numMips, _width, _height);
 
@@ -4658,21 +4933,106 @@ namespace bgfx
 			{
 				ref.m_name.clear();
 
-				if (ref.isRt() )
+				if (0 < ref.m_numPendingUploads)
 				{
-					m_rtMemoryUsed -= int64_t(ref.m_storageSize);
+					uploadQueuePurge(UploadItem::Texture, _handle.idx);
 				}
-				else
+
+				if (ref.m_recyclable
+				&&  0 != BGFX_CONFIG_RECYCLE_POOL_MAX_AGE)
 				{
-					m_textureMemoryUsed -= int64_t(ref.m_storageSize);
+					RecycledResource rr;
+					rr.m_frameNum = m_submit->m_frameNum;
+					rr.m_idx      = _handle.idx;
+					m_texturePool.push_back(rr);
+					return;
 				}
 
-				bool ok = m_submit->free(_handle); BX_UNUSED(ok);
-				BX_ASSERT(ok, "Texture handle %d is already destroyed!", _handle.idx);
+				textureDestroy(_handle);
+			}
+		}
 
-				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyTexture);
-				cmdbuf.write(_handle);
+		void textureDestroy(TextureHandle _handle)
+		{
+			const TextureRef& ref = m_textureRef[_handle.idx];
+
+			if (ref.isRt() )
+			{
+				m_rtMemoryUsed -= int64_t(ref.m_storageSize);
+			}
+			else
+			{
+				m_textureMemoryUsed -= int64_t(ref.m_storageSize);
+			}
+
+			// Recycled frame buffers can't outlive their attachments.
+			frameBufferPoolPurge(_handle);
+
+			bool ok = m_submit->free(_handle); BX_UNUSED(ok);
+			BX_ASSERT(ok, "Texture handle %d is already destroyed!", _handle.idx);
+
+			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyTexture);
+			cmdbuf.write(_handle);
+		}
+
+		bool isTextureRecyclable(const Memory* _mem, uint8_t _skip, bool _immutable) const
+		{
+			// Only textures created without initial data can be reused, content
+			// of reused texture is undefined.
+			if (0 == BGFX_CONFIG_RECYCLE_POOL_MAX_AGE
+			||  _immutable
+			||  0 != _skip
+			||  _mem->size < sizeof(uint32_t) + sizeof(TextureCreate) )
+			{
+				return false;
+			}
+
+			uint32_t magic;
+			bx::memCopy(&magic, _mem->data, sizeof(magic) );
+
+			TextureCreate tc;
+			bx::memCopy(&tc, &_mem->data[sizeof(magic)], sizeof(tc) );
+
+			return BGFX_CHUNK_MAGIC_TEX == magic
+				&& NULL == tc.m_mem
+				;
+		}
+
+		TextureHandle texturePoolFind(const bimg::ImageContainer& _imageContainer, TextureFormat::Enum _format, uint64_t _flags, BackbufferRatio::Enum _ratio)
+		{
+			for (uint32_t ii = 0, num = uint32_t(m_texturePool.size() ); ii < num; ++ii)
+			{
+				const RecycledResource& rr = m_texturePool[ii];
+
+				// Texture destroyed this frame can still be used by this frame's draws,
+				// while new owner's upload executes before them.
+				if (rr.m_frameNum == m_submit->m_frameNum)
+				{
+					continue;
+				}
+
+				const TextureHandle handle = { rr.m_idx };
+				const TextureRef& ref = m_textureRef[handle.idx];
+
+				if (ref.m_width     == uint16_t(_imageContainer.m_width)
+				&&  ref.m_height    == uint16_t(_imageContainer.m_height)
+				&&  ref.m_depth     == uint16_t(_imageContainer.m_depth)
+				&&  ref.m_numMips   == _imageContainer.m_numMips
+				&&  ref.m_numLayers == _imageContainer.m_numLayers
+				&&  ref.m_cubeMap   == _imageContainer.m_cubeMap
+				&&  ref.m_format    == uint8_t(_format)
+				&&  ref.m_bbRatio   == uint8_t(_ratio)
+				&&  ref.m_flags     == _flags)
+				{
+					m_texturePool[ii] = m_texturePool[num-1];
+					m_texturePool.pop_back();
+					++m_numRecycleHits;
+					return handle;
+				}
 			}
+
+			++m_numRecycleMisses;
+			return BGFX_INVALID_HANDLE;
 		}
 
 		BGFX_API_FUNC(void updateTexture(
@@ -4691,7 +5051,7 @@ namespace bgfx
 		{
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
 
-			const TextureRef& ref = m_textureRef[_handle.idx];
+			TextureRef& ref = m_textureRef[_handle.idx];
 			if (ref.m_immutable)
 			{
 				BX_WARN(false, "Can't update immutable texture.");
@@ -4699,22 +5059,164 @@ namespace bgfx
 				return;
 			}
 
+			UploadItem item;
+			item.m_mem           = _mem;
+			item.m_rect.m_x      = _x;
+			item.m_rect.m_y      = _y;
+			item.m_rect.m_width  = _width;
+			item.m_rect.m_height = _height;
+			item.m_handle        = _handle.idx;
+			item.m_z             = _z;
+			item.m_depth         = _depth;
+			item.m_pitch         = _pitch;
+			item.m_type          = UploadItem::Texture;
+			item.m_priority      = ref.m_uploadPriority;
+			item.m_side          = _side;
+			item.m_mip           = _mip;
+
+			if (isUploadQueueEnabled() )
+			{
+				++ref.m_numPendingUploads;
+				uploadQueueAdd(item);
+				return;
+			}
+
+			updateTexture(item);
+		}
+
+		void updateTexture(const UploadItem& _item)
+		{
+			const TextureHandle handle = { _item.m_handle };
+
 			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::UpdateTexture);
-			cmdbuf.write(_handle);
-			cmdbuf.write(_side);
-			cmdbuf.write(_mip);
-			Rect rect;
-			rect.m_x = _x;
-			rect.m_y = _y;
-			rect.m_width  = _width;
-			rect.m_height = _height;
-			cmdbuf.write(rect);
-			cmdbuf.write(_z);
-			cmdbuf.write(_depth);
-			cmdbuf.write(_pitch);
-			cmdbuf.write(_mem);
+			cmdbuf.write(handle);
+			cmdbuf.write(_item.m_side);
+			cmdbuf.write(_item.m_mip);
+			cmdbuf.write(_item.m_rect);
+			cmdbuf.write(_item.m_z);
+			cmdbuf.write(_item.m_depth);
+			cmdbuf.write(_item.m_pitch);
+			cmdbuf.write(_item.m_mem);
+
+			// Command buffer of frame being submitted is executed when that frame is
+			// rendered, and bgfx::frame submitting it returns the same frame number.
+			m_textureRef[handle.idx].m_uploadFrame = m_submit->m_frameNum;
 		}
 
+		BGFX_API_FUNC(void setUploadPriority(TextureHandle _handle, UploadPriority::Enum _priority) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			BGFX_CHECK_HANDLE("setUploadPriority", m_textureHandle, _handle);
+
+			TextureRef& ref = m_textureRef[_handle.idx];
+			ref.m_uploadPriority = uint8_t(_priority);
+
+			// Updates already waiting in queue must keep their order relative
+			// to the new ones, so they are moved to the new priority too.
+			if (0 < ref.m_numPendingUploads)
+			{
+				for (uint32_t ii = 0, num = uint32_t(m_uploadQueue.size() ); ii < num; ++ii)
+				{
+					UploadItem& item = m_uploadQueue[ii];
+					if (UploadItem::Texture == item.m_type
+					&&  _handle.idx == item.m_handle)
+					{
+						item.m_priority = ref.m_uploadPriority;
+					}
+				}
+			}
+		}
+
+		BGFX_API_FUNC(uint32_t getUploadFrame(TextureHandle _handle) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			BGFX_CHECK_HANDLE("getUploadFrame", m_textureHandle, _handle);
+
+			const TextureRef& ref = m_textureRef[_handle.idx];
+			return 0 < ref.m_numPendingUploads
+				? UINT32_MAX
+				: ref.m_uploadFrame
+				;
+		}
+
+		BGFX_API_FUNC(void setTextureResidentMips(TextureHandle _handle, uint8_t _minMip) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			BGFX_CHECK_HANDLE("setTextureResidentMips", m_textureHandle, _handle);
+
+			TextureRef& ref = m_textureRef[_handle.idx];
+			_minMip = bx::min<uint8_t>(_minMip, uint8_t(ref.m_numMips-1) );
+
+			if (_minMip != ref.m_residentMip)
+			{
+				ref.m_residentMip = _minMip;
+
+				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::SetTextureResidentMips);
+				cmdbuf.write(_handle);
+				cmdbuf.write(_minMip);
+			}
+		}
+
+		BGFX_API_FUNC(uint32_t getTextureUsedFrame(TextureHandle _handle, uint8_t* _minMip) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			BGFX_CHECK_HANDLE("getTextureUsedFrame", m_textureHandle, _handle);
+
+			const TextureRef& ref = m_textureRef[_handle.idx];
+
+			if (NULL != _minMip)
+			{
+				*_minMip = ref.m_residentMip;
+			}
+
+			return ref.m_usedFrame;
+		}
+
+		bool isUploadQueueEnabled() const
+		{
+			return 0 != m_init.limits.uploadBudget;
+		}
+
+		void uploadQueueAdd(const UploadItem& _item)
+		{
+			m_uploadQueue.push_back(_item);
+			m_uploadQueueSize += _item.m_mem->size;
+		}
+
+		void uploadQueuePurge(UploadItem::Enum _type, uint16_t _handle)
+		{
+			uint32_t num = 0;
+
+			for (uint32_t ii = 0, numItems = uint32_t(m_uploadQueue.size() ); ii < numItems; ++ii)
+			{
+				const UploadItem& item = m_uploadQueue[ii];
+
+				if (_type   == item.m_type
+				&&  _handle == item.m_handle)
+				{
+					m_uploadQueueSize -= item.m_mem->size;
+					release(item.m_mem);
+				}
+				else
+				{
+					m_uploadQueue[num++] = item;
+				}
+			}
+
+			m_uploadQueue.resize(num);
+
+			if (UploadItem::Texture == _type)
+			{
+				m_textureRef[_handle].m_numPendingUploads = 0;
+			}
+		}
+
+		void uploadQueueFlush();
+
 		BGFX_API_FUNC(FrameBufferHandle createFrameBuffer(uint8_t _num, const Attachment* _attachment, bool _destroyTextures) )
 		{
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
@@ -4727,16 +5229,17 @@ namespace bgfx
 				return BGFX_INVALID_HANDLE;
 			}
 
-			FrameBufferHandle handle = { m_frameBufferHandle.alloc() };
-			BX_WARN(isValid(handle), "Failed to allocate frame buffer handle.");
+			FrameBufferHandle handle = frameBufferPoolFind(_num, _attachment);
 
-			if (isValid(handle) )
+			const bool recycled = isValid(handle);
+			if (!recycled)
 			{
-				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateFrameBuffer);
-				cmdbuf.write(handle);
-				cmdbuf.write(false);
-				cmdbuf.write(_num);
+				handle.idx = m_frameBufferHandle.alloc();
+				BX_WARN(isValid(handle), "Failed to allocate frame buffer handle.");
+			}
 
+			if (isValid(handle) )
+			{
 				const TextureRef& firstTexture = m_textureRef[_attachment[0].handle.idx];
 				const BackbufferRatio::Enum bbRatio = BackbufferRatio::Enum(firstTexture.m_bbRatio);
 
@@ -4748,7 +5251,9 @@ namespace bgfx
 				}
 
 				fbr.m_window = false;
+				fbr.m_num    = _num;
 				bx::memSet(fbr.un.m_th, 0xff, sizeof(fbr.un.m_th) );
+				bx::memCopy(fbr.m_attachment, _attachment, sizeof(Attachment) * _num);
 
 				for (uint32_t ii = 0; ii < _num; ++ii)
 				{
@@ -4757,7 +5262,14 @@ namespace bgfx
 					textureIncRef(texHandle);
 				}
 
-				cmdbuf.write(_attachment, sizeof(Attachment) * _num);
+				if (!recycled)
+				{
+					CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateFrameBuffer);
+					cmdbuf.write(handle);
+					cmdbuf.write(false);
+					cmdbuf.write(_num);
+					cmdbuf.write(_attachment, sizeof(Attachment) * _num);
+				}
 			}
 
 			if (_destroyTextures)
@@ -4832,15 +5344,26 @@ namespace bgfx
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
 
 			BGFX_CHECK_HANDLE("destroyFrameBuffer", m_frameBufferHandle, _handle);
-			bool ok = m_submit->free(_handle); BX_UNUSED(ok);
-			BX_ASSERT(ok, "Frame buffer handle %d is already destroyed!", _handle.idx);
-
-			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyFrameBuffer);
-			cmdbuf.write(_handle);
+			destroyFrameBufferInternal(_handle);
+		}
 
+		void destroyFrameBufferInternal(FrameBufferHandle _handle)
+		{
 			FrameBufferRef& fbr = m_frameBufferRef[_handle.idx];
 			fbr.m_name.clear();
 
+			if (isFrameBufferRecyclable(_handle) )
+			{
+				RecycledResource rr;
+				rr.m_frameNum = m_submit->m_frameNum;
+				rr.m_idx      = _handle.idx;
+				m_frameBufferPool.push_back(rr);
+			}
+			else
+			{
+				frameBufferDestroy(_handle);
+			}
+
 			if (!fbr.m_window)
 			{
 				for (uint32_t ii = 0; ii < BX_COUNTOF(fbr.un.m_th); ++ii)
@@ -4854,6 +5377,258 @@ namespace bgfx
 			}
 		}
 
+		void frameBufferDestroy(FrameBufferHandle _handle)
+		{
+			bool ok = m_submit->free(_handle); BX_UNUSED(ok);
+			BX_ASSERT(ok, "Frame buffer handle %d is already destroyed!", _handle.idx);
+
+			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyFrameBuffer);
+			cmdbuf.write(_handle);
+		}
+
+		bool isFrameBufferRecyclable(FrameBufferHandle _handle) const
+		{
+			const FrameBufferRef& fbr = m_frameBufferRef[_handle.idx];
+
+			if (0 == BGFX_CONFIG_RECYCLE_POOL_MAX_AGE
+			||  fbr.m_window)
+			{
+				return false;
+			}
+
+			// Every attachment must stay alive, or go into texture pool.
+			for (uint32_t ii = 0; ii < fbr.m_num; ++ii)
+			{
+				const TextureRef& ref = m_textureRef[fbr.un.m_th[ii].idx];
+				if (1 == ref.m_refCount
+				&&  !ref.m_recyclable)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		FrameBufferHandle frameBufferPoolFind(uint8_t _num, const Attachment* _attachment)
+		{
+			if (0 == BGFX_CONFIG_RECYCLE_POOL_MAX_AGE)
+			{
+				return BGFX_INVALID_HANDLE;
+			}
+
+			for (uint32_t ii = 0, num = uint32_t(m_frameBufferPool.size() ); ii < num; ++ii)
+			{
+				const RecycledResource& rr = m_frameBufferPool[ii];
+
+				// Frame buffer destroyed this frame can still be used by this frame's views.
+				if (rr.m_frameNum == m_submit->m_frameNum)
+				{
+					continue;
+				}
+
+				const FrameBufferHandle handle = { rr.m_idx };
+				const FrameBufferRef& fbr = m_frameBufferRef[handle.idx];
+
+				bool match = fbr.m_num == _num;
+				for (uint32_t jj = 0; jj < _num && match; ++jj)
+				{
+					const Attachment& at = fbr.m_attachment[jj];
+					const Attachment& other = _attachment[jj];
+					match = at.access    == other.access
+						&&  at.handle.idx == other.handle.idx
+						&&  at.mip       == other.mip
+						&&  at.layer     == other.layer
+						&&  at.numLayers == other.numLayers
+						&&  at.resolve   == other.resolve
+						;
+				}
+
+				if (match)
+				{
+					m_frameBufferPool[ii] = m_frameBufferPool[num-1];
+					m_frameBufferPool.pop_back();
+					++m_numRecycleHits;
+					return handle;
+				}
+			}
+
+			++m_numRecycleMisses;
+			return BGFX_INVALID_HANDLE;
+		}
+
+		void frameBufferPoolPurge(TextureHandle _handle)
+		{
+			uint32_t dst = 0;
+			for (uint32_t ii = 0, num = uint32_t(m_frameBufferPool.size() ); ii < num; ++ii)
+			{
+				const RecycledResource& rr = m_frameBufferPool[ii];
+				const FrameBufferRef& fbr = m_frameBufferRef[rr.m_idx];
+
+				bool attached = false;
+				for (uint32_t jj = 0; jj < fbr.m_num; ++jj)
+				{
+					attached |= fbr.un.m_th[jj].idx == _handle.idx;
+				}
+
+				if (attached)
+				{
+					const FrameBufferHandle handle = { rr.m_idx };
+					frameBufferDestroy(handle);
+				}
+				else
+				{
+					m_frameBufferPool[dst++] = rr;
+				}
+			}
+
+			m_frameBufferPool.resize(dst);
+		}
+
+		void recyclePoolGc(bool _all)
+		{
+			const uint32_t frameNum = m_submit->m_frameNum;
+
+			// Frame buffers first, they reference textures from pool.
+			uint32_t dst = 0;
+			for (uint32_t ii = 0, num = uint32_t(m_frameBufferPool.size() ); ii < num; ++ii)
+			{
+				const RecycledResource& rr = m_frameBufferPool[ii];
+
+				if (_all
+				||  frameNum - rr.m_frameNum >= BGFX_CONFIG_RECYCLE_POOL_MAX_AGE)
+				{
+					const FrameBufferHandle handle = { rr.m_idx };
+					frameBufferDestroy(handle);
+				}
+				else
+				{
+					m_frameBufferPool[dst++] = rr;
+				}
+			}
+
+			m_frameBufferPool.resize(dst);
+
+			dst = 0;
+			for (uint32_t ii = 0, num = uint32_t(m_texturePool.size() ); ii < num; ++ii)
+			{
+				const RecycledResource& rr = m_texturePool[ii];
+
+				if (_all
+				||  frameNum - rr.m_frameNum >= BGFX_CONFIG_RECYCLE_POOL_MAX_AGE)
+				{
+					const TextureHandle handle = { rr.m_idx };
+					textureDestroy(handle);
+				}
+				else
+				{
+					m_texturePool[dst++] = rr;
+				}
+			}
+
+			m_texturePool.resize(dst);
+		}
+
+		void getViewLifetime(ViewId _firstView, ViewId _lastView, uint16_t& _first, uint16_t& _last) const
+		{
+			ViewId viewRemap[BGFX_CONFIG_MAX_VIEWS];
+			for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_VIEWS; ++ii)
+			{
+				viewRemap[m_viewRemap[ii] ] = ViewId(ii);
+			}
+
+			_first = UINT16_MAX;
+			_last  = 0;
+
+			for (uint32_t ii = _firstView; ii <= _lastView; ++ii)
+			{
+				_first = bx::min<uint16_t>(_first, viewRemap[ii]);
+				_last  = bx::max<uint16_t>(_last,  viewRemap[ii]);
+			}
+		}
+
+		BGFX_API_FUNC(FrameBufferHandle transientFrameBufferFind(uint16_t _width, uint16_t _height, TextureFormat::Enum _format, uint64_t _flags, ViewId _firstView, ViewId _lastView) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			uint16_t first, last;
+			getViewLifetime(_firstView, _lastView, first, last);
+
+			const uint32_t frameNum = m_submit->m_frameNum;
+
+			for (uint32_t ii = 0, num = uint32_t(m_transientFrameBuffers.size() ); ii < num; ++ii)
+			{
+				TransientFrameBuffer& tfb = m_transientFrameBuffers[ii];
+
+				if (tfb.m_width  == _width
+				&&  tfb.m_height == _height
+				&&  tfb.m_format == _format
+				&&  tfb.m_flags  == _flags)
+				{
+					if (tfb.m_lastFrame != frameNum)
+					{
+						tfb.m_lastFrame = frameNum;
+						bx::memSet(tfb.m_views, 0, sizeof(tfb.m_views) );
+					}
+
+					// Views that use target don't overlap with requested
+					// lifetime, target memory is aliased.
+					if (tfb.isAvailable(first, last) )
+					{
+						tfb.setViews(first, last);
+						++m_numTransientFrameBufferAllocs;
+						return tfb.m_handle;
+					}
+				}
+			}
+
+			return BGFX_INVALID_HANDLE;
+		}
+
+		BGFX_API_FUNC(void transientFrameBufferAdd(FrameBufferHandle _handle, uint16_t _width, uint16_t _height, TextureFormat::Enum _format, uint64_t _flags, ViewId _firstView, ViewId _lastView) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			uint16_t first, last;
+			getViewLifetime(_firstView, _lastView, first, last);
+
+			TransientFrameBuffer tfb;
+			tfb.m_handle    = _handle;
+			tfb.m_flags     = _flags;
+			tfb.m_lastFrame = m_submit->m_frameNum;
+			tfb.m_width     = _width;
+			tfb.m_height    = _height;
+			tfb.m_format    = uint8_t(_format);
+			bx::memSet(tfb.m_views, 0, sizeof(tfb.m_views) );
+			tfb.setViews(first, last);
+
+			m_transientFrameBuffers.push_back(tfb);
+			++m_numTransientFrameBufferAllocs;
+		}
+
+		void transientFrameBufferGc(bool _all)
+		{
+			const uint32_t frameNum = m_submit->m_frameNum;
+
+			uint32_t dst = 0;
+			for (uint32_t ii = 0, num = uint32_t(m_transientFrameBuffers.size() ); ii < num; ++ii)
+			{
+				const TransientFrameBuffer& tfb = m_transientFrameBuffers[ii];
+
+				if (_all
+				||  frameNum - tfb.m_lastFrame >= BGFX_CONFIG_TRANSIENT_FRAME_BUFFER_MAX_AGE)
+				{
+					destroyFrameBufferInternal(tfb.m_handle);
+				}
+				else
+				{
+					m_transientFrameBuffers[dst++] = tfb;
+				}
+			}
+
+			m_transientFrameBuffers.resize(dst);
+		}
+
 		BGFX_API_FUNC(UniformHandle createUniform(const char* _name, UniformType::Enum _type, uint16_t _num) )
 		{
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
@@ -5150,6 +5925,11 @@ namespace bgfx
 
 		BGFX_API_FUNC(uint32_t frame(bool _capture = false) );
 
+		BGFX_API_FUNC(uint32_t getGpuCompletedFrame() )
+		{
+			return bx::atomicFetchAndAdd<uint32_t>(&m_gpuCompletedFrame, 0);
+		}
+
 		uint32_t getSeqIncr(ViewId _id)
 		{
 			return bx::atomicFetchAndAdd<uint32_t>(&m_seq[_id], 1);
@@ -5185,11 +5965,14 @@ namespace bgfx
 
 			BGFX_PROFILER_SCOPE("bgfx/API thread wait", 0xff2040ff);
 			int64_t start = bx::getHPCounter();
-			bool ok = m_apiSem.wait(_msecs);
+			bool ok = m_apiSem.wait(_msecs, m_handoffSpin);
 			if (ok)
 			{
-				m_render->m_waitSubmit = bx::getHPCounter()-start;
-				m_submit->m_perfStats.waitSubmit = m_submit->m_waitSubmit;
+				const int64_t now = bx::getHPCounter();
+				m_render->m_waitSubmit    = now-start;
+				m_render->m_handoffSubmit = now-bx::max(start, m_apiSem.getPostTime() );
+				m_submit->m_perfStats.waitSubmit    = m_submit->m_waitSubmit;
+				m_submit->m_perfStats.handoffSubmit = m_submit->m_handoffSubmit;
 				return true;
 			}
 
@@ -5210,10 +5993,13 @@ namespace bgfx
 			{
 				BGFX_PROFILER_SCOPE("bgfx/Render thread wait", 0xff2040ff);
 				int64_t start = bx::getHPCounter();
-				bool ok = m_renderSem.wait();
+				bool ok = m_renderSem.wait(-1, m_handoffSpin);
 				BX_ASSERT(ok, "Semaphore wait failed."); BX_UNUSED(ok);
-				m_submit->m_waitRender = bx::getHPCounter() - start;
-				m_submit->m_perfStats.waitRender = m_submit->m_waitRender;
+				const int64_t now = bx::getHPCounter();
+				m_submit->m_waitRender    = now - start;
+				m_submit->m_handoffRender = now - bx::max(start, m_renderSem.getPostTime() );
+				m_submit->m_perfStats.waitRender    = m_submit->m_waitRender;
+				m_submit->m_perfStats.handoffRender = m_submit->m_handoffRender;
 			}
 		}
 
@@ -5240,8 +6026,8 @@ namespace bgfx
 			BX_ASSERT(0 == idx, "Internal encoder handle is not 0 (idx %d).", idx); BX_UNUSED(idx);
 		}
 
-		bx::Semaphore m_renderSem;
-		bx::Semaphore m_apiSem;
+		HandoffSemaphore m_renderSem;
+		HandoffSemaphore m_apiSem;
 		bx::Semaphore m_encoderEndSem;
 		bx::Mutex     m_encoderApiLock;
 		bx::Mutex     m_resourceApiLock;
@@ -5342,11 +6128,27 @@ namespace bgfx
 		Init     m_init;
 		int64_t  m_frameTimeLast;
 		uint32_t m_frames;
+		uint32_t m_gpuCompletedFrame; // Written by render thread after submit, read by API thread, access atomically.
 		uint32_t m_debug;
 
 		int64_t m_rtMemoryUsed;
 		int64_t m_textureMemoryUsed;
 
+		typedef stl::vector<UploadItem> UploadQueue;
+		UploadQueue m_uploadQueue;
+		uint32_t    m_uploadQueueSize;
+
+		typedef stl::vector<TransientFrameBuffer> TransientFrameBufferPool;
+		TransientFrameBufferPool m_transientFrameBuffers;
+		uint32_t m_numTransientFrameBufferAllocs;
+
+		typedef stl::vector<RecycledResource> RecyclePool;
+		RecyclePool m_texturePool;
+		RecyclePool m_frameBufferPool;
+
+		uint32_t m_numRecycleHits;
+		uint32_t m_numRecycleMisses;
+
 		TextVideoMemBlitter m_textVideoMemBlitter;
 		ClearQuad m_clearQuad;
 
@@ -5357,6 +6159,7 @@ namespace bgfx
 		bool m_flipAfterRender;
 		bool m_singleThreaded;
 		bool m_flipped;
+		int64_t m_handoffSpin;
 
 		typedef UpdateBatchT<256> TextureUpdateBatch;
 		BX_ALIGN_DECL_CACHE_LINE(TextureUpdateBatch m_textureUpdateBatch);
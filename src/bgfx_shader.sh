@@ -36,6 +36,15 @@
 #	define ARRAY_END() }
 #endif // BGFX_SHADER_LANGUAGE_GLSL
 
+// Specialization constant, value can be overridden with bgfx::createProgram
+// on renderers that support it (Vulkan), elsewhere it's regular constant with
+// default value.
+#if BGFX_SHADER_LANGUAGE_SPIRV
+#	define SPECIALIZATION_CONSTANT(_id, _type, _name, _default) [[vk::constant_id(_id)]] const _type _name = _default
+#else
+#	define SPECIALIZATION_CONSTANT(_id, _type, _name, _default) CONST(_type _name) = _default
+#endif // BGFX_SHADER_LANGUAGE_SPIRV
+
 #if BGFX_SHADER_LANGUAGE_HLSL \
  || BGFX_SHADER_LANGUAGE_PSSL \
  || BGFX_SHADER_LANGUAGE_SPIRV \
@@ -311,6 +311,11 @@ BX_STATIC_ASSERT(bx::isPowerOf2(BGFX_CONFIG_MAX_VIEWS), "BGFX_CONFIG_MAX_VIEWS m
 #	define BGFX_CONFIG_MAX_TEXTURE_SAMPLERS 16
 #endif // BGFX_CONFIG_MAX_TEXTURE_SAMPLERS
 
+/// Maximum number of specialization constants per program.
+#ifndef BGFX_CONFIG_MAX_SPECIALIZATION_CONSTANTS
+#	define BGFX_CONFIG_MAX_SPECIALIZATION_CONSTANTS 16
+#endif // BGFX_CONFIG_MAX_SPECIALIZATION_CONSTANTS
+
 #ifndef BGFX_CONFIG_MAX_FRAME_BUFFERS
 #	define BGFX_CONFIG_MAX_FRAME_BUFFERS 128
 #endif // BGFX_CONFIG_MAX_FRAME_BUFFERS
@@ -339,6 +344,100 @@ BX_STATIC_ASSERT(bx::isPowerOf2(BGFX_CONFIG_MAX_VIEWS), "BGFX_CONFIG_MAX_VIEWS m
 #	define BGFX_CONFIG_TRANSIENT_INDEX_BUFFER_SIZE (2<<20)
 #endif // BGFX_CONFIG_TRANSIENT_INDEX_BUFFER_SIZE
 
+/// Maximum number of bytes of texture updates issued to renderer per frame.
+/// When 0, updates are issued in the frame they were requested. Dynamic buffer
+/// updates are always issued in the frame they were requested.
+#ifndef BGFX_CONFIG_UPLOAD_BUDGET
+#	define BGFX_CONFIG_UPLOAD_BUDGET 0
+#endif // BGFX_CONFIG_UPLOAD_BUDGET
+
+/// Time in microseconds API and render threads spin waiting for each other at
+/// frame handoff before blocking on semaphore. Default for
+/// `Init::handoffSpin`.
+#ifndef BGFX_CONFIG_HANDOFF_SPIN
+#	define BGFX_CONFIG_HANDOFF_SPIN 0
+#endif // BGFX_CONFIG_HANDOFF_SPIN
+
+/// Number of frames render target backing transient frame buffers is kept
+/// alive after it was last allocated.
+#ifndef BGFX_CONFIG_TRANSIENT_FRAME_BUFFER_MAX_AGE
+#	define BGFX_CONFIG_TRANSIENT_FRAME_BUFFER_MAX_AGE 4
+#endif // BGFX_CONFIG_TRANSIENT_FRAME_BUFFER_MAX_AGE
+
+/// Number of frames destroyed textures and frame buffers are kept for reuse
+/// by create calls with matching description. When 0, resources are destroyed
+/// immediately.
+#ifndef BGFX_CONFIG_RECYCLE_POOL_MAX_AGE
+#	define BGFX_CONFIG_RECYCLE_POOL_MAX_AGE 8
+#endif // BGFX_CONFIG_RECYCLE_POOL_MAX_AGE
+
+/// Number of frames without new pipeline state being created after which
+/// renderers that keep single pipeline cache blob write it out via
+/// `CallbackI::cacheWrite`. Cache is also written at shutdown.
+#ifndef BGFX_CONFIG_PIPELINE_CACHE_SAVE_IDLE_FRAMES
+#	define BGFX_CONFIG_PIPELINE_CACHE_SAVE_IDLE_FRAMES 60
+#endif // BGFX_CONFIG_PIPELINE_CACHE_SAVE_IDLE_FRAMES
+
+/// Number of worker threads compiling pipeline states requested by
+/// `bgfx::precachePipelines`. When 0, pipelines are compiled on render thread
+/// while processing the request.
+#ifndef BGFX_CONFIG_PIPELINE_PRECACHE_NUM_THREADS
+#	define BGFX_CONFIG_PIPELINE_PRECACHE_NUM_THREADS 2
+#endif // BGFX_CONFIG_PIPELINE_PRECACHE_NUM_THREADS
+
+/// Present frames on separate thread, so that present of previous frame, and
+/// waiting for vsync, overlaps with translation of the next frame on render
+/// thread up to the first render pass into that window, since swap chain
+/// image can't be acquired before previous present is done. Currently only
+/// Vulkan renderer implements it.
+#ifndef BGFX_CONFIG_PRESENT_THREAD
+#	define BGFX_CONFIG_PRESENT_THREAD 0
+#endif // BGFX_CONFIG_PRESENT_THREAD
+
+/// Size of device memory block from which buffers and images are sub-allocated.
+#ifndef BGFX_CONFIG_DEVICE_MEMORY_BLOCK_SIZE
+#	define BGFX_CONFIG_DEVICE_MEMORY_BLOCK_SIZE (64<<20)
+#endif // BGFX_CONFIG_DEVICE_MEMORY_BLOCK_SIZE
+
+/// Resources at least this large get their own device memory allocation
+/// instead of being sub-allocated from block. Resources for which driver
+/// prefers dedicated allocation (VK_KHR_dedicated_allocation) get their own
+/// allocation regardless of size.
+#ifndef BGFX_CONFIG_DEVICE_MEMORY_DEDICATED_SIZE
+#	define BGFX_CONFIG_DEVICE_MEMORY_DEDICATED_SIZE (16<<20)
+#endif // BGFX_CONFIG_DEVICE_MEMORY_DEDICATED_SIZE
+
+/// Size of persistently mapped staging ring used for buffer and texture uploads.
+/// Ring is split between frames in flight, uploads that don't fit into frame's
+/// part of the ring use temporary staging buffer.
+#ifndef BGFX_CONFIG_STAGING_RING_SIZE
+#	define BGFX_CONFIG_STAGING_RING_SIZE (64<<20)
+#endif // BGFX_CONFIG_STAGING_RING_SIZE
+
+/// Size of uniform buffer ring used by OpenGL renderer to upload std140 uniform
+/// blocks. Used when built with `BGFX_CONFIG_RENDERER_OPENGL >= 31`, or on GLES 3.0+
+/// context. Set to 0 to use per-uniform `glUniform*` calls.
+#ifndef BGFX_CONFIG_UNIFORM_BUFFER_RING_SIZE
+#	define BGFX_CONFIG_UNIFORM_BUFFER_RING_SIZE (1<<20)
+#endif // BGFX_CONFIG_UNIFORM_BUFFER_RING_SIZE
+
+/// Number of chunks in linear arena used for small `bgfx::alloc` / `bgfx::copy`
+/// blocks. Chunk is reused once all blocks allocated from it are released. When
+/// 0, all blocks are allocated from heap.
+#ifndef BGFX_CONFIG_MEMORY_ARENA_NUM_CHUNKS
+#	define BGFX_CONFIG_MEMORY_ARENA_NUM_CHUNKS 4
+#endif // BGFX_CONFIG_MEMORY_ARENA_NUM_CHUNKS
+
+/// Size of single memory arena chunk.
+#ifndef BGFX_CONFIG_MEMORY_ARENA_CHUNK_SIZE
+#	define BGFX_CONFIG_MEMORY_ARENA_CHUNK_SIZE (1<<20)
+#endif // BGFX_CONFIG_MEMORY_ARENA_CHUNK_SIZE
+
+/// Blocks larger than this are always allocated from heap.
+#ifndef BGFX_CONFIG_MEMORY_ARENA_MAX_ALLOC_SIZE
+#	define BGFX_CONFIG_MEMORY_ARENA_MAX_ALLOC_SIZE (64<<10)
+#endif // BGFX_CONFIG_MEMORY_ARENA_MAX_ALLOC_SIZE
+
 #ifndef BGFX_CONFIG_MAX_INSTANCE_DATA_COUNT
 #	define BGFX_CONFIG_MAX_INSTANCE_DATA_COUNT 5
 #endif // BGFX_CONFIG_MAX_INSTANCE_DATA_COUNT
@@ -21,12 +21,17 @@ namespace bgfx { namespace gl
 #	define EGL_CONTEXT_FLAG_NO_ERROR_BIT_KHR 0x00000008
 #endif // EGL_CONTEXT_FLAG_NO_ERROR_BIT_KHR
 
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#	define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif // EGL_PLATFORM_SURFACELESS_MESA
+
 #if BGFX_USE_GL_DYNAMIC_LIB
 
 	typedef void (*EGLPROC)(void);
 
 	typedef EGLBoolean  (EGLAPIENTRY* PFNEGLCHOOSECONFIGPROC)(EGLDisplay dpy, const EGLint *attrib_list,	EGLConfig *configs, EGLint config_size,	EGLint *num_config);
 	typedef EGLContext  (EGLAPIENTRY* PFNEGLCREATECONTEXTPROC)(EGLDisplay dpy, EGLConfig config, EGLContext share_context, const EGLint *attrib_list);
+	typedef EGLSurface  (EGLAPIENTRY* PFNEGLCREATEPBUFFERSURFACEPROC)(EGLDisplay dpy, EGLConfig config, const EGLint *attrib_list);
 	typedef EGLSurface  (EGLAPIENTRY* PFNEGLCREATEWINDOWSURFACEPROC)(EGLDisplay dpy, EGLConfig config, EGLNativeWindowType win, const EGLint *attrib_list);
 	typedef EGLint      (EGLAPIENTRY* PFNEGLGETERRORPROC)(void);
 	typedef EGLDisplay  (EGLAPIENTRY* PFNEGLGETDISPLAYPROC)(EGLNativeDisplayType display_id);
@@ -41,20 +46,21 @@ namespace bgfx { namespace gl
 	typedef EGLBoolean  (EGLAPIENTRY* PFNEGLTERMINATEPROC)(EGLDisplay dpy);
 
 #define EGL_IMPORT                                                          \
-	EGL_IMPORT_FUNC(PFNEGLCHOOSECONFIGPROC,        eglChooseConfig);        \
-	EGL_IMPORT_FUNC(PFNEGLCREATECONTEXTPROC,       eglCreateContext);       \
-	EGL_IMPORT_FUNC(PFNEGLCREATEWINDOWSURFACEPROC, eglCreateWindowSurface); \
-	EGL_IMPORT_FUNC(PFNEGLGETDISPLAYPROC,          eglGetDisplay);          \
-	EGL_IMPORT_FUNC(PFNEGLGETERRORPROC,            eglGetError);            \
-	EGL_IMPORT_FUNC(PFNEGLGETPROCADDRESSPROC,      eglGetProcAddress);      \
-	EGL_IMPORT_FUNC(PFNEGLDESTROYCONTEXTPROC,      eglDestroyContext);      \
-	EGL_IMPORT_FUNC(PFNEGLDESTROYSURFACEPROC,      eglDestroySurface);      \
-	EGL_IMPORT_FUNC(PFNEGLINITIALIZEPROC,          eglInitialize);          \
-	EGL_IMPORT_FUNC(PFNEGLMAKECURRENTPROC,         eglMakeCurrent);         \
-	EGL_IMPORT_FUNC(PGNEGLQUERYSTRINGPROC,         eglQueryString);         \
-	EGL_IMPORT_FUNC(PFNEGLSWAPBUFFERSPROC,         eglSwapBuffers);         \
-	EGL_IMPORT_FUNC(PFNEGLSWAPINTERVALPROC,        eglSwapInterval);        \
-	EGL_IMPORT_FUNC(PFNEGLTERMINATEPROC,           eglTerminate);
+	EGL_IMPORT_FUNC(PFNEGLCHOOSECONFIGPROC,         eglChooseConfig);         \
+	EGL_IMPORT_FUNC(PFNEGLCREATECONTEXTPROC,        eglCreateContext);        \
+	EGL_IMPORT_FUNC(PFNEGLCREATEPBUFFERSURFACEPROC, eglCreatePbufferSurface); \
+	EGL_IMPORT_FUNC(PFNEGLCREATEWINDOWSURFACEPROC,  eglCreateWindowSurface);  \
+	EGL_IMPORT_FUNC(PFNEGLGETDISPLAYPROC,           eglGetDisplay);           \
+	EGL_IMPORT_FUNC(PFNEGLGETERRORPROC,             eglGetError);             \
+	EGL_IMPORT_FUNC(PFNEGLGETPROCADDRESSPROC,       eglGetProcAddress);       \
+	EGL_IMPORT_FUNC(PFNEGLDESTROYCONTEXTPROC,       eglDestroyContext);       \
+	EGL_IMPORT_FUNC(PFNEGLDESTROYSURFACEPROC,       eglDestroySurface);       \
+	EGL_IMPORT_FUNC(PFNEGLINITIALIZEPROC,           eglInitialize);           \
+	EGL_IMPORT_FUNC(PFNEGLMAKECURRENTPROC,          eglMakeCurrent);          \
+	EGL_IMPORT_FUNC(PGNEGLQUERYSTRINGPROC,          eglQueryString);          \
+	EGL_IMPORT_FUNC(PFNEGLSWAPBUFFERSPROC,          eglSwapBuffers);          \
+	EGL_IMPORT_FUNC(PFNEGLSWAPINTERVALPROC,         eglSwapInterval);         \
+	EGL_IMPORT_FUNC(PFNEGLTERMINATEPROC,            eglTerminate);
 
 #define EGL_IMPORT_FUNC(_proto, _func) _proto _func
 EGL_IMPORT
@@ -101,6 +107,14 @@ EGL_IMPORT
 
 	static EGLint s_contextAttrs[16];
 
+	static GLenum getFboColorFormat(uint32_t _flags)
+	{
+		return 0 != (_flags & BGFX_RESET_SRGB_BACKBUFFER)
+			? GL_SRGB8_ALPHA8
+			: GL_RGBA8
+			;
+	}
+
 	struct SwapChainGL
 	{
 		SwapChainGL(EGLDisplay _display, EGLConfig _config, EGLContext _context, EGLNativeWindowType _nwh)
@@ -163,6 +177,13 @@ EGL_IMPORT
 
 		m_eglLibrary = eglOpen();
 
+		// Without native window render into FBO back buffer (CI, benchmarking on GPU-less machines).
+		const bool headless = true
+			&& !BX_ENABLED(BX_PLATFORM_ANDROID || BX_PLATFORM_RPI)
+			&& NULL == g_platformData.context
+			&& NULL == g_platformData.nwh
+			;
+
 		if (NULL == g_platformData.context)
 		{
 #	if BX_PLATFORM_RPI
@@ -174,13 +195,46 @@ EGL_IMPORT
 			EGLNativeWindowType  nwh = (EGLNativeWindowType )g_platformData.nwh;
 
 #	if BX_PLATFORM_WINDOWS
-			if (NULL == g_platformData.ndt)
+			if (NULL == g_platformData.ndt
+			&&  !headless)
 			{
 				ndt = GetDC( (HWND)g_platformData.nwh);
 			}
 #	endif // BX_PLATFORM_WINDOWS
 
-			m_display = eglGetDisplay(ndt);
+			m_display = EGL_NO_DISPLAY;
+
+			if (headless)
+			{
+				// https://registry.khronos.org/EGL/extensions/MESA/EGL_MESA_platform_surfaceless.txt
+				const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+				const bool hasEglMesaPlatformSurfaceless = true
+					&& NULL != clientExtensions
+					&& !bx::findIdentifierMatch(clientExtensions, "EGL_MESA_platform_surfaceless").isEmpty()
+					;
+
+				PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = hasEglMesaPlatformSurfaceless
+					? (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT")
+					: NULL
+					;
+
+				if (NULL != getPlatformDisplay)
+				{
+					m_display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+					BX_TRACE("Headless: EGL_MESA_platform_surfaceless display %p.", m_display);
+				}
+
+				if (EGL_NO_DISPLAY == m_display)
+				{
+					ndt = EGL_DEFAULT_DISPLAY;
+				}
+			}
+
+			if (EGL_NO_DISPLAY == m_display)
+			{
+				m_display = eglGetDisplay(ndt);
+			}
+
 			BGFX_FATAL(m_display != EGL_NO_DISPLAY, Fatal::UnableToInitialize, "Failed to create display %p", m_display);
 
 			EGLint major = 0;
@@ -216,6 +270,7 @@ EGL_IMPORT
 			EGLint attrs[] =
 			{
 				EGL_RENDERABLE_TYPE, (gles >= 30) ? EGL_OPENGL_ES3_BIT_KHR : EGL_OPENGL_ES2_BIT,
+				EGL_SURFACE_TYPE, headless ? EGL_PBUFFER_BIT : EGL_WINDOW_BIT,
 
 				EGL_BLUE_SIZE, 8,
 				EGL_GREEN_SIZE, 8,
@@ -274,8 +329,36 @@ EGL_IMPORT
 			vc_dispmanx_update_submit_sync(dispmanUpdate);
 #	endif // BX_PLATFORM_ANDROID
 
-			m_surface = eglCreateWindowSurface(m_display, m_config, nwh, NULL);
-			BGFX_FATAL(m_surface != EGL_NO_SURFACE, Fatal::UnableToInitialize, "Failed to create surface.");
+			if (headless)
+			{
+				// https://registry.khronos.org/EGL/extensions/KHR/EGL_KHR_surfaceless_context.txt
+				const bool hasEglKhrSurfacelessContext = !bx::findIdentifierMatch(extensions, "EGL_KHR_surfaceless_context").isEmpty();
+
+				if (hasEglKhrSurfacelessContext)
+				{
+					m_surface = EGL_NO_SURFACE;
+				}
+				else
+				{
+					// Surface is never presented, it only needs to satisfy eglMakeCurrent.
+					const EGLint pbufferAttrs[] =
+					{
+						EGL_WIDTH,  1,
+						EGL_HEIGHT, 1,
+						EGL_NONE
+					};
+
+					m_surface = eglCreatePbufferSurface(m_display, m_config, pbufferAttrs);
+					BGFX_FATAL(m_surface != EGL_NO_SURFACE, Fatal::UnableToInitialize, "Failed to create pbuffer surface.");
+				}
+
+				BX_TRACE("Headless: %s.", hasEglKhrSurfacelessContext ? "surfaceless context" : "pbuffer surface");
+			}
+			else
+			{
+				m_surface = eglCreateWindowSurface(m_display, m_config, nwh, NULL);
+				BGFX_FATAL(m_surface != EGL_NO_SURFACE, Fatal::UnableToInitialize, "Failed to create surface.");
+			}
 
 			const bool hasEglKhrCreateContext = !bx::findIdentifierMatch(extensions, "EGL_KHR_create_context").isEmpty();
 			const bool hasEglKhrNoError       = !bx::findIdentifierMatch(extensions, "EGL_KHR_create_context_no_error").isEmpty();
@@ -343,16 +426,28 @@ EGL_IMPORT
 
 		import();
 
+		if (headless)
+		{
+			createFbo(_width, _height, _flags);
+		}
+
 		g_internalData.context = m_context;
 	}
 
 	void GlContext::destroy()
 	{
+		destroyFbo();
+
 		if (NULL != m_display)
 		{
 			eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
 			eglDestroyContext(m_display, m_context);
-			eglDestroySurface(m_display, m_surface);
+
+			if (EGL_NO_SURFACE != m_surface)
+			{
+				eglDestroySurface(m_display, m_surface);
+			}
+
 			eglTerminate(m_display);
 			m_context = NULL;
 		}
@@ -384,10 +479,18 @@ EGL_IMPORT
 #	elif BX_PLATFORM_EMSCRIPTEN
 		EMSCRIPTEN_CHECK(emscripten_set_canvas_element_size(HTML5_TARGET_CANVAS_SELECTOR, _width, _height) );
 #	else
-		BX_UNUSED(_width, _height);
+		if (0 != m_fbo)
+		{
+			GL_CHECK(glBindRenderbuffer(GL_RENDERBUFFER, m_colorRbo) );
+			GL_CHECK(glRenderbufferStorage(GL_RENDERBUFFER, getFboColorFormat(_flags), _width, _height) );
+			GL_CHECK(glBindRenderbuffer(GL_RENDERBUFFER, m_depthStencilRbo) );
+			GL_CHECK(glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, _width, _height) );
+			GL_CHECK(glBindRenderbuffer(GL_RENDERBUFFER, 0) );
+		}
 #	endif // BX_PLATFORM_*
 
-		if (NULL != m_display)
+		if (NULL != m_display
+		&&  0    == m_fbo)
 		{
 			bool vsync = !!(_flags&BGFX_RESET_VSYNC);
 			eglSwapInterval(m_display, vsync ? 1 : 0);
@@ -422,7 +525,8 @@ EGL_IMPORT
 
 		if (NULL == _swapChain)
 		{
-			if (NULL != m_display)
+			if (NULL != m_display
+			&&  0    == m_fbo)
 			{
 				eglSwapBuffers(m_display, m_surface);
 			}
@@ -453,6 +557,59 @@ EGL_IMPORT
 		}
 	}
 
+	void GlContext::createFbo(uint32_t _width, uint32_t _height, uint32_t _flags)
+	{
+		GL_CHECK(glGenFramebuffers(1, &m_fbo) );
+		GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_fbo) );
+
+		GL_CHECK(glGenRenderbuffers(1, &m_colorRbo) );
+		GL_CHECK(glBindRenderbuffer(GL_RENDERBUFFER, m_colorRbo) );
+		GL_CHECK(glRenderbufferStorage(GL_RENDERBUFFER, getFboColorFormat(_flags), _width, _height) );
+		GL_CHECK(glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_colorRbo) );
+
+		GL_CHECK(glGenRenderbuffers(1, &m_depthStencilRbo) );
+		GL_CHECK(glBindRenderbuffer(GL_RENDERBUFFER, m_depthStencilRbo) );
+		GL_CHECK(glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, _width, _height) );
+		GL_CHECK(glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_depthStencilRbo) );
+		GL_CHECK(glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, m_depthStencilRbo) );
+
+		BX_ASSERT(GL_FRAMEBUFFER_COMPLETE == glCheckFramebufferStatus(GL_FRAMEBUFFER)
+			, "glCheckFramebufferStatus failed 0x%08x"
+			, glCheckFramebufferStatus(GL_FRAMEBUFFER)
+			);
+
+		GL_CHECK(glBindRenderbuffer(GL_RENDERBUFFER, 0) );
+
+		BX_TRACE("Headless back buffer: %d x %d%s, FBO %d."
+			, _width
+			, _height
+			, 0 != (_flags & BGFX_RESET_SRGB_BACKBUFFER) ? " sRGB" : ""
+			, m_fbo
+			);
+	}
+
+	void GlContext::destroyFbo()
+	{
+		if (0 != m_fbo)
+		{
+			GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, 0) );
+			GL_CHECK(glDeleteFramebuffers(1, &m_fbo) );
+			m_fbo = 0;
+		}
+
+		if (0 != m_colorRbo)
+		{
+			GL_CHECK(glDeleteRenderbuffers(1, &m_colorRbo) );
+			m_colorRbo = 0;
+		}
+
+		if (0 != m_depthStencilRbo)
+		{
+			GL_CHECK(glDeleteRenderbuffers(1, &m_depthStencilRbo) );
+			m_depthStencilRbo = 0;
+		}
+	}
+
 	void GlContext::import()
 	{
 		BX_TRACE("Import:");
@@ -26,6 +26,9 @@ namespace bgfx { namespace gl
 			, m_context(NULL)
 			, m_display(NULL)
 			, m_surface(NULL)
+			, m_fbo(0)
+			, m_colorRbo(0)
+			, m_depthStencilRbo(0)
 			, m_msaaContext(false)
 		{
 		}
@@ -41,6 +44,13 @@ namespace bgfx { namespace gl
 		void makeCurrent(SwapChainGL* _swapChain = NULL);
 
 		void import();
+		void createFbo(uint32_t _width, uint32_t _height, uint32_t _flags);
+		void destroyFbo();
+
+		GLuint getFbo()
+		{
+			return m_fbo;
+		}
 
 		bool isValid() const
 		{
@@ -53,6 +63,12 @@ namespace bgfx { namespace gl
 		EGLContext m_context;
 		EGLDisplay m_display;
 		EGLSurface m_surface;
+
+		// Headless back buffer, used when there is no native window.
+		GLuint m_fbo;
+		GLuint m_colorRbo;
+		GLuint m_depthStencilRbo;
+
 		// true when MSAA is handled by the context instead of using MSAA FBO
 		bool m_msaaContext;
 	};
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2011-2023 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#ifndef BGFX_HANDOFFSEMAPHORE_H_HEADER_GUARD
+#define BGFX_HANDOFFSEMAPHORE_H_HEADER_GUARD
+
+#include <bx/cpu.h>
+#include <bx/semaphore.h>
+#include <bx/timer.h>
+
+namespace bgfx
+{
+	// Frame handoff semaphore between API and render thread. Waiter spins for a
+	// bounded time before blocking on OS semaphore, to avoid OS wake-up latency
+	// when the other thread posts shortly after. Supports only single waiter.
+	//
+	// m_count is number of available posts, or -1 while waiter is blocked on OS
+	// semaphore. Only post that moves it from -1 posts OS semaphore.
+	class HandoffSemaphore
+	{
+	public:
+		HandoffSemaphore()
+			: m_count(0)
+			, m_postTime(0)
+		{
+		}
+
+		void post()
+		{
+			m_postTime = bx::getHPCounter();
+
+			if (0 > bx::atomicFetchAndAdd<int32_t>(&m_count, 1) )
+			{
+				m_sem.post();
+			}
+		}
+
+		bool wait(int32_t _msecs, int64_t _spin)
+		{
+			const int64_t start = bx::getHPCounter();
+
+			for (int64_t now = start; now - start < _spin; now = bx::getHPCounter() )
+			{
+				const int32_t count = m_count;
+
+				if (0 < count
+				&&  count == bx::atomicCompareAndSwap<int32_t>(&m_count, count, count-1) )
+				{
+					return true;
+				}
+			}
+
+			if (0 < bx::atomicFetchAndSub<int32_t>(&m_count, 1) )
+			{
+				return true;
+			}
+
+			if (m_sem.wait(_msecs) )
+			{
+				return true;
+			}
+
+			return timedOut();
+		}
+
+		int64_t getPostTime() const
+		{
+			return m_postTime;
+		}
+
+	private:
+		friend struct HandoffSemaphoreTest;
+
+		// OS semaphore wait timed out. Give count back only while still waiting. If
+		// post raced with time out, it already took the waiter's -1 and posted OS
+		// semaphore, so count must stay and OS post must be consumed instead.
+		bool timedOut()
+		{
+			for (;;)
+			{
+				const int32_t count = m_count;
+
+				if (0 <= count)
+				{
+					break;
+				}
+
+				if (count == bx::atomicCompareAndSwap<int32_t>(&m_count, count, count+1) )
+				{
+					return false;
+				}
+			}
+
+			m_sem.wait();
+			return true;
+		}
+
+		bx::Semaphore    m_sem;
+		volatile int32_t m_count;
+		volatile int64_t m_postTime;
+	};
+
+} // namespace bgfx
+
+#endif // BGFX_HANDOFFSEMAPHORE_H_HEADER_GUARD
@@ -1813,7 +1813,7 @@ namespace bgfx { namespace d3d11
 			m_shaders[_handle.idx].destroy();
 		}
 
-		void createProgram(ProgramHandle _handle, ShaderHandle _vsh, ShaderHandle _fsh) override
+		void createProgram(ProgramHandle _handle, ShaderHandle _vsh, ShaderHandle _fsh, uint8_t /*_numConstants*/, const SpecializationConstant* /*_constants*/) override
 		{
 			m_program[_handle.idx].create(&m_shaders[_vsh.idx], isValid(_fsh) ? &m_shaders[_fsh.idx] : NULL);
 		}
@@ -1823,6 +1823,10 @@ namespace bgfx { namespace d3d11
 			m_program[_handle.idx].destroy();
 		}
 
+		void precachePipelines(ProgramHandle /*_handle*/, uint16_t /*_numStates*/, const uint64_t* /*_states*/, uint16_t /*_numLayouts*/, const VertexLayout* /*_layouts*/, uint16_t /*_numFrameBuffers*/, const FrameBufferHandle* /*_frameBuffers*/) override
+		{
+		}
+
 		void* createTexture(TextureHandle _handle, const Memory* _mem, uint64_t _flags, uint8_t _skip) override
 		{
 			return m_textures[_handle.idx].create(_mem, _flags, _skip);
@@ -1897,6 +1901,16 @@ namespace bgfx { namespace d3d11
 			release(mem);
 		}
 
+		void setTextureResidentMips(TextureHandle _handle, uint8_t _minMip) override
+		{
+			TextureD3D11& texture = m_textures[_handle.idx];
+
+			if (NULL != texture.m_ptr)
+			{
+				m_deviceCtx->SetResourceMinLOD(texture.m_ptr, float(_minMip) );
+			}
+		}
+
 		void overrideInternal(TextureHandle _handle, uintptr_t _ptr) override
 		{
 			// Resource ref. counts might be messed up outside of bgfx.
@@ -2295,6 +2309,11 @@ namespace bgfx { namespace d3d11
 			return m_lost;
 		}
 
+		bool getGpuCompletedFrame(uint32_t& /*_outFrameNum*/) override
+		{
+			return false;
+		}
+
 		void flip() override
 		{
 			if (!m_lost)
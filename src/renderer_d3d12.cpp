@@ -1696,6 +1696,11 @@ namespace bgfx { namespace d3d12
 			return m_lost;
 		}
 
+		bool getGpuCompletedFrame(uint32_t& /*_outFrameNum*/) override
+		{
+			return false;
+		}
+
 		void flip() override
 		{
 			if (!m_lost)
@@ -1816,7 +1821,7 @@ namespace bgfx { namespace d3d12
 			m_shaders[_handle.idx].destroy();
 		}
 
-		void createProgram(ProgramHandle _handle, ShaderHandle _vsh, ShaderHandle _fsh) override
+		void createProgram(ProgramHandle _handle, ShaderHandle _vsh, ShaderHandle _fsh, uint8_t /*_numConstants*/, const SpecializationConstant* /*_constants*/) override
 		{
 			m_program[_handle.idx].create(&m_shaders[_vsh.idx], isValid(_fsh) ? &m_shaders[_fsh.idx] : NULL);
 		}
@@ -1826,6 +1831,10 @@ namespace bgfx { namespace d3d12
 			m_program[_handle.idx].destroy();
 		}
 
+		void precachePipelines(ProgramHandle /*_handle*/, uint16_t /*_numStates*/, const uint64_t* /*_states*/, uint16_t /*_numLayouts*/, const VertexLayout* /*_layouts*/, uint16_t /*_numFrameBuffers*/, const FrameBufferHandle* /*_frameBuffers*/) override
+		{
+		}
+
 		void* createTexture(TextureHandle _handle, const Memory* _mem, uint64_t _flags, uint8_t _skip) override
 		{
 			return m_textures[_handle.idx].create(_mem, _flags, _skip);
@@ -1937,6 +1946,24 @@ namespace bgfx { namespace d3d12
 			release(mem);
 		}
 
+		void setTextureResidentMips(TextureHandle _handle, uint8_t _minMip) override
+		{
+			// Shader resource views are created from m_srvd at bind time, new
+			// clamp is used by all following draws.
+			D3D12_SHADER_RESOURCE_VIEW_DESC& srvd = m_textures[_handle.idx].m_srvd;
+			const float minLod = float(_minMip);
+
+			switch (srvd.ViewDimension)
+			{
+			case D3D12_SRV_DIMENSION_TEXTURE2D:        srvd.Texture2D.ResourceMinLODClamp        = minLod; break;
+			case D3D12_SRV_DIMENSION_TEXTURE2DARRAY:   srvd.Texture2DArray.ResourceMinLODClamp   = minLod; break;
+			case D3D12_SRV_DIMENSION_TEXTURE3D:        srvd.Texture3D.ResourceMinLODClamp        = minLod; break;
+			case D3D12_SRV_DIMENSION_TEXTURECUBE:      srvd.TextureCube.ResourceMinLODClamp      = minLod; break;
+			case D3D12_SRV_DIMENSION_TEXTURECUBEARRAY: srvd.TextureCubeArray.ResourceMinLODClamp = minLod; break;
+			default: break;
+			}
+		}
+
 		void overrideInternal(TextureHandle _handle, uintptr_t _ptr) override
 		{
 			// Resource ref. counts might be messed up outside of bgfx.
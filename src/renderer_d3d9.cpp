@@ -1076,7 +1076,7 @@ namespace bgfx { namespace d3d9
 			m_shaders[_handle.idx].destroy();
 		}
 
-		void createProgram(ProgramHandle _handle, ShaderHandle _vsh, ShaderHandle _fsh) override
+		void createProgram(ProgramHandle _handle, ShaderHandle _vsh, ShaderHandle _fsh, uint8_t /*_numConstants*/, const SpecializationConstant* /*_constants*/) override
 		{
 			m_program[_handle.idx].create(&m_shaders[_vsh.idx], isValid(_fsh) ? &m_shaders[_fsh.idx] : NULL);
 		}
@@ -1086,6 +1086,10 @@ namespace bgfx { namespace d3d9
 			m_program[_handle.idx].destroy();
 		}
 
+		void precachePipelines(ProgramHandle /*_handle*/, uint16_t /*_numStates*/, const uint64_t* /*_states*/, uint16_t /*_numLayouts*/, const VertexLayout* /*_layouts*/, uint16_t /*_numFrameBuffers*/, const FrameBufferHandle* /*_frameBuffers*/) override
+		{
+		}
+
 		void* createTexture(TextureHandle _handle, const Memory* _mem, uint64_t _flags, uint8_t _skip) override
 		{
 			m_textures[_handle.idx].create(_mem, _flags, _skip);
@@ -1170,6 +1174,11 @@ namespace bgfx { namespace d3d9
 			release(mem);
 		}
 
+		void setTextureResidentMips(TextureHandle _handle, uint8_t _minMip) override
+		{
+			m_textures[_handle.idx].m_residentMip = _minMip;
+		}
+
 		void overrideInternal(TextureHandle _handle, uintptr_t _ptr) override
 		{
 			// Resource ref. counts might be messed up outside of bgfx.
@@ -1583,6 +1592,11 @@ namespace bgfx { namespace d3d9
 			return false;
 		}
 
+		bool getGpuCompletedFrame(uint32_t& /*_outFrameNum*/) override
+		{
+			return false;
+		}
+
 		void flip() override
 		{
 			if (NULL != m_swapChain)
@@ -2965,6 +2979,7 @@ namespace bgfx { namespace d3d9
 			m_numMips = ti.numMips;
 			m_requestedFormat = uint8_t(imageContainer.m_format);
 			m_textureFormat   = uint8_t(getViableTextureFormat(imageContainer) );
+			m_residentMip     = 0;
 			const bool convert = m_textureFormat != m_requestedFormat;
 
 			uint8_t bpp = bimg::getBitsPerPixel(bimg::TextureFormat::Enum(m_textureFormat) );
@@ -3169,6 +3184,7 @@ namespace bgfx { namespace d3d9
 		s_renderD3D9->setSamplerState(_stage, flags, _palette[index]);
 
 		IDirect3DDevice9* device = s_renderD3D9->m_device;
+		RendererContextD3D9::setSamplerState(device, _stage, D3DSAMP_MAXMIPLEVEL, m_residentMip);
 		DX_CHECK(device->SetTexture(_stage, m_ptr) );
 		if (4 > _stage)
 		{
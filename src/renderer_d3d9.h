@@ -319,6 +319,7 @@ namespace bgfx { namespace d3d9
 			, m_surface(NULL)
 			, m_staging(NULL)
 			, m_textureFormat(TextureFormat::Unknown)
+			, m_residentMip(0)
 		{
 		}
 
@@ -396,6 +397,7 @@ namespace bgfx { namespace d3d9
 		uint8_t m_type;
 		uint8_t m_requestedFormat;
 		uint8_t m_textureFormat;
+		uint8_t m_residentMip;
 	};
 
 	struct FrameBufferD3D9
@@ -75,6 +75,19 @@ namespace bgfx { namespace gl
 	};
 	BX_STATIC_ASSERT(BGFX_CONFIG_MAX_INSTANCE_DATA_COUNT == BX_COUNTOF(s_instanceDataName) );
 
+	static const char* s_uniformBlockName[] =
+	{
+		"bgfx_VertexUniforms",
+		"bgfx_FragmentUniforms",
+	};
+
+	static const char* s_uniformBlockInstanceName[] =
+	{
+		"bgfx_vu",
+		"bgfx_fu",
+	};
+	BX_STATIC_ASSERT(BX_COUNTOF(s_uniformBlockName) == BX_COUNTOF(s_uniformBlockInstanceName) );
+
 	static const GLenum s_access[] =
 	{
 		GL_READ_ONLY,
@@ -323,6 +336,7 @@ namespace bgfx { namespace gl
 	BX_STATIC_ASSERT(TextureFormat::Count == BX_COUNTOF(s_textureFormat) );
 
 	static bool s_textureFilter[TextureFormat::Count+1];
+	static bool s_textureStorage[2][TextureFormat::Count+1]; // [srgb][format]
 
 	static GLenum s_rboFormat[] =
 	{
@@ -573,6 +587,7 @@ namespace bgfx { namespace gl
 			ARB_multisample,
 			ARB_occlusion_query,
 			ARB_occlusion_query2,
+			ARB_parallel_shader_compile,
 			ARB_program_interface_query,
 			ARB_provoking_vertex,
 			ARB_sampler_objects,
@@ -595,6 +610,7 @@ namespace bgfx { namespace gl
 			ARB_timer_query,
 			ARB_uniform_buffer_object,
 			ARB_vertex_array_object,
+			ARB_vertex_attrib_binding,
 			ARB_vertex_type_2_10_10_10_rev,
 
 			ATI_meminfo,
@@ -668,6 +684,7 @@ namespace bgfx { namespace gl
 
 			KHR_debug,
 			KHR_no_error,
+			KHR_parallel_shader_compile,
 
 			MOZ_WEBGL_compressed_texture_s3tc,
 			MOZ_WEBGL_depth_texture,
@@ -791,6 +808,7 @@ namespace bgfx { namespace gl
 		{ "ARB_multisample",                          false,                             true  },
 		{ "ARB_occlusion_query",                      BGFX_CONFIG_RENDERER_OPENGL >= 33, true  },
 		{ "ARB_occlusion_query2",                     BGFX_CONFIG_RENDERER_OPENGL >= 33, true  },
+		{ "ARB_parallel_shader_compile",              false,                             true  },
 		{ "ARB_program_interface_query",              BGFX_CONFIG_RENDERER_OPENGL >= 43, true  },
 		{ "ARB_provoking_vertex",                     BGFX_CONFIG_RENDERER_OPENGL >= 32, true  },
 		{ "ARB_sampler_objects",                      BGFX_CONFIG_RENDERER_OPENGL >= 33, true  },
@@ -813,6 +831,7 @@ namespace bgfx { namespace gl
 		{ "ARB_timer_query",                          BGFX_CONFIG_RENDERER_OPENGL >= 33, true  },
 		{ "ARB_uniform_buffer_object",                BGFX_CONFIG_RENDERER_OPENGL >= 31, true  },
 		{ "ARB_vertex_array_object",                  BGFX_CONFIG_RENDERER_OPENGL >= 30, true  },
+		{ "ARB_vertex_attrib_binding",                BGFX_CONFIG_RENDERER_OPENGL >= 43, true  },
 		{ "ARB_vertex_type_2_10_10_10_rev",           false,                             true  },
 
 		{ "ATI_meminfo",                              false,                             true  },
@@ -886,6 +905,7 @@ namespace bgfx { namespace gl
 
 		{ "KHR_debug",                                BGFX_CONFIG_RENDERER_OPENGL >= 43, true  },
 		{ "KHR_no_error",                             false,                             true  },
+		{ "KHR_parallel_shader_compile",              false,                             true  },
 
 		{ "MOZ_WEBGL_compressed_texture_s3tc",        false,                             true  },
 		{ "MOZ_WEBGL_depth_texture",                  false,                             true  },
@@ -1270,6 +1290,8 @@ namespace bgfx { namespace gl
 		return 0 == err ? result : 0;
 	}
 
+	GlStateCache g_glStateCache;
+
 	static uint64_t s_currentlyEnabledVertexAttribArrays = 0;
 	static uint64_t s_vertexAttribArraysPendingDisable   = 0;
 	static uint64_t s_vertexAttribArraysPendingEnable    = 0;
@@ -1845,7 +1867,7 @@ namespace bgfx { namespace gl
 
 		GLuint id;
 		GL_CHECK(glGenTextures(1, &id) );
-		GL_CHECK(glBindTexture(target, id) );
+		g_glStateCache.bindTexture(target, id);
 
 		GLenum err = 0;
 		if (_array)
@@ -1880,12 +1902,38 @@ namespace bgfx { namespace gl
 			}
 		}
 
-		GL_CHECK(glDeleteTextures(1, &id) );
+		g_glStateCache.deleteTextures(1, &id);
 
 		return 0 == err;
 #endif
 	}
 
+	static bool isTextureStorageValid(TextureFormat::Enum _format, bool _srgb)
+	{
+		const TextureFormatInfo& tfi = s_textureFormat[_format];
+		const GLenum internalFmt = _srgb
+			? tfi.m_internalFmtSrgb
+			: tfi.m_internalFmt
+			;
+
+		if (GL_ZERO == internalFmt)
+		{
+			return false;
+		}
+
+		GLuint id;
+		GL_CHECK(glGenTextures(1, &id) );
+		g_glStateCache.bindTexture(GL_TEXTURE_2D, id);
+
+		flushGlError();
+		glTexStorage2D(GL_TEXTURE_2D, 1, internalFmt, 16, 16);
+		const GLenum err = getGlError();
+
+		g_glStateCache.deleteTextures(1, &id);
+
+		return 0 == err;
+	}
+
 	static bool isImageFormatValid(TextureFormat::Enum _format, GLsizei _dim = 16)
 	{
 		if (GL_ZERO == s_imageFormat[_format])
@@ -1895,7 +1943,7 @@ namespace bgfx { namespace gl
 
 		GLuint id;
 		GL_CHECK(glGenTextures(1, &id) );
-		GL_CHECK(glBindTexture(GL_TEXTURE_2D, id) );
+		g_glStateCache.bindTexture(GL_TEXTURE_2D, id);
 
 		flushGlError();
 		GLenum err = 0;
@@ -1915,7 +1963,7 @@ namespace bgfx { namespace gl
 			err |= getGlError();
 		}
 
-		GL_CHECK(glDeleteTextures(1, &id) );
+		g_glStateCache.deleteTextures(1, &id);
 
 		return 0 == err;
 	}
@@ -2097,7 +2145,7 @@ namespace bgfx { namespace gl
 
 		GLuint id;
 		GL_CHECK(glGenTextures(1, &id) );
-		GL_CHECK(glBindTexture(GL_TEXTURE_2D, id) );
+		g_glStateCache.bindTexture(GL_TEXTURE_2D, id);
 
 		GLenum err = initTestTexture(_format, _srgb, false, false, _dim);
 
@@ -2139,7 +2187,7 @@ namespace bgfx { namespace gl
 		GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, 0) );
 		GL_CHECK(glDeleteFramebuffers(1, &fbo) );
 
-		GL_CHECK(glDeleteTextures(1, &id) );
+		g_glStateCache.deleteTextures(1, &id);
 
 		return GL_FRAMEBUFFER_COMPLETE == err;
 #endif
@@ -2227,6 +2275,10 @@ namespace bgfx { namespace gl
 			, m_blitSupported(false)
 			, m_readBackSupported(BX_ENABLED(BGFX_CONFIG_RENDERER_OPENGL) )
 			, m_vaoSupport(false)
+			, m_vertexAttribBindingSupport(false)
+			, m_uniformBlockSupport(false)
+			, m_asyncReadBackSupport(false)
+			, m_parallelShaderCompileSupport(false)
 			, m_samplerObjectSupport(false)
 			, m_shadowSamplersSupport(false)
 			, m_srgbWriteControlSupport(BX_ENABLED(BGFX_CONFIG_RENDERER_OPENGL) )
@@ -2243,10 +2295,15 @@ namespace bgfx { namespace gl
 			, m_backBufferFbo(0)
 			, m_msaaBackBufferFbo(0)
 			, m_msaaBlitProgram(0)
+			, m_currentSwapChain(NULL)
 			, m_clearQuadColor(BGFX_INVALID_HANDLE)
 			, m_clearQuadDepth(BGFX_INVALID_HANDLE)
 		{
 			bx::memSet(m_msaaBackBufferRbos, 0, sizeof(m_msaaBackBufferRbos) );
+			bx::memSet(m_uniformBlockData, 0, sizeof(m_uniformBlockData) );
+			m_uniformBlockDirty = 0;
+			m_numProgramsPending = 0;
+			m_shaderCompileTime  = 0;
 		}
 
 		~RendererContextGL()
@@ -2719,6 +2776,13 @@ namespace bgfx { namespace gl
 					|| s_extension[Extension::ARB_compute_shader].m_supported
 					;
 
+				// Immutable storage requires sized internal formats, GLES2 keeps mutable textures. Skip
+				// probing on WebGL, failed test allocations cause error noise in the browser console.
+				const bool textureStorageSupport = true
+					&& !BX_ENABLED(BX_PLATFORM_EMSCRIPTEN)
+					&& (m_gles3 || s_extension[Extension::ARB_texture_storage].m_supported)
+					;
+
 				for (uint32_t ii = 0; ii < TextureFormat::Count; ++ii)
 				{
 					const TextureFormat::Enum fmt = TextureFormat::Enum(ii);
@@ -2762,6 +2826,15 @@ namespace bgfx { namespace gl
 						: BGFX_CAPS_FORMAT_TEXTURE_NONE
 						;
 
+					s_textureStorage[0][ii] = textureStorageSupport
+						&& s_textureFormat[ii].m_supported
+						&& isTextureStorageValid(fmt, false)
+						;
+					s_textureStorage[1][ii] = textureStorageSupport
+						&& 0 != (supported & BGFX_CAPS_FORMAT_TEXTURE_2D_SRGB)
+						&& isTextureStorageValid(fmt, true)
+						;
+
 					if (NULL != glGetInternalformativ)
 					{
 						GLint maxSamples;
@@ -2945,6 +3018,68 @@ namespace bgfx { namespace gl
 					GL_CHECK(glGenVertexArrays(1, &m_vao) );
 				}
 
+				m_vertexAttribBindingSupport = m_vaoSupport
+					&& (BX_ENABLED(BGFX_CONFIG_RENDERER_OPENGLES >= 31)
+						|| s_extension[Extension::ARB_vertex_attrib_binding].m_supported
+						)
+					&& NULL != glBindVertexBuffer
+					&& NULL != glVertexAttribBinding
+					&& NULL != glVertexAttribFormat
+					&& NULL != glVertexAttribIFormat
+					&& NULL != glVertexBindingDivisor
+					;
+
+				m_uniformBlockSupport = 0 != BGFX_CONFIG_UNIFORM_BUFFER_RING_SIZE
+					&& (BX_ENABLED(BGFX_CONFIG_RENDERER_OPENGL >= 31) || m_gles3)
+					&& NULL != glGetUniformBlockIndex
+					&& NULL != glGetActiveUniformBlockiv
+					&& NULL != glGetActiveUniformsiv
+					&& NULL != glUniformBlockBinding
+					&& NULL != glBindBufferRange
+					;
+
+				BX_TRACE("Uniform blocks are %s (requires BGFX_CONFIG_RENDERER_OPENGL >= 31 or GLES 3.0 context)."
+					, m_uniformBlockSupport ? "enabled" : "disabled"
+					);
+
+				m_parallelShaderCompileSupport = false
+					|| s_extension[Extension::ARB_parallel_shader_compile].m_supported
+					|| s_extension[Extension::KHR_parallel_shader_compile].m_supported
+					;
+
+				if (m_parallelShaderCompileSupport)
+				{
+					// Let driver pick number of compiler threads.
+					if (NULL != glMaxShaderCompilerThreadsKHR)
+					{
+						GL_CHECK(glMaxShaderCompilerThreadsKHR(UINT32_MAX) );
+					}
+					else if (NULL != glMaxShaderCompilerThreadsARB)
+					{
+						GL_CHECK(glMaxShaderCompilerThreadsARB(UINT32_MAX) );
+					}
+				}
+
+				m_asyncReadBackSupport = (BX_ENABLED(BGFX_CONFIG_RENDERER_OPENGL >= 32) || m_gles3)
+					&& NULL != glFenceSync
+					&& NULL != glClientWaitSync
+					&& NULL != glDeleteSync
+					&& NULL != glMapBufferRange
+					&& NULL != glUnmapBuffer
+					;
+
+				if (m_asyncReadBackSupport)
+				{
+					m_readBack.create();
+				}
+
+				if (m_uniformBlockSupport)
+				{
+					GLint align = 0;
+					GL_CHECK(glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &align) );
+					m_uniformBufferRing.create(GL_UNIFORM_BUFFER, BGFX_CONFIG_UNIFORM_BUFFER_RING_SIZE, uint32_t(align) );
+				}
+
 				m_samplerObjectSupport = false
 					|| m_gles3
 					|| s_extension[Extension::ARB_sampler_objects].m_supported
@@ -3134,7 +3269,7 @@ namespace bgfx { namespace gl
 
 				if (s_extension[Extension::ARB_seamless_cube_map].m_supported)
 				{
-					GL_CHECK(glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS) );
+					g_glStateCache.enable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
 				}
 
 				if (NULL != glProvokingVertex
@@ -3206,11 +3341,18 @@ namespace bgfx { namespace gl
 		{
 			if (m_vaoSupport)
 			{
-				GL_CHECK(glBindVertexArray(0) );
-				GL_CHECK(glDeleteVertexArrays(1, &m_vao) );
+				g_glStateCache.bindVertexArray(0);
+				g_glStateCache.deleteVertexArrays(1, &m_vao);
 				m_vao = 0;
 			}
 
+			m_uniformBufferRing.destroy();
+
+			if (m_asyncReadBackSupport)
+			{
+				m_readBack.destroy();
+			}
+
 			captureFinish();
 
 			invalidateCache();
@@ -3253,6 +3395,11 @@ namespace bgfx { namespace gl
 			return false;
 		}
 
+		bool getGpuCompletedFrame(uint32_t& /*_outFrameNum*/) override
+		{
+			return false;
+		}
+
 		void flip() override
 		{
 			if (m_flip)
@@ -3262,6 +3409,7 @@ namespace bgfx { namespace gl
 					FrameBufferGL& frameBuffer = m_frameBuffers[m_windows[ii].idx];
 					if (frameBuffer.m_needPresent)
 					{
+						makeCurrent(frameBuffer.m_swapChain);
 						m_glctx.swap(frameBuffer.m_swapChain);
 						frameBuffer.m_needPresent = false;
 					}
@@ -3272,6 +3420,7 @@ namespace bgfx { namespace gl
 					// Ensure the back buffer is bound as the source of the flip
 					GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_backBufferFbo) );
 
+					makeCurrent(NULL);
 					m_glctx.swap();
 					m_needPresent = false;
 				}
@@ -3342,7 +3491,9 @@ namespace bgfx { namespace gl
 
 		void createShader(ShaderHandle _handle, const Memory* _mem) override
 		{
+			const int64_t start = bx::getHPCounter();
 			m_shaders[_handle.idx].create(_mem);
+			m_shaderCompileTime += bx::getHPCounter() - start;
 		}
 
 		void destroyShader(ShaderHandle _handle) override
@@ -3350,10 +3501,12 @@ namespace bgfx { namespace gl
 			m_shaders[_handle.idx].destroy();
 		}
 
-		void createProgram(ProgramHandle _handle, ShaderHandle _vsh, ShaderHandle _fsh) override
+		void createProgram(ProgramHandle _handle, ShaderHandle _vsh, ShaderHandle _fsh, uint8_t /*_numConstants*/, const SpecializationConstant* /*_constants*/) override
 		{
+			const int64_t start = bx::getHPCounter();
 			ShaderGL dummyFragmentShader;
 			m_program[_handle.idx].create(m_shaders[_vsh.idx], isValid(_fsh) ? m_shaders[_fsh.idx] : dummyFragmentShader);
+			m_shaderCompileTime += bx::getHPCounter() - start;
 		}
 
 		void destroyProgram(ProgramHandle _handle) override
@@ -3361,6 +3514,10 @@ namespace bgfx { namespace gl
 			m_program[_handle.idx].destroy();
 		}
 
+		void precachePipelines(ProgramHandle /*_handle*/, uint16_t /*_numStates*/, const uint64_t* /*_states*/, uint16_t /*_numLayouts*/, const VertexLayout* /*_layouts*/, uint16_t /*_numFrameBuffers*/, const FrameBufferHandle* /*_frameBuffers*/) override
+		{
+		}
+
 		void* createTexture(TextureHandle _handle, const Memory* _mem, uint64_t _flags, uint8_t _skip) override
 		{
 			m_textures[_handle.idx].create(_mem, _flags, _skip);
@@ -3387,13 +3544,37 @@ namespace bgfx { namespace gl
 				const TextureGL& texture = m_textures[_handle.idx];
 				const bool compressed    = bimg::isCompressed(bimg::TextureFormat::Enum(texture.m_textureFormat) );
 
-				GL_CHECK(glBindTexture(texture.m_target, texture.m_id) );
+				void* data = _data;
+
+				if (m_asyncReadBackSupport)
+				{
+					// For array textures m_depth holds the layer count, only
+					// volume textures shrink in depth with mip level.
+					const bool volume = GL_TEXTURE_3D == texture.m_target;
+
+					bimg::TextureInfo ti;
+					bimg::imageGetSize(
+						  &ti
+						, uint16_t(bx::max<uint32_t>(texture.m_width >>_mip, 1) )
+						, uint16_t(bx::max<uint32_t>(texture.m_height>>_mip, 1) )
+						, uint16_t(volume ? bx::max<uint32_t>(texture.m_depth>>_mip, 1) : 1)
+						, texture.isCubeMap()
+						, false
+						, uint16_t(volume ? 1 : bx::max<uint32_t>(texture.m_numLayers, 1) )
+						, bimg::TextureFormat::Enum(texture.m_textureFormat)
+						);
+
+					m_readBack.begin(ti.storageSize);
+					data = NULL;
+				}
+
+				g_glStateCache.bindTexture(texture.m_target, texture.m_id);
 
 				if (compressed)
 				{
 					GL_CHECK(glGetCompressedTexImage(texture.m_target
 						, _mip
-						, _data
+						, data
 						) );
 				}
 				else
@@ -3402,11 +3583,16 @@ namespace bgfx { namespace gl
 						, _mip
 						, texture.m_fmt
 						, texture.m_type
-						, _data
+						, data
 						) );
 				}
 
-				GL_CHECK(glBindTexture(texture.m_target, 0) );
+				g_glStateCache.bindTexture(texture.m_target, 0);
+
+				if (m_asyncReadBackSupport)
+				{
+					m_readBack.end(ReadBackGL::Type::Texture, _data, texture.m_width, texture.m_height, false);
+				}
 			}
 			else if (BX_ENABLED(BGFX_GL_CONFIG_TEXTURE_READ_BACK_EMULATION) )
 			{
@@ -3436,6 +3622,14 @@ namespace bgfx { namespace gl
 
 					if (GL_FRAMEBUFFER_COMPLETE == glCheckFramebufferStatus(GL_FRAMEBUFFER) )
 					{
+						void* data = _data;
+
+						if (m_asyncReadBackSupport)
+						{
+							m_readBack.begin(texture.m_width*texture.m_height*4);
+							data = NULL;
+						}
+
 						GL_CHECK(glReadPixels(
 							  0
 							, 0
@@ -3443,8 +3637,13 @@ namespace bgfx { namespace gl
 							, texture.m_height
 							, m_readPixelsFmt
 							, GL_UNSIGNED_BYTE
-							, _data
+							, data
 							) );
+
+						if (m_asyncReadBackSupport)
+						{
+							m_readBack.end(ReadBackGL::Type::Texture, _data, texture.m_width, texture.m_height, false);
+						}
 					}
 
 					frameBuffer.destroy();
@@ -3480,6 +3679,11 @@ namespace bgfx { namespace gl
 			release(mem);
 		}
 
+		void setTextureResidentMips(TextureHandle _handle, uint8_t _minMip) override
+		{
+			m_textures[_handle.idx].setResidentMips(_minMip);
+		}
+
 		void overrideInternal(TextureHandle _handle, uintptr_t _ptr) override
 		{
 			m_textures[_handle.idx].overrideInternal(_ptr);
@@ -3561,9 +3765,29 @@ namespace bgfx { namespace gl
 				height = frameBuffer.m_height;
 			}
 
-			m_glctx.makeCurrent(swapChain);
+			makeCurrent(swapChain);
 
 			uint32_t length = width*height*4;
+
+			if (m_asyncReadBackSupport)
+			{
+				// Screenshot is delivered to callback once GPU is done with it,
+				// instead of stalling here until frame is drained.
+				m_readBack.begin(length);
+
+				GL_CHECK(glReadPixels(0
+					, 0
+					, width
+					, height
+					, m_readPixelsFmt
+					, GL_UNSIGNED_BYTE
+					, NULL
+					) );
+
+				m_readBack.end(ReadBackGL::Type::ScreenShot, NULL, width, height, GL_RGBA == m_readPixelsFmt, _filePath);
+				return;
+			}
+
 			uint8_t* data = (uint8_t*)BX_ALLOC(g_allocator, length);
 
 			GL_CHECK(glReadPixels(0
@@ -3659,7 +3883,7 @@ namespace bgfx { namespace gl
 		{
 			if (0 != m_vao)
 			{
-				GL_CHECK(glBindVertexArray(m_vao) );
+				g_glStateCache.bindVertexArray(m_vao);
 			}
 
 			uint32_t width  = m_resolution.width;
@@ -3668,13 +3892,15 @@ namespace bgfx { namespace gl
 			GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_backBufferFbo) );
 			GL_CHECK(glViewport(0, 0, width, height) );
 
-			GL_CHECK(glDisable(GL_SCISSOR_TEST) );
-			GL_CHECK(glDisable(GL_STENCIL_TEST) );
-			GL_CHECK(glDisable(GL_DEPTH_TEST) );
-			GL_CHECK(glDepthFunc(GL_ALWAYS) );
-			GL_CHECK(glDisable(GL_CULL_FACE) );
-			GL_CHECK(glDisable(GL_BLEND) );
-			GL_CHECK(glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE) );
+			g_glStateCache.disable(GL_SCISSOR_TEST);
+			g_glStateCache.disable(GL_STENCIL_TEST);
+			g_glStateCache.disable(GL_DEPTH_TEST);
+			g_glStateCache.depthFunc(GL_ALWAYS);
+			g_glStateCache.disable(GL_CULL_FACE);
+			g_glStateCache.disable(GL_BLEND);
+			g_glStateCache.colorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+
+			updateProgram(_blitter.m_program, true);
 
 			ProgramGL& program = m_program[_blitter.m_program.idx];
 			setProgram(program.m_id);
@@ -3689,15 +3915,17 @@ namespace bgfx { namespace gl
 				, proj
 				);
 
-			GL_CHECK(glActiveTexture(GL_TEXTURE0) );
-			GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textures[_blitter.m_texture.idx].m_id) );
+			bindUniformBlocks(program);
+
+			const TextureGL& texture = m_textures[_blitter.m_texture.idx];
+			g_glStateCache.activeTexture(GL_TEXTURE0);
+			g_glStateCache.bindTexture(GL_TEXTURE_2D, texture.m_id);
 
-			if (!BX_ENABLED(BX_PLATFORM_OSX) )
+			// Texture sampler parameters are not written when sampler objects
+			// are supported, sampler must be bound on every platform.
+			if (m_samplerObjectSupport)
 			{
-				if (m_samplerObjectSupport)
-				{
-					GL_CHECK(glBindSampler(0, 0) );
-				}
+				setSamplerState(0, texture.m_numMips, uint32_t(texture.m_flags), NULL);
 			}
 		}
 
@@ -3710,10 +3938,10 @@ namespace bgfx { namespace gl
 				m_vertexBuffers[_blitter.m_vb->handle.idx].update(0, numVertices*_blitter.m_layout.m_stride, _blitter.m_vb->data);
 
 				VertexBufferGL& vb = m_vertexBuffers[_blitter.m_vb->handle.idx];
-				GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vb.m_id) );
+				g_glStateCache.bindBuffer(GL_ARRAY_BUFFER, vb.m_id);
 
 				IndexBufferGL& ib = m_indexBuffers[_blitter.m_ib->handle.idx];
-				GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ib.m_id) );
+				g_glStateCache.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, ib.m_id);
 
 				ProgramGL& program = m_program[_blitter.m_program.idx];
 				program.bindAttributesBegin();
@@ -3739,11 +3967,11 @@ namespace bgfx { namespace gl
 			{
 				if (!!(_resolution.reset & BGFX_RESET_DEPTH_CLAMP) )
 				{
-					GL_CHECK(glEnable(GL_DEPTH_CLAMP) );
+					g_glStateCache.enable(GL_DEPTH_CLAMP);
 				}
 				else
 				{
-					GL_CHECK(glDisable(GL_DEPTH_CLAMP) );
+					g_glStateCache.disable(GL_DEPTH_CLAMP);
 				}
 			}
 
@@ -3782,6 +4010,60 @@ namespace bgfx { namespace gl
 			}
 		}
 
+		void setUniformBlock(uint32_t _loc, UniformType::Enum _type, uint32_t _num, const void* _data)
+		{
+			const uint32_t stage  = 0 != (_loc & BGFX_GL_UNIFORM_BLOCK_LOC_FRAGMENT);
+			const uint32_t offset = _loc & BGFX_GL_UNIFORM_BLOCK_LOC_OFFSET_MASK;
+
+			// std140 pads mat3 columns to vec4.
+			const uint32_t srcStride  = UniformType::Mat3 == _type ? 3*sizeof(float) : 4*sizeof(float);
+			const uint32_t numColumns = _num * (UniformType::Mat3 == _type ? 3 : UniformType::Mat4 == _type ? 4 : 1);
+
+			// Shaders with larger blocks are not converted to uniform blocks.
+			BX_ASSERT(offset + numColumns*16 <= BGFX_GL_UNIFORM_BLOCK_MAX_SIZE
+				, "Uniform block write out of bounds (offset %d, size %d, max: %d)."
+				, offset
+				, numColumns*16
+				, BGFX_GL_UNIFORM_BLOCK_MAX_SIZE
+				);
+
+			if (offset + numColumns*16 > BGFX_GL_UNIFORM_BLOCK_MAX_SIZE)
+			{
+				return;
+			}
+
+			uint8_t* dst = &m_uniformBlockData[stage][offset];
+			const uint8_t* src = (const uint8_t*)_data;
+
+			bool changed = false;
+			for (uint32_t ii = 0; ii < numColumns; ++ii, dst += 16, src += srcStride)
+			{
+				if (0 != bx::memCmp(dst, src, srcStride) )
+				{
+					bx::memCopy(dst, src, srcStride);
+					changed = true;
+				}
+			}
+
+			m_uniformBlockDirty |= changed ? uint8_t(1<<stage) : 0;
+		}
+
+		void bindUniformBlocks(const ProgramGL& _program)
+		{
+			for (uint32_t stage = 0; stage < BX_COUNTOF(_program.m_uniformBlockSize); ++stage)
+			{
+				const uint32_t size = _program.m_uniformBlockSize[stage];
+
+				if (0 != size
+				&&  0 != (m_uniformBlockDirty & (1<<stage) ) )
+				{
+					m_uniformBufferRing.bind(stage, m_uniformBlockData[stage], size);
+				}
+			}
+
+			m_uniformBlockDirty = 0;
+		}
+
 		void setShaderUniform4f(uint8_t /*_flags*/, uint32_t _regIndex, const void* _val, uint32_t _numRegs)
 		{
 			setUniform4fv(_regIndex
@@ -3814,7 +4096,7 @@ namespace bgfx { namespace gl
 				}
 			}
 
-			m_glctx.makeCurrent(NULL);
+			makeCurrent(NULL);
 
 			if (!isValid(_fbh) )
 			{
@@ -3826,11 +4108,11 @@ namespace bgfx { namespace gl
 				{
 					if (0 != (m_resolution.reset & BGFX_RESET_SRGB_BACKBUFFER) )
 					{
-						GL_CHECK(glEnable(GL_FRAMEBUFFER_SRGB) );
+						g_glStateCache.enable(GL_FRAMEBUFFER_SRGB);
 					}
 					else
 					{
-						GL_CHECK(glDisable(GL_FRAMEBUFFER_SRGB) );
+						g_glStateCache.disable(GL_FRAMEBUFFER_SRGB);
 					}
 				}
 			}
@@ -3840,15 +4122,15 @@ namespace bgfx { namespace gl
 				_height = frameBuffer.m_height;
 				if (UINT16_MAX != frameBuffer.m_denseIdx)
 				{
-					m_glctx.makeCurrent(frameBuffer.m_swapChain);
-					GL_CHECK(glFrontFace(GL_CW) );
+					makeCurrent(frameBuffer.m_swapChain);
+					g_glStateCache.frontFace(GL_CW);
 
 					frameBuffer.m_needPresent = true;
 					m_currentFbo = 0;
 				}
 				else
 				{
-					m_glctx.makeCurrent(NULL);
+					makeCurrent(NULL);
 					m_currentFbo = frameBuffer.m_fbo[0];
 				}
 			}
@@ -3895,7 +4177,7 @@ namespace bgfx { namespace gl
 				if (m_gles3)
 				{
 					GL_CHECK(glGenTextures(BX_COUNTOF(m_msaaBackBufferTextures), m_msaaBackBufferTextures) );
-					GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_msaaBackBufferTextures[0]) );
+					g_glStateCache.bindTexture(GL_TEXTURE_2D, m_msaaBackBufferTextures[0]);
 					GL_CHECK(glTexStorage2D(GL_TEXTURE_2D, 1, storageFormat, _width, _height) );
 					GL_CHECK(glFramebufferTexture2DMultisampleEXT(
 						  GL_FRAMEBUFFER
@@ -3907,7 +4189,7 @@ namespace bgfx { namespace gl
 						) );
 					GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_msaaBackBufferFbo) );
 
-					GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_msaaBackBufferTextures[1]) );
+					g_glStateCache.bindTexture(GL_TEXTURE_2D, m_msaaBackBufferTextures[1]);
 					GL_CHECK(glTexStorage2D(GL_TEXTURE_2D, 1, GL_DEPTH24_STENCIL8, _width, _height) );
 					GL_CHECK(glFramebufferTexture2DMultisampleEXT(
 						  GL_FRAMEBUFFER
@@ -4062,13 +4344,13 @@ namespace bgfx { namespace gl
 				{
 					if (0 != m_msaaBackBufferTextures[0])
 					{
-						GL_CHECK(glDeleteTextures(BX_COUNTOF(m_msaaBackBufferTextures), m_msaaBackBufferTextures) );
+						g_glStateCache.deleteTextures(BX_COUNTOF(m_msaaBackBufferTextures), m_msaaBackBufferTextures);
 						m_msaaBackBufferTextures[0] = 0;
 						m_msaaBackBufferTextures[1] = 0;
 					}
 					if (0 != m_msaaBlitProgram)
 					{
-						GL_CHECK(glDeleteProgram(m_msaaBlitProgram) );
+						g_glStateCache.deleteProgram(m_msaaBlitProgram);
 						m_msaaBlitProgram = 0;
 					}
 				}
@@ -4089,10 +4371,10 @@ namespace bgfx { namespace gl
 			if (m_backBufferFbo != m_msaaBackBufferFbo // iOS
 			&&  0 != m_msaaBackBufferFbo)
 			{
-				GL_CHECK(glDisable(GL_SCISSOR_TEST) );
+				g_glStateCache.disable(GL_SCISSOR_TEST);
 				GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_backBufferFbo) );
 				GL_CHECK(glBindFramebuffer(GL_READ_FRAMEBUFFER, m_msaaBackBufferFbo) );
-				GL_CHECK(glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0) );
+				GL_CHECK(glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_backBufferFbo) );
 
 				const uint32_t width  = m_resolution.width;
 				const uint32_t height = m_resolution.height;
@@ -4103,9 +4385,9 @@ namespace bgfx { namespace gl
 
 				if (m_gles3)
 				{
-					GL_CHECK(glUseProgram(m_msaaBlitProgram) );
-					GL_CHECK(glActiveTexture(GL_TEXTURE0) );
-					GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_msaaBackBufferTextures[0]) );
+					g_glStateCache.useProgram(m_msaaBlitProgram);
+					g_glStateCache.activeTexture(GL_TEXTURE0);
+					g_glStateCache.bindTexture(GL_TEXTURE_2D, m_msaaBackBufferTextures[0]);
 					GL_CHECK(glDrawArrays(GL_TRIANGLES, 0, 3) );
 				}
 				else
@@ -4128,6 +4410,18 @@ namespace bgfx { namespace gl
 			}
 		}
 
+		void makeCurrent(SwapChainGL* _swapChain)
+		{
+			if (m_currentSwapChain != _swapChain)
+			{
+				// Swap chains might have their own context, with its own GL state.
+				g_glStateCache.invalidate();
+				m_currentSwapChain = _swapChain;
+			}
+
+			m_glctx.makeCurrent(_swapChain);
+		}
+
 		void setRenderContextSize(uint32_t _width, uint32_t _height, uint32_t _flags = 0)
 		{
 			if (_width  != 0
@@ -4136,11 +4430,16 @@ namespace bgfx { namespace gl
 				if (!m_glctx.isValid() )
 				{
 					m_glctx.create(_width, _height, _flags);
+					g_glStateCache.invalidate();
 
 #if BX_PLATFORM_IOS
 					// iOS: need to figure out how to deal with FBO created by context.
 					m_backBufferFbo = m_msaaBackBufferFbo = m_glctx.getFbo();
-#endif // BX_PLATFORM_IOS
+#elif BGFX_USE_EGL
+					// EGL: headless context renders into FBO back buffer, 0 otherwise. MSAA
+					// FBO, when requested, is resolved into it.
+					m_backBufferFbo = m_glctx.getFbo();
+#endif // BX_PLATFORM_*
 				}
 				else
 				{
@@ -4160,6 +4459,11 @@ namespace bgfx { namespace gl
 
 		void invalidateCache()
 		{
+			if (m_vaoSupport)
+			{
+				m_vaoStateCache.invalidate();
+			}
+
 			if (m_samplerObjectSupport)
 			{
 				m_samplerStateCache.invalidate();
@@ -4265,11 +4569,11 @@ namespace bgfx { namespace gl
 					}
 				}
 
-				GL_CHECK(glBindSampler(_stage, sampler) );
+				g_glStateCache.bindSampler(_stage, sampler);
 			}
 			else
 			{
-				GL_CHECK(glBindSampler(_stage, 0) );
+				g_glStateCache.bindSampler(_stage, 0);
 			}
 		}
 
@@ -4281,6 +4585,12 @@ namespace bgfx { namespace gl
 
 		void updateCapture()
 		{
+			if (m_asyncReadBackSupport)
+			{
+				// Deliver in-flight frames before capture buffer is resized or released.
+				m_readBack.flush();
+			}
+
 			if (m_resolution.reset&BGFX_RESET_CAPTURE)
 			{
 				m_captureSize = m_resolution.width*m_resolution.height*4;
@@ -4297,6 +4607,28 @@ namespace bgfx { namespace gl
 		{
 			if (NULL != m_capture)
 			{
+				if (m_asyncReadBackSupport)
+				{
+					m_readBack.begin(m_captureSize);
+
+					GL_CHECK(glReadPixels(0
+						, 0
+						, m_resolution.width
+						, m_resolution.height
+						, m_readPixelsFmt
+						, GL_UNSIGNED_BYTE
+						, NULL
+						) );
+
+					m_readBack.end(ReadBackGL::Type::Capture
+						, m_capture
+						, m_resolution.width
+						, m_resolution.height
+						, GL_RGBA == m_readPixelsFmt
+						);
+					return;
+				}
+
 				GL_CHECK(glReadPixels(0
 					, 0
 					, m_resolution.width
@@ -4326,6 +4658,11 @@ namespace bgfx { namespace gl
 		{
 			if (NULL != m_capture)
 			{
+				if (m_asyncReadBackSupport)
+				{
+					m_readBack.flush();
+				}
+
 				g_callback->captureEnd();
 				BX_FREE(g_allocator, m_capture);
 				m_capture = NULL;
@@ -4517,14 +4854,14 @@ namespace bgfx { namespace gl
 					}
 
 					flags |= GL_COLOR_BUFFER_BIT;
-					GL_CHECK(glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE) );
+					g_glStateCache.colorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 				}
 
 				if (BGFX_CLEAR_DEPTH & _clear.m_flags)
 				{
 					flags |= GL_DEPTH_BUFFER_BIT;
 					GL_CHECK(glClearDepth(_clear.m_depth) );
-					GL_CHECK(glDepthMask(GL_TRUE) );
+					g_glStateCache.depthMask(GL_TRUE);
 				}
 
 				if (BGFX_CLEAR_STENCIL & _clear.m_flags)
@@ -4535,10 +4872,10 @@ namespace bgfx { namespace gl
 
 				if (0 != flags)
 				{
-					GL_CHECK(glEnable(GL_SCISSOR_TEST) );
+					g_glStateCache.enable(GL_SCISSOR_TEST);
 					GL_CHECK(glScissor(_rect.m_x, _height-_rect.m_height-_rect.m_y, _rect.m_width, _rect.m_height) );
 					GL_CHECK(glClear(flags) );
-					GL_CHECK(glDisable(GL_SCISSOR_TEST) );
+					g_glStateCache.disable(GL_SCISSOR_TEST);
 				}
 			}
 			else
@@ -4546,42 +4883,44 @@ namespace bgfx { namespace gl
 				const GLuint defaultVao = m_vao;
 				if (0 != defaultVao)
 				{
-					GL_CHECK(glBindVertexArray(defaultVao) );
+					g_glStateCache.bindVertexArray(defaultVao);
 				}
 
-				GL_CHECK(glDisable(GL_SCISSOR_TEST) );
-				GL_CHECK(glDisable(GL_CULL_FACE) );
-				GL_CHECK(glDisable(GL_BLEND) );
+				g_glStateCache.disable(GL_SCISSOR_TEST);
+				g_glStateCache.disable(GL_CULL_FACE);
+				g_glStateCache.disable(GL_BLEND);
 
 				GLboolean colorMask = !!(BGFX_CLEAR_COLOR & _clear.m_flags);
-				GL_CHECK(glColorMask(colorMask, colorMask, colorMask, colorMask) );
+				g_glStateCache.colorMask(colorMask, colorMask, colorMask, colorMask);
 
 				if (BGFX_CLEAR_DEPTH & _clear.m_flags)
 				{
-					GL_CHECK(glEnable(GL_DEPTH_TEST) );
-					GL_CHECK(glDepthFunc(GL_ALWAYS) );
-					GL_CHECK(glDepthMask(GL_TRUE) );
+					g_glStateCache.enable(GL_DEPTH_TEST);
+					g_glStateCache.depthFunc(GL_ALWAYS);
+					g_glStateCache.depthMask(GL_TRUE);
 				}
 				else
 				{
-					GL_CHECK(glDisable(GL_DEPTH_TEST) );
+					g_glStateCache.disable(GL_DEPTH_TEST);
 				}
 
 				if (BGFX_CLEAR_STENCIL & _clear.m_flags)
 				{
-					GL_CHECK(glEnable(GL_STENCIL_TEST) );
+					g_glStateCache.enable(GL_STENCIL_TEST);
 					GL_CHECK(glStencilFuncSeparate(GL_FRONT_AND_BACK, GL_ALWAYS, _clear.m_stencil,  0xff) );
 					GL_CHECK(glStencilOpSeparate(GL_FRONT_AND_BACK, GL_REPLACE, GL_REPLACE, GL_REPLACE) );
 				}
 				else
 				{
-					GL_CHECK(glDisable(GL_STENCIL_TEST) );
+					g_glStateCache.disable(GL_STENCIL_TEST);
 				}
 
 				VertexBufferGL& vb = m_vertexBuffers[_clearQuad.m_vb.idx];
 				VertexLayout& layout = _clearQuad.m_layout;
 
-				GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vb.m_id) );
+				g_glStateCache.bindBuffer(GL_ARRAY_BUFFER, vb.m_id);
+
+				updateProgram(_clearQuad.m_program[numMrt-1], true);
 
 				ProgramGL& program = m_program[_clearQuad.m_program[numMrt-1].idx];
 				setProgram(program.m_id);
@@ -4639,6 +4978,7 @@ namespace bgfx { namespace gl
 				updateUniform(m_clearQuadColor.idx, mrtClearColor[0], numMrt * sizeof(float) * 4);
 
 				commit(*program.m_constantBuffer);
+				bindUniformBlocks(program);
 
 				GL_CHECK(glDrawArrays(GL_TRIANGLE_STRIP
 					, 0
@@ -4650,99 +4990,366 @@ namespace bgfx { namespace gl
 		void setProgram(GLuint program)
 		{
 			m_uniformStateCache.saveCurrentProgram(program);
-			GL_CHECK(glUseProgram(program) );
+			g_glStateCache.useProgram(program);
+
+			// Uniform block ranges are shared by all programs, rebind them for new program.
+			m_uniformBlockDirty = UINT8_MAX;
 		}
 
-		// Cache uniform uploads to avoid redundant uploading of state that is
-		// already set to a shader program
-		void setUniform1i(uint32_t loc, int value)
+		// Returns true when program is ready to use. Without _wait draws using
+		// program still being compiled by driver are skipped.
+		bool updateProgram(ProgramHandle _handle, bool _wait)
 		{
-			if (m_uniformStateCache.updateUniformCache(loc, value) )
+			ProgramGL& program = m_program[_handle.idx];
+
+			if (!program.m_linkPending)
 			{
-				GL_CHECK(glUniform1i(loc, value) );
+				return true;
 			}
+
+			const int64_t start = bx::getHPCounter();
+			const bool ready = program.update(_wait);
+			m_shaderCompileTime += bx::getHPCounter() - start;
+
+			return ready;
 		}
 
-		void setUniform1iv(uint32_t loc, int num, const int *data)
+		void bindIndexBuffer(IndexBufferHandle _handle)
 		{
-			bool changed = false;
-			for(int i = 0; i < num; ++i)
+			if (isValid(_handle) )
 			{
-				if (m_uniformStateCache.updateUniformCache(loc+i, data[i]) )
-				{
-					changed = true;
-				}
+				const IndexBufferGL& ib = m_indexBuffers[_handle.idx];
+				g_glStateCache.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, ib.m_id);
 			}
-			if (changed)
+			else
 			{
-				GL_CHECK(glUniform1iv(loc, num, data) );
+				g_glStateCache.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 			}
 		}
 
-		void setUniform4f(uint32_t loc, float x, float y, float z, float w)
+		// Binds cached vertex array object for draw's program, vertex streams,
+		// instance data, and index buffer. Returns false if draw can't use cached
+		// vertex array object, and attributes must be bound with default one.
+		bool bindVertexArray(ProgramHandle _programHandle, const RenderDraw& _draw)
 		{
-			UniformStateCache::f4 f; f.val[0] = x; f.val[1] = y; f.val[2] = z; f.val[3] = w;
-			if (m_uniformStateCache.updateUniformCache(loc, f) )
+			if (!m_vaoSupport)
 			{
-				GL_CHECK(glUniform4f(loc, x, y, z, w) );
+				return false;
 			}
-		}
 
-		void setUniform4fv(uint32_t loc, int num, const float *data)
-		{
-			bool changed = false;
-			for(int i = 0; i < num; ++i)
+			const bool attribBinding = m_vertexAttribBindingSupport;
+			const bool hasStreams    = UINT8_MAX != _draw.m_streamMask;
+			const bool hasInstance   = isValid(_draw.m_instanceDataBuffer);
+
+			VaoKey key;
+			key.m_program    = _programHandle.idx;
+			key.m_streamMask = _draw.m_streamMask;
+
+			if (hasStreams)
 			{
-				if (m_uniformStateCache.updateUniformCache(loc+i, *(const UniformStateCache::f4*)&data[4*i]) )
+				for (uint32_t idx = 0, streamMask = _draw.m_streamMask
+					; 0 != streamMask
+					; streamMask >>= 1, idx += 1
+					)
 				{
-					changed = true;
+					const uint32_t ntz = bx::uint32_cnttz(streamMask);
+					streamMask >>= ntz;
+					idx         += ntz;
+
+					const Stream& stream = _draw.m_stream[idx];
+
+					if (!attribBinding
+					&&  0 != stream.m_startVertex)
+					{
+						// Without separate attribute format, start vertex is baked into
+						// attribute pointers. Caching every start vertex (transient
+						// buffers) would grow cache without bound.
+						return false;
+					}
+
+					const VertexBufferGL& vb = m_vertexBuffers[stream.m_handle.idx];
+					const uint16_t layoutIdx = isValid(stream.m_layoutHandle)
+						? stream.m_layoutHandle.idx
+						: vb.m_layoutHandle.idx
+						;
+
+					key.m_layoutHash[idx] = m_vertexLayouts[layoutIdx].m_hash;
+
+					if (!attribBinding)
+					{
+						key.m_vertexBuffer[idx] = stream.m_handle.idx;
+						key.m_startVertex[idx]  = stream.m_startVertex;
+					}
 				}
 			}
-			if (changed)
-			{
-				GL_CHECK(glUniform4fv(loc, num, data) );
-			}
-		}
 
-		void setUniformMatrix3fv(uint32_t loc, int num, GLboolean transpose, const float *data)
-		{
-			bool changed = false;
-			for(int i = 0; i < num; ++i)
+			key.m_instance = hasInstance;
+
+			if (!attribBinding)
 			{
-				if (m_uniformStateCache.updateUniformCache(loc+i, *(const UniformStateCache::f3x3*)&data[9*i]) )
+				if (hasInstance
+				&&  0 != _draw.m_instanceDataOffset)
 				{
-					changed = true;
+					return false;
 				}
+
+				key.m_instanceDataBuffer = _draw.m_instanceDataBuffer.idx;
+				key.m_instanceDataStride = _draw.m_instanceDataStride;
+				key.m_instanceDataOffset = _draw.m_instanceDataOffset;
+				key.m_indexBuffer        = _draw.m_indexBuffer.idx;
 			}
-			if (changed)
-			{
-				GL_CHECK(glUniformMatrix3fv(loc, num, transpose, data) );
-			}
-		}
 
-		void setUniformMatrix4fv(uint32_t loc, int num, GLboolean transpose, const float *data)
-		{
-			bool changed = false;
-			for(int i = 0; i < num; ++i)
+			bx::HashMurmur2A murmur;
+			murmur.begin();
+			murmur.add(&key, sizeof(key) );
+			const uint32_t hash = murmur.end();
+
+			ProgramGL& program = m_program[_programHandle.idx];
+
+			GLuint vao = m_vaoStateCache.find(hash, key);
+			if (UINT32_MAX != vao)
 			{
-				if (m_uniformStateCache.updateUniformCache(loc+i, *(const UniformStateCache::f4x4*)&data[16*i]) )
-				{
-					changed = true;
-				}
+				g_glStateCache.bindVertexArray(vao);
 			}
-			if (changed)
+			else
 			{
-				GL_CHECK(glUniformMatrix4fv(loc, num, transpose, data) );
-			}
-		}
+				vao = m_vaoStateCache.add(hash, key);
+				g_glStateCache.bindVertexArray(vao);
 
-		void* m_renderdocdll;
+				program.m_vcref.add(hash);
 
-		uint16_t m_numWindows;
-		FrameBufferHandle m_windows[BGFX_CONFIG_MAX_FRAME_BUFFERS];
+				if (attribBinding)
+				{
+					if (hasStreams)
+					{
+						for (uint32_t idx = 0, streamMask = _draw.m_streamMask
+							; 0 != streamMask
+							; streamMask >>= 1, idx += 1
+							)
+						{
+							const uint32_t ntz = bx::uint32_cnttz(streamMask);
+							streamMask >>= ntz;
+							idx         += ntz;
 
-		IndexBufferGL m_indexBuffers[BGFX_CONFIG_MAX_INDEX_BUFFERS];
-		VertexBufferGL m_vertexBuffers[BGFX_CONFIG_MAX_VERTEX_BUFFERS];
+							const Stream& stream = _draw.m_stream[idx];
+							const VertexBufferGL& vb = m_vertexBuffers[stream.m_handle.idx];
+							const uint16_t layoutIdx = isValid(stream.m_layoutHandle)
+								? stream.m_layoutHandle.idx
+								: vb.m_layoutHandle.idx
+								;
+							program.bindAttributeFormats(m_vertexLayouts[layoutIdx], idx);
+						}
+					}
+
+					if (hasInstance)
+					{
+						program.bindInstanceDataFormats(BGFX_CONFIG_MAX_VERTEX_STREAMS);
+					}
+				}
+				else
+				{
+					program.bindAttributesBegin();
+
+					if (hasStreams)
+					{
+						for (uint32_t idx = 0, streamMask = _draw.m_streamMask
+							; 0 != streamMask
+							; streamMask >>= 1, idx += 1
+							)
+						{
+							const uint32_t ntz = bx::uint32_cnttz(streamMask);
+							streamMask >>= ntz;
+							idx         += ntz;
+
+							const Stream& stream = _draw.m_stream[idx];
+							VertexBufferGL& vb = m_vertexBuffers[stream.m_handle.idx];
+							const uint16_t layoutIdx = isValid(stream.m_layoutHandle)
+								? stream.m_layoutHandle.idx
+								: vb.m_layoutHandle.idx
+								;
+
+							vb.m_vcref.add(hash);
+							g_glStateCache.bindBuffer(GL_ARRAY_BUFFER, vb.m_id);
+							program.bindAttributes(m_vertexLayouts[layoutIdx], 0);
+						}
+					}
+
+					if (hasInstance)
+					{
+						VertexBufferGL& vb = m_vertexBuffers[_draw.m_instanceDataBuffer.idx];
+						vb.m_vcref.add(hash);
+						g_glStateCache.bindBuffer(GL_ARRAY_BUFFER, vb.m_id);
+						program.bindInstanceData(_draw.m_instanceDataStride, 0);
+					}
+
+					program.bindAttributesEnd();
+
+					if (isValid(_draw.m_indexBuffer) )
+					{
+						m_indexBuffers[_draw.m_indexBuffer.idx].m_vcref.add(hash);
+					}
+
+					bindIndexBuffer(_draw.m_indexBuffer);
+				}
+			}
+
+			if (attribBinding)
+			{
+				// Vertex buffers and offsets are not part of cache key, base vertex
+				// change is just vertex buffer binding offset change.
+				if (hasStreams)
+				{
+					for (uint32_t idx = 0, streamMask = _draw.m_streamMask
+						; 0 != streamMask
+						; streamMask >>= 1, idx += 1
+						)
+					{
+						const uint32_t ntz = bx::uint32_cnttz(streamMask);
+						streamMask >>= ntz;
+						idx         += ntz;
+
+						const Stream& stream = _draw.m_stream[idx];
+						const VertexBufferGL& vb = m_vertexBuffers[stream.m_handle.idx];
+						const uint16_t layoutIdx = isValid(stream.m_layoutHandle)
+							? stream.m_layoutHandle.idx
+							: vb.m_layoutHandle.idx
+							;
+						const uint16_t stride = m_vertexLayouts[layoutIdx].m_stride;
+
+						GL_CHECK(glBindVertexBuffer(idx, vb.m_id, stream.m_startVertex*stride, stride) );
+					}
+				}
+
+				if (hasInstance)
+				{
+					const VertexBufferGL& vb = m_vertexBuffers[_draw.m_instanceDataBuffer.idx];
+					GL_CHECK(glBindVertexBuffer(BGFX_CONFIG_MAX_VERTEX_STREAMS
+						, vb.m_id
+						, _draw.m_instanceDataOffset
+						, _draw.m_instanceDataStride
+						) );
+				}
+
+				bindIndexBuffer(_draw.m_indexBuffer);
+			}
+
+			return true;
+		}
+
+		// Cache uniform uploads to avoid redundant uploading of state that is
+		// already set to a shader program
+		void setUniform1i(uint32_t loc, int value)
+		{
+			if (m_uniformStateCache.updateUniformCache(loc, value) )
+			{
+				GL_CHECK(glUniform1i(loc, value) );
+			}
+		}
+
+		void setUniform1iv(uint32_t loc, int num, const int *data)
+		{
+			bool changed = false;
+			for(int i = 0; i < num; ++i)
+			{
+				if (m_uniformStateCache.updateUniformCache(loc+i, data[i]) )
+				{
+					changed = true;
+				}
+			}
+			if (changed)
+			{
+				GL_CHECK(glUniform1iv(loc, num, data) );
+			}
+		}
+
+		void setUniform4f(uint32_t loc, float x, float y, float z, float w)
+		{
+			UniformStateCache::f4 f; f.val[0] = x; f.val[1] = y; f.val[2] = z; f.val[3] = w;
+			if (0 != (loc & BGFX_GL_UNIFORM_BLOCK_LOC) )
+			{
+				setUniformBlock(loc, UniformType::Vec4, 1, f.val);
+				return;
+			}
+
+			if (m_uniformStateCache.updateUniformCache(loc, f) )
+			{
+				GL_CHECK(glUniform4f(loc, x, y, z, w) );
+			}
+		}
+
+		void setUniform4fv(uint32_t loc, int num, const float *data)
+		{
+			if (0 != (loc & BGFX_GL_UNIFORM_BLOCK_LOC) )
+			{
+				setUniformBlock(loc, UniformType::Vec4, num, data);
+				return;
+			}
+
+			bool changed = false;
+			for(int i = 0; i < num; ++i)
+			{
+				if (m_uniformStateCache.updateUniformCache(loc+i, *(const UniformStateCache::f4*)&data[4*i]) )
+				{
+					changed = true;
+				}
+			}
+			if (changed)
+			{
+				GL_CHECK(glUniform4fv(loc, num, data) );
+			}
+		}
+
+		void setUniformMatrix3fv(uint32_t loc, int num, GLboolean transpose, const float *data)
+		{
+			if (0 != (loc & BGFX_GL_UNIFORM_BLOCK_LOC) )
+			{
+				setUniformBlock(loc, UniformType::Mat3, num, data);
+				return;
+			}
+
+			bool changed = false;
+			for(int i = 0; i < num; ++i)
+			{
+				if (m_uniformStateCache.updateUniformCache(loc+i, *(const UniformStateCache::f3x3*)&data[9*i]) )
+				{
+					changed = true;
+				}
+			}
+			if (changed)
+			{
+				GL_CHECK(glUniformMatrix3fv(loc, num, transpose, data) );
+			}
+		}
+
+		void setUniformMatrix4fv(uint32_t loc, int num, GLboolean transpose, const float *data)
+		{
+			if (0 != (loc & BGFX_GL_UNIFORM_BLOCK_LOC) )
+			{
+				setUniformBlock(loc, UniformType::Mat4, num, data);
+				return;
+			}
+
+			bool changed = false;
+			for(int i = 0; i < num; ++i)
+			{
+				if (m_uniformStateCache.updateUniformCache(loc+i, *(const UniformStateCache::f4x4*)&data[16*i]) )
+				{
+					changed = true;
+				}
+			}
+			if (changed)
+			{
+				GL_CHECK(glUniformMatrix4fv(loc, num, transpose, data) );
+			}
+		}
+
+		void* m_renderdocdll;
+
+		uint16_t m_numWindows;
+		FrameBufferHandle m_windows[BGFX_CONFIG_MAX_FRAME_BUFFERS];
+
+		IndexBufferGL m_indexBuffers[BGFX_CONFIG_MAX_INDEX_BUFFERS];
+		VertexBufferGL m_vertexBuffers[BGFX_CONFIG_MAX_VERTEX_BUFFERS];
 		ShaderGL m_shaders[BGFX_CONFIG_MAX_SHADERS];
 		ProgramGL m_program[BGFX_CONFIG_MAX_PROGRAMS];
 		TextureGL m_textures[BGFX_CONFIG_MAX_TEXTURES];
@@ -4754,9 +5361,19 @@ namespace bgfx { namespace gl
 		TimerQueryGL m_gpuTimer;
 		OcclusionQueryGL m_occlusionQuery;
 
+		VaoStateCache m_vaoStateCache;
 		SamplerStateCache m_samplerStateCache;
 		UniformStateCache m_uniformStateCache;
 
+		BufferRingGL m_uniformBufferRing;
+		uint8_t m_uniformBlockData[2][BGFX_GL_UNIFORM_BLOCK_MAX_SIZE];
+		uint8_t m_uniformBlockDirty;
+
+		ReadBackGL m_readBack;
+
+		uint32_t m_numProgramsPending;
+		int64_t m_shaderCompileTime;
+
 		TextVideoMem m_textVideoMem;
 		bool m_rtMsaa;
 
@@ -4774,6 +5391,10 @@ namespace bgfx { namespace gl
 		bool m_blitSupported;
 		bool m_readBackSupported;
 		bool m_vaoSupport;
+		bool m_vertexAttribBindingSupport;
+		bool m_uniformBlockSupport;
+		bool m_asyncReadBackSupport;
+		bool m_parallelShaderCompileSupport;
 		bool m_samplerObjectSupport;
 		bool m_shadowSamplersSupport;
 		bool m_srgbWriteControlSupport;
@@ -4799,6 +5420,7 @@ namespace bgfx { namespace gl
 		};
 		GLuint m_msaaBlitProgram;
 		GlContext m_glctx;
+		SwapChainGL* m_currentSwapChain;
 		bool m_needPresent;
 
 		UniformHandle m_clearQuadColor;
@@ -5018,22 +5640,69 @@ namespace bgfx { namespace gl
 		m_id = glCreateProgram();
 		BX_TRACE("Program create: GL%d: GL%d, GL%d", m_id, _vsh.m_id, _fsh.m_id);
 
-		const uint64_t id = (uint64_t(_vsh.m_hash)<<32) | _fsh.m_hash;
-		const bool cached = s_renderGL->programFetchFromCache(m_id, id);
+		m_vsh     = _vsh.m_id;
+		m_fsh     = _fsh.m_id;
+		m_cacheId = (uint64_t(_vsh.m_hash)<<32) | _fsh.m_hash;
+		m_cached  = s_renderGL->programFetchFromCache(m_id, m_cacheId);
 
-		if (!cached)
+		if (!m_cached
+		&&  0 != m_vsh)
 		{
-			GLint linked = 0;
-			if (0 != _vsh.m_id)
+			GL_CHECK(glAttachShader(m_id, m_vsh) );
+
+			if (0 != m_fsh)
 			{
-				GL_CHECK(glAttachShader(m_id, _vsh.m_id) );
+				GL_CHECK(glAttachShader(m_id, m_fsh) );
+			}
 
-				if (0 != _fsh.m_id)
-				{
-					GL_CHECK(glAttachShader(m_id, _fsh.m_id) );
-				}
+			GL_CHECK(glLinkProgram(m_id) );
+
+			if (s_renderGL->m_parallelShaderCompileSupport)
+			{
+				// Driver compiles and links on its own threads, link status is
+				// checked once update observes completion.
+				m_linkPending = true;
+				++s_renderGL->m_numProgramsPending;
+				return;
+			}
+		}
+
+		link();
+	}
+
+	bool ProgramGL::update(bool _wait)
+	{
+		if (!m_linkPending)
+		{
+			return true;
+		}
+
+		if (!_wait)
+		{
+			GLint completed = 0;
+			GL_CHECK(glGetProgramiv(m_id, GL_COMPLETION_STATUS_KHR, &completed) );
+
+			if (0 == completed)
+			{
+				return false;
+			}
+		}
+
+		m_linkPending = false;
+		--s_renderGL->m_numProgramsPending;
+
+		link();
+
+		return true;
+	}
 
-				GL_CHECK(glLinkProgram(m_id) );
+	void ProgramGL::link()
+	{
+		if (!m_cached)
+		{
+			GLint linked = 0;
+			if (0 != m_vsh)
+			{
 				GL_CHECK(glGetProgramiv(m_id, GL_LINK_STATUS, &linked) );
 
 				if (0 == linked)
@@ -5041,33 +5710,52 @@ namespace bgfx { namespace gl
 					char log[1024];
 					GL_CHECK(glGetProgramInfoLog(m_id, sizeof(log), NULL, log) );
 					BX_TRACE("%d: %s", linked, log);
+
+					if (s_renderGL->m_parallelShaderCompileSupport)
+					{
+						const GLuint shaders[] = { m_vsh, m_fsh };
+						for (uint32_t ii = 0; ii < BX_COUNTOF(shaders); ++ii)
+						{
+							GLint compiled = 1;
+							if (0 != shaders[ii])
+							{
+								GL_CHECK(glGetShaderiv(shaders[ii], GL_COMPILE_STATUS, &compiled) );
+							}
+
+							if (0 == compiled)
+							{
+								GL_CHECK(glGetShaderInfoLog(shaders[ii], sizeof(log), NULL, log) );
+								BGFX_FATAL(false, bgfx::Fatal::InvalidShader, "Failed to compile shader. %d: %s", compiled, log);
+							}
+						}
+					}
 				}
 			}
 
 			if (0 == linked)
 			{
-				BX_WARN(0 != _vsh.m_id, "Invalid vertex/compute shader.");
-				GL_CHECK(glDeleteProgram(m_id) );
+				BX_WARN(0 != m_vsh, "Invalid vertex/compute shader.");
+				g_glStateCache.deleteProgram(m_id);
 				m_usedCount = 0;
 				m_id = 0;
 				return;
 			}
 
-			s_renderGL->programCache(m_id, id);
+			s_renderGL->programCache(m_id, m_cacheId);
 		}
 
 		init();
 
-		if (!cached
+		if (!m_cached
 		&&  s_renderGL->m_workaround.m_detachShader)
 		{
 			// Must be after init, otherwise init might fail to lookup shader
 			// info (NVIDIA Tegra 3 OpenGL ES 2.0 14.01003).
-			GL_CHECK(glDetachShader(m_id, _vsh.m_id) );
+			GL_CHECK(glDetachShader(m_id, m_vsh) );
 
-			if (0 != _fsh.m_id)
+			if (0 != m_fsh)
 			{
-				GL_CHECK(glDetachShader(m_id, _fsh.m_id) );
+				GL_CHECK(glDetachShader(m_id, m_fsh) );
 			}
 		}
 	}
@@ -5080,11 +5768,21 @@ namespace bgfx { namespace gl
 			m_constantBuffer = NULL;
 		}
 		m_numPredefined = 0;
+		m_uniformBlockSize[0] = 0;
+		m_uniformBlockSize[1] = 0;
+
+		m_vcref.invalidate(s_renderGL->m_vaoStateCache);
+
+		if (m_linkPending)
+		{
+			m_linkPending = false;
+			--s_renderGL->m_numProgramsPending;
+		}
 
 		if (0 != m_id)
 		{
 			s_renderGL->setProgram(0);
-			GL_CHECK(glDeleteProgram(m_id) );
+			g_glStateCache.deleteProgram(m_id);
 			m_id = 0;
 		}
 	}
@@ -5162,6 +5860,36 @@ namespace bgfx { namespace gl
 		m_numPredefined = 0;
 		m_numSamplers = 0;
 
+		GLuint uniformBlockIndex[2] = { GL_INVALID_INDEX, GL_INVALID_INDEX };
+
+		if (s_renderGL->m_uniformBlockSupport)
+		{
+			for (uint32_t stage = 0; stage < BX_COUNTOF(uniformBlockIndex); ++stage)
+			{
+				m_uniformBlockSize[stage] = 0;
+
+				const GLuint index = glGetUniformBlockIndex(m_id, s_uniformBlockName[stage]);
+				if (GL_INVALID_INDEX != index)
+				{
+					GLint size = 0;
+					GL_CHECK(glGetActiveUniformBlockiv(m_id, index, GL_UNIFORM_BLOCK_DATA_SIZE, &size) );
+					GL_CHECK(glUniformBlockBinding(m_id, index, stage) );
+
+					BX_WARN(size <= BGFX_GL_UNIFORM_BLOCK_MAX_SIZE
+						, "Uniform block %s is too large (%d, max: %d)."
+						, s_uniformBlockName[stage]
+						, size
+						, BGFX_GL_UNIFORM_BLOCK_MAX_SIZE
+						);
+
+					uniformBlockIndex[stage]  = index;
+					m_uniformBlockSize[stage] = bx::min<uint32_t>(size, BGFX_GL_UNIFORM_BLOCK_MAX_SIZE);
+
+					BX_TRACE("Uniform block %s index %d, size %d.", s_uniformBlockName[stage], index, size);
+				}
+			}
+		}
+
 		BX_TRACE("Uniforms (%d):", activeUniforms);
 		for (int32_t ii = 0; ii < activeUniforms; ++ii)
 		{
@@ -5210,6 +5938,34 @@ namespace bgfx { namespace gl
 
 			num = bx::uint32_max(num, 1);
 
+			if (-1 == loc
+			&&  (GL_INVALID_INDEX != uniformBlockIndex[0] || GL_INVALID_INDEX != uniformBlockIndex[1]) )
+			{
+				const GLuint index = GLuint(ii);
+
+				GLint blockIndex = -1;
+				GL_CHECK(glGetActiveUniformsiv(m_id, 1, &index, GL_UNIFORM_BLOCK_INDEX, &blockIndex) );
+
+				if (-1 != blockIndex)
+				{
+					GLint blockOffset = 0;
+					GL_CHECK(glGetActiveUniformsiv(m_id, 1, &index, GL_UNIFORM_OFFSET, &blockOffset) );
+
+					loc = GLint(0
+						| BGFX_GL_UNIFORM_BLOCK_LOC
+						| (GLuint(blockIndex) == uniformBlockIndex[1] ? BGFX_GL_UNIFORM_BLOCK_LOC_FRAGMENT : 0)
+						| (blockOffset & BGFX_GL_UNIFORM_BLOCK_LOC_OFFSET_MASK)
+						);
+
+					// Block members are reported as <block name>.<uniform name>.
+					const bx::StringView dot = bx::strFind(name, '.');
+					if (!dot.isEmpty() )
+					{
+						bx::memMove(name, dot.getPtr()+1, bx::strLen(dot.getPtr()+1) + 1);
+					}
+				}
+			}
+
 			int32_t offset = 0;
 			const bx::StringView array = bx::strFind(name, '[');
 			if (!array.isEmpty() )
@@ -5500,16 +6256,122 @@ namespace bgfx { namespace gl
 		}
 	}
 
+	void ProgramGL::bindAttributeFormats(const VertexLayout& _layout, GLuint _binding) const
+	{
+		for (uint32_t ii = 0, iiEnd = m_usedCount; ii < iiEnd; ++ii)
+		{
+			Attrib::Enum attr = Attrib::Enum(m_used[ii]);
+			GLint loc = m_attributes[attr];
+
+			if (-1 != loc
+			&&  UINT16_MAX != _layout.m_attributes[attr])
+			{
+				uint8_t num;
+				AttribType::Enum type;
+				bool normalized;
+				bool asInt;
+				_layout.decode(attr, num, type, normalized, asInt);
+
+				GL_CHECK(glEnableVertexAttribArray(loc) );
+
+				if (!isFloat(type)
+				&&  !normalized)
+				{
+					GL_CHECK(glVertexAttribIFormat(loc, num, s_attribType[type], _layout.m_offset[attr]) );
+				}
+				else
+				{
+					GL_CHECK(glVertexAttribFormat(loc, num, s_attribType[type], normalized, _layout.m_offset[attr]) );
+				}
+
+				GL_CHECK(glVertexAttribBinding(loc, _binding) );
+			}
+		}
+
+		GL_CHECK(glVertexBindingDivisor(_binding, 0) );
+	}
+
+	void ProgramGL::bindInstanceDataFormats(GLuint _binding) const
+	{
+		for (uint32_t ii = 0; -1 != m_instanceData[ii]; ++ii)
+		{
+			GLint loc = m_instanceData[ii];
+
+			GL_CHECK(glEnableVertexAttribArray(loc) );
+			GL_CHECK(glVertexAttribFormat(loc, 4, GL_FLOAT, GL_FALSE, m_instanceOffset[ii]) );
+			GL_CHECK(glVertexAttribBinding(loc, _binding) );
+		}
+
+		GL_CHECK(glVertexBindingDivisor(_binding, 1) );
+	}
+
 	void IndexBufferGL::destroy()
 	{
-		GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0) );
-		GL_CHECK(glDeleteBuffers(1, &m_id) );
+		m_vcref.invalidate(s_renderGL->m_vaoStateCache);
+
+		g_glStateCache.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+		g_glStateCache.deleteBuffers(1, &m_id);
 	}
 
 	void VertexBufferGL::destroy()
 	{
-		GL_CHECK(glBindBuffer(m_target, 0) );
-		GL_CHECK(glDeleteBuffers(1, &m_id) );
+		m_vcref.invalidate(s_renderGL->m_vaoStateCache);
+
+		g_glStateCache.bindBuffer(m_target, 0);
+		g_glStateCache.deleteBuffers(1, &m_id);
+	}
+
+	void BufferRingGL::create(GLenum _target, uint32_t _size, uint32_t _align)
+	{
+		m_target = _target;
+		m_size   = _size;
+		m_pos    = 0;
+		m_align  = bx::max<uint32_t>(_align, 16);
+
+		GL_CHECK(glGenBuffers(1, &m_id) );
+		BX_ASSERT(0 != m_id, "Failed to generate buffer id.");
+		g_glStateCache.bindBuffer(m_target, m_id);
+		GL_CHECK(glBufferData(m_target, m_size, NULL, GL_STREAM_DRAW) );
+		g_glStateCache.bindBuffer(m_target, 0);
+	}
+
+	void BufferRingGL::destroy()
+	{
+		if (0 != m_id)
+		{
+			g_glStateCache.bindBuffer(m_target, 0);
+			g_glStateCache.deleteBuffers(1, &m_id);
+			m_id = 0;
+		}
+	}
+
+	uint32_t BufferRingGL::write(const void* _data, uint32_t _size)
+	{
+		BX_ASSERT(_size <= m_size, "Write size %d is larger than ring size %d.", _size, m_size);
+
+		uint32_t offset = bx::alignUp(m_pos, m_align);
+
+		g_glStateCache.bindBuffer(m_target, m_id);
+
+		if (offset + _size > m_size)
+		{
+			// Orphan storage on wrap, so that driver doesn't have to wait for
+			// draws still reading previous contents of the ring.
+			GL_CHECK(glBufferData(m_target, m_size, NULL, GL_STREAM_DRAW) );
+			offset = 0;
+		}
+
+		GL_CHECK(glBufferSubData(m_target, offset, _size, _data) );
+
+		m_pos = offset + _size;
+
+		return offset;
+	}
+
+	void BufferRingGL::bind(GLuint _binding, const void* _data, uint32_t _size)
+	{
+		const uint32_t offset = write(_data, _size);
+		g_glStateCache.bindBufferRange(m_target, _binding, m_id, offset, _size);
 	}
 
 	bool TextureGL::init(GLenum _target, uint32_t _width, uint32_t _height, uint32_t _depth, uint8_t _numMips, uint64_t _flags)
@@ -5521,6 +6383,7 @@ namespace bgfx { namespace gl
 		m_height  = _height;
 		m_depth   = _depth;
 		m_currentSamplerHash = UINT32_MAX;
+		m_immutable = false;
 
 		const bool writeOnly    = 0 != (m_flags&BGFX_TEXTURE_RT_WRITE_ONLY);
 		const bool computeWrite = 0 != (m_flags&BGFX_TEXTURE_COMPUTE_WRITE );
@@ -5536,7 +6399,7 @@ namespace bgfx { namespace gl
 		{
 			GL_CHECK(glGenTextures(1, &m_id) );
 			BX_ASSERT(0 != m_id, "Failed to generate texture id.");
-			GL_CHECK(glBindTexture(_target, m_id) );
+			g_glStateCache.bindTexture(_target, m_id);
 			GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1) );
 
 			const TextureFormatInfo& tfi = s_textureFormat[m_textureFormat];
@@ -5572,19 +6435,21 @@ namespace bgfx { namespace gl
 				: s_textureFormat[m_textureFormat].m_internalFmt
 				;
 
-			if (textureArray)
-			{
-				GL_CHECK(glTexStorage3D(_target
-					, _numMips
-					, internalFmt
-					, m_width
-					, m_height
-					, _depth
-					) );
-			}
-			else if (computeWrite)
+			// Allocate whole mip chain upfront when immutable storage is supported for the format,
+			// uploads after this point only go through glTexSubImage*.
+			m_immutable = false
+				|| textureArray
+				|| computeWrite
+				|| (true
+					&& GL_TEXTURE_2D_MULTISAMPLE != _target
+					&& s_textureStorage[srgb][m_textureFormat]
+					)
+				;
+
+			if (m_immutable)
 			{
-				if (_target == GL_TEXTURE_3D)
+				if (textureArray
+				||  _target == GL_TEXTURE_3D)
 				{
 					GL_CHECK(glTexStorage3D(_target
 						, _numMips
@@ -5605,8 +6470,19 @@ namespace bgfx { namespace gl
 				}
 			}
 
-			setSamplerState(uint32_t(_flags), NULL);
-
+			if (s_renderGL->m_samplerObjectSupport)
+			{
+				// Sampler state comes from sampler objects, texture parameters are never touched.
+				if (!m_immutable)
+				{
+					GL_CHECK(glTexParameteri(m_target, GL_TEXTURE_MAX_LEVEL, m_numMips-1) );
+				}
+			}
+			else
+			{
+				setSamplerState(uint32_t(_flags), NULL);
+			}
+
 			if (BX_ENABLED(BGFX_CONFIG_RENDERER_OPENGL)
 			&&  TextureFormat::BGRA8 == m_requestedFormat
 			&&  !s_textureFormat[m_requestedFormat].m_supported
@@ -5808,16 +6684,35 @@ namespace bgfx { namespace gl
 						if (compressed
 						&& !convert)
 						{
-							GL_CHECK(compressedTexImage(imageTarget
-								, lod
-								, internalFmt
-								, width
-								, height
-								, depth
-								, 0
-								, mip.m_size
-								, mip.m_data
-								) );
+							if (m_immutable
+							&&  !textureArray)
+							{
+								GL_CHECK(compressedTexSubImage(imageTarget
+									, lod
+									, 0
+									, 0
+									, 0
+									, width
+									, height
+									, depth
+									, internalFmt
+									, mip.m_size
+									, mip.m_data
+									) );
+							}
+							else
+							{
+								GL_CHECK(compressedTexImage(imageTarget
+									, lod
+									, internalFmt
+									, width
+									, height
+									, depth
+									, 0
+									, mip.m_size
+									, mip.m_data
+									) );
+							}
 						}
 						else
 						{
@@ -5837,21 +6732,40 @@ namespace bgfx { namespace gl
 								data = temp;
 							}
 
-							GL_CHECK(texImage(imageTarget
-								, msaaQuality
-								, lod
-								, internalFmt
-								, width
-								, height
-								, depth
-								, 0
-								, fmt
-								, m_type
-								, data
-								) );
+							if (m_immutable
+							&&  !textureArray)
+							{
+								GL_CHECK(texSubImage(imageTarget
+									, lod
+									, 0
+									, 0
+									, 0
+									, width
+									, height
+									, depth
+									, fmt
+									, m_type
+									, data
+									) );
+							}
+							else
+							{
+								GL_CHECK(texImage(imageTarget
+									, msaaQuality
+									, lod
+									, internalFmt
+									, width
+									, height
+									, depth
+									, 0
+									, fmt
+									, m_type
+									, data
+									) );
+							}
 						}
 					}
-					else if (!computeWrite)
+					else if (!m_immutable)
 					{
 						if (compressed
 						&& !convert)
@@ -5918,7 +6832,7 @@ namespace bgfx { namespace gl
 			}
 		}
 
-		GL_CHECK(glBindTexture(m_target, 0) );
+		g_glStateCache.bindTexture(m_target, 0);
 	}
 
 	void TextureGL::destroy()
@@ -5926,8 +6840,8 @@ namespace bgfx { namespace gl
 		if (0 == (m_flags & BGFX_SAMPLER_INTERNAL_SHARED)
 		&&  0 != m_id)
 		{
-			GL_CHECK(glBindTexture(m_target, 0) );
-			GL_CHECK(glDeleteTextures(1, &m_id) );
+			g_glStateCache.bindTexture(m_target, 0);
+			g_glStateCache.deleteTextures(1, &m_id);
 			m_id = 0;
 		}
 
@@ -5951,7 +6865,7 @@ namespace bgfx { namespace gl
 		const uint32_t rectpitch = _rect.m_width*bpp/8;
 		uint32_t srcpitch  = UINT16_MAX == _pitch ? rectpitch : _pitch;
 
-		GL_CHECK(glBindTexture(m_target, m_id) );
+		g_glStateCache.bindTexture(m_target, m_id);
 		GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1) );
 
 		GLenum target = isCubeMap()
@@ -6171,8 +7085,8 @@ namespace bgfx { namespace gl
 			;
 		const uint32_t index = (flags & BGFX_SAMPLER_BORDER_COLOR_MASK) >> BGFX_SAMPLER_BORDER_COLOR_SHIFT;
 
-		GL_CHECK(glActiveTexture(GL_TEXTURE0+_stage) );
-		GL_CHECK(glBindTexture(m_target, m_id) );
+		g_glStateCache.activeTexture(GL_TEXTURE0+_stage);
+		g_glStateCache.bindTexture(m_target, m_id);
 
 		if (s_renderGL->m_samplerObjectSupport)
 		{
@@ -6191,9 +7105,20 @@ namespace bgfx { namespace gl
 		&&  1 < m_numMips
 		&&  0 != (_resolve & BGFX_RESOLVE_AUTO_GEN_MIPS) )
 		{
-			GL_CHECK(glBindTexture(m_target, m_id) );
+			g_glStateCache.bindTexture(m_target, m_id);
 			GL_CHECK(glGenerateMipmap(m_target) );
-			GL_CHECK(glBindTexture(m_target, 0) );
+			g_glStateCache.bindTexture(m_target, 0);
+		}
+	}
+
+	void TextureGL::setResidentMips(uint8_t _minMip)
+	{
+		if (0 != m_id
+		&&  (BX_ENABLED(BGFX_CONFIG_RENDERER_OPENGL) || s_renderGL->m_gles3) )
+		{
+			g_glStateCache.bindTexture(m_target, m_id);
+			GL_CHECK(glTexParameteri(m_target, GL_TEXTURE_BASE_LEVEL, _minMip) );
+			g_glStateCache.bindTexture(m_target, 0);
 		}
 	}
 
@@ -6204,6 +7129,150 @@ namespace bgfx { namespace gl
 		bx::memCopy(_str, _insert, len);
 	}
 
+	static bx::StringView nextWord(bx::StringView& _parse)
+	{
+		bx::StringView word = bx::strWord(bx::strLTrimSpace(_parse) );
+		_parse = bx::strLTrimSpace(bx::StringView(word.getTerm(), _parse.getTerm() ) );
+		return word;
+	}
+
+	// Matches `uniform [precision] vec4|mat3|mat4 name[N];` declaration, which can be
+	// moved into std140 uniform block. Size is member size with std140 layout.
+	static bool parseUniformBlockMember(const bx::StringView& _line, bx::StringView& _outDecl, bx::StringView& _outName, uint32_t& _outSize)
+	{
+		bx::StringView parse = _line;
+
+		if (0 != bx::strCmp(nextWord(parse), "uniform") )
+		{
+			return false;
+		}
+
+		const char* decl = parse.getPtr();
+
+		bx::StringView word = nextWord(parse);
+		if (0 == bx::strCmp(word, "lowp")
+		||  0 == bx::strCmp(word, "mediump")
+		||  0 == bx::strCmp(word, "highp") )
+		{
+			word = nextWord(parse);
+		}
+
+		// std140 pads mat3 columns to vec4.
+		uint32_t size;
+		if (0 == bx::strCmp(word, "vec4") )
+		{
+			size = 16;
+		}
+		else if (0 == bx::strCmp(word, "mat3") )
+		{
+			size = 48;
+		}
+		else if (0 == bx::strCmp(word, "mat4") )
+		{
+			size = 64;
+		}
+		else
+		{
+			return false;
+		}
+
+		_outName = nextWord(parse);
+		_outDecl = bx::StringView(decl, _line.getTerm() );
+
+		const bx::StringView array = bx::strFind(parse, '[');
+		if (!array.isEmpty() )
+		{
+			const bx::StringView end = bx::strFind(bx::StringView(array.getPtr()+1, parse.getTerm() ), ']');
+
+			uint32_t num = 1;
+			bx::fromString(&num, bx::StringView(array.getPtr()+1, end.getPtr() ) );
+			size *= bx::max<uint32_t>(num, 1);
+		}
+
+		_outSize = size;
+
+		return !_outName.isEmpty()
+			&& bx::strFind(parse, ',').isEmpty()
+			;
+	}
+
+	// Moves vec4/mat3/mat4 uniforms into std140 uniform block, and redirects uses
+	// of uniform names to block members. Shaders whose block wouldn't fit into
+	// BGFX_GL_UNIFORM_BLOCK_MAX_SIZE are left as is, and use glUniform* calls.
+	static void writeUniformBlock(bx::WriterI* _writer, const bx::StringView& _code, uint32_t _stage, bx::Error* _err)
+	{
+		bx::StringView decl;
+		bx::StringView name;
+		uint32_t size;
+
+		uint32_t blockSize = 0;
+
+		for (bx::LineReader reader(_code); !reader.isDone();)
+		{
+			if (parseUniformBlockMember(reader.next(), decl, name, size) )
+			{
+				blockSize += size;
+			}
+		}
+
+		if (blockSize > BGFX_GL_UNIFORM_BLOCK_MAX_SIZE)
+		{
+			BX_TRACE("Uniform block %s is too large (%d, max: %d), using glUniform* instead."
+				, s_uniformBlockName[_stage]
+				, blockSize
+				, BGFX_GL_UNIFORM_BLOCK_MAX_SIZE
+				);
+			bx::write(_writer, _code.getPtr(), _code.getLength(), _err);
+			return;
+		}
+
+		uint32_t num = 0;
+
+		for (bx::LineReader reader(_code); !reader.isDone();)
+		{
+			if (parseUniformBlockMember(reader.next(), decl, name, size) )
+			{
+				if (0 == num)
+				{
+					bx::write(_writer, _err, "layout(std140) uniform %s\n{\n", s_uniformBlockName[_stage]);
+				}
+
+				bx::write(_writer, _err, "\t%.*s\n", decl.getLength(), decl.getPtr() );
+				++num;
+			}
+		}
+
+		if (0 != num)
+		{
+			bx::write(_writer, _err, "} %s;\n", s_uniformBlockInstanceName[_stage]);
+
+			for (bx::LineReader reader(_code); !reader.isDone();)
+			{
+				if (parseUniformBlockMember(reader.next(), decl, name, size) )
+				{
+					bx::write(_writer, _err
+						, "#define %.*s %s.%.*s\n"
+						, name.getLength(), name.getPtr()
+						, s_uniformBlockInstanceName[_stage]
+						, name.getLength(), name.getPtr()
+						);
+				}
+			}
+		}
+
+		for (bx::LineReader reader(_code); !reader.isDone();)
+		{
+			const bx::StringView line = reader.next();
+
+			if (0 == num
+			||  !parseUniformBlockMember(line, decl, name, size) )
+			{
+				bx::write(_writer, line, _err);
+				bx::write(_writer, '\n', _err);
+			}
+		}
+	}
+
 	void ShaderGL::create(const Memory* _mem)
 	{
 		bx::MemoryReader reader(_mem->data, _mem->size);
@@ -6296,7 +7365,11 @@ namespace bgfx { namespace gl
 			if (GL_COMPUTE_SHADER != m_type
 			&&  0 != bx::strCmp(code, "#version", 8) ) // #2000
 			{
-				int32_t tempLen = code.getLength() + (4<<10);
+				// Uniform block declaration and redirect defines can take up to
+				// size of original uniform declarations.
+				const bool uniformBlock = s_renderGL->m_uniformBlockSupport;
+
+				int32_t tempLen = code.getLength()*(uniformBlock ? 2 : 1) + (4<<10);
 				char* temp = (char*)alloca(tempLen);
 				bx::StaticMemoryBlockWriter writer(temp, tempLen);
 
@@ -6838,7 +7911,15 @@ namespace bgfx { namespace gl
 							);
 					}
 
-					bx::write(&writer, code.getPtr(), code.getLength(), &err);
+					if (uniformBlock)
+					{
+						writeUniformBlock(&writer, code, m_type == GL_FRAGMENT_SHADER ? 1 : 0, &err);
+					}
+					else
+					{
+						bx::write(&writer, code.getPtr(), code.getLength(), &err);
+					}
+
 					bx::write(&writer, '\0', &err);
 				}
 
@@ -6880,6 +7961,13 @@ namespace bgfx { namespace gl
 
 			GL_CHECK(glCompileShader(m_id) );
 
+			if (s_renderGL->m_parallelShaderCompileSupport)
+			{
+				// Querying compile status would wait for compile to finish.
+				// Compile errors are reported when program link fails.
+				return;
+			}
+
 			GLint compiled = 0;
 			GL_CHECK(glGetShaderiv(m_id, GL_COMPILE_STATUS, &compiled) );
 
@@ -7143,6 +8231,7 @@ namespace bgfx { namespace gl
 	{
 		BX_UNUSED(_format, _depthFormat);
 		m_swapChain = s_renderGL->m_glctx.createSwapChain(_nwh);
+		g_glStateCache.invalidate();
 		m_width     = _width;
 		m_height    = _height;
 		m_numTh     = 0;
@@ -7161,6 +8250,7 @@ namespace bgfx { namespace gl
 		if (NULL != m_swapChain)
 		{
 			s_renderGL->m_glctx.destroySwapChain(m_swapChain);
+			g_glStateCache.invalidate();
 			m_swapChain = NULL;
 		}
 
@@ -7191,7 +8281,7 @@ namespace bgfx { namespace gl
 
 					if (!bimg::isDepth(format) )
 					{
-						GL_CHECK(glDisable(GL_SCISSOR_TEST) );
+						g_glStateCache.disable(GL_SCISSOR_TEST);
 
 						GL_CHECK(glBindFramebuffer(GL_READ_FRAMEBUFFER, m_fbo[0]) );
 						GL_CHECK(glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_fbo[1]) );
@@ -7215,7 +8305,7 @@ namespace bgfx { namespace gl
 					}
 					else if (!writeOnly)
 					{
-						GL_CHECK(glDisable(GL_SCISSOR_TEST) );
+						g_glStateCache.disable(GL_SCISSOR_TEST);
 
 						GL_CHECK(glBindFramebuffer(GL_READ_FRAMEBUFFER, m_fbo[0]) );
 						GL_CHECK(glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_fbo[1]) );
@@ -7372,6 +8462,165 @@ namespace bgfx { namespace gl
 		}
 	}
 
+	void ReadBackGL::create()
+	{
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_request); ++ii)
+		{
+			Request& request = m_request[ii];
+			GL_CHECK(glGenBuffers(1, &request.m_pbo) );
+			request.m_pboSize = 0;
+			request.m_sync    = NULL;
+		}
+	}
+
+	void ReadBackGL::destroy()
+	{
+		flush();
+
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_request); ++ii)
+		{
+			Request& request = m_request[ii];
+			g_glStateCache.deleteBuffers(1, &request.m_pbo);
+		}
+	}
+
+	void ReadBackGL::begin(uint32_t _size)
+	{
+		while (0 == m_control.reserve(1) )
+		{
+			resolve(true);
+		}
+
+		Request& request = m_request[m_control.m_current];
+		g_glStateCache.bindBuffer(GL_PIXEL_PACK_BUFFER, request.m_pbo);
+
+		if (request.m_pboSize < _size)
+		{
+			request.m_pboSize = _size;
+			GL_CHECK(glBufferData(GL_PIXEL_PACK_BUFFER, _size, NULL, GL_STREAM_READ) );
+		}
+
+		request.m_size = _size;
+	}
+
+	void ReadBackGL::end(Type::Enum _type, void* _data, uint32_t _width, uint32_t _height, bool _swizzle, const char* _filePath)
+	{
+		Request& request = m_request[m_control.m_current];
+		g_glStateCache.bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+		request.m_sync    = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		request.m_data    = _data;
+		request.m_width   = _width;
+		request.m_height  = _height;
+		request.m_type    = uint8_t(_type);
+		request.m_swizzle = _swizzle;
+		request.m_filePath.set(NULL != _filePath ? _filePath : "");
+
+		m_numPendingTextures += Type::Texture == _type;
+
+		m_control.commit(1);
+	}
+
+	void ReadBackGL::update(bool _wait)
+	{
+		while (resolve(_wait && 0 != m_numPendingTextures) )
+		{
+		}
+	}
+
+	void ReadBackGL::flush()
+	{
+		while (resolve(true) )
+		{
+		}
+	}
+
+	bool ReadBackGL::resolve(bool _wait)
+	{
+		if (0 == m_control.available() )
+		{
+			return false;
+		}
+
+		Request& request = m_request[m_control.m_read];
+
+		const GLenum result = glClientWaitSync(request.m_sync
+			, GL_SYNC_FLUSH_COMMANDS_BIT
+			, _wait ? UINT64_MAX : 0
+			);
+
+		if (GL_TIMEOUT_EXPIRED == result)
+		{
+			return false;
+		}
+
+		GL_CHECK(glDeleteSync(request.m_sync) );
+		request.m_sync = NULL;
+
+		g_glStateCache.bindBuffer(GL_PIXEL_PACK_BUFFER, request.m_pbo);
+		const void* data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, request.m_size, GL_MAP_READ_BIT);
+
+		if (NULL != data)
+		{
+			const uint32_t pitch = request.m_width*4;
+
+			switch (request.m_type)
+			{
+			case Type::Texture:
+				bx::memCopy(request.m_data, data, request.m_size);
+				break;
+
+			case Type::ScreenShot:
+				{
+					uint8_t* screenShot = (uint8_t*)BX_ALLOC(g_allocator, request.m_size);
+					bx::memCopy(screenShot, data, request.m_size);
+
+					if (request.m_swizzle)
+					{
+						bimg::imageSwizzleBgra8(screenShot, pitch, request.m_width, request.m_height, screenShot, pitch);
+					}
+
+					g_callback->screenShot(request.m_filePath.getCPtr()
+						, request.m_width
+						, request.m_height
+						, pitch
+						, screenShot
+						, request.m_size
+						, true
+						);
+					BX_FREE(g_allocator, screenShot);
+				}
+				break;
+
+			case Type::Capture:
+				if (request.m_swizzle)
+				{
+					bimg::imageSwizzleBgra8(request.m_data, pitch, request.m_width, request.m_height, data, pitch);
+				}
+				else
+				{
+					bx::memCopy(request.m_data, data, request.m_size);
+				}
+
+				g_callback->captureFrame(request.m_data, request.m_size);
+				break;
+
+			default:
+				break;
+			}
+
+			GL_CHECK(glUnmapBuffer(GL_PIXEL_PACK_BUFFER) );
+		}
+
+		g_glStateCache.bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+		m_numPendingTextures -= Type::Texture == request.m_type;
+
+		m_control.consume(1);
+
+		return true;
+	}
+
 	void RendererContextGL::submitBlit(BlitState& _bs, uint16_t _view)
 	{
 		if (m_blitSupported)
@@ -7430,8 +8679,8 @@ namespace bgfx { namespace gl
 				BX_ASSERT(GL_FRAMEBUFFER_COMPLETE == status, "glCheckFramebufferStatus failed 0x%08x", status);
 				BX_UNUSED(status);
 
-				GL_CHECK(glActiveTexture(GL_TEXTURE0) );
-				GL_CHECK(glBindTexture(GL_TEXTURE_2D, dst.m_id) );
+				g_glStateCache.activeTexture(GL_TEXTURE0);
+				g_glStateCache.bindTexture(GL_TEXTURE_2D, dst.m_id);
 
 				GL_CHECK(glCopyTexSubImage2D(GL_TEXTURE_2D
 					, bi.m_dstMip
@@ -7456,27 +8705,34 @@ namespace bgfx { namespace gl
 			renderDocTriggerCapture();
 		}
 
-		m_glctx.makeCurrent(NULL);
+		makeCurrent(NULL);
+
+		// GL state might be changed outside of renderer between frames (user
+		// code using GL context directly, etc.).
+		g_glStateCache.invalidate();
 
 		BGFX_GL_PROFILER_BEGIN_LITERAL("rendererSubmit", kColorView);
 
 		if (1 < m_numWindows
 		&&  m_vaoSupport)
 		{
+			// Vertex array objects are not shared between contexts.
+			m_vaoStateCache.invalidate();
 			m_vaoSupport = false;
-			GL_CHECK(glBindVertexArray(0) );
-			GL_CHECK(glDeleteVertexArrays(1, &m_vao) );
+			m_vertexAttribBindingSupport = false;
+			g_glStateCache.bindVertexArray(0);
+			g_glStateCache.deleteVertexArrays(1, &m_vao);
 			m_vao = 0;
 		}
 
 		const GLuint defaultVao = m_vao;
 		if (0 != defaultVao)
 		{
-			GL_CHECK(glBindVertexArray(defaultVao) );
+			g_glStateCache.bindVertexArray(defaultVao);
 		}
 
 		GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_backBufferFbo) );
-		GL_CHECK(glFrontFace(GL_CW) );
+		g_glStateCache.frontFace(GL_CW);
 
 		updateResolution(_render->m_resolution);
 
@@ -7640,11 +8896,11 @@ namespace bgfx { namespace gl
 						clearQuad(_clearQuad, viewState.m_rect, clear, resolutionHeight, _render->m_colorPalette);
 					}
 
-					GL_CHECK(glDisable(GL_STENCIL_TEST) );
-					GL_CHECK(glEnable(GL_DEPTH_TEST) );
-					GL_CHECK(glDepthFunc(GL_LESS) );
-					GL_CHECK(glEnable(GL_CULL_FACE) );
-					GL_CHECK(glDisable(GL_BLEND) );
+					g_glStateCache.disable(GL_STENCIL_TEST);
+					g_glStateCache.enable(GL_DEPTH_TEST);
+					g_glStateCache.depthFunc(GL_LESS);
+					g_glStateCache.enable(GL_CULL_FACE);
+					g_glStateCache.disable(GL_BLEND);
 
 					submitBlit(bs, view);
 				}
@@ -7664,6 +8920,9 @@ namespace bgfx { namespace gl
 					{
 						const RenderCompute& compute = renderItem.compute;
 
+						// Skipping dispatch would leave its outputs stale, wait for link instead.
+						updateProgram(key.m_program, true);
+
 						ProgramGL& program = m_program[key.m_program.idx];
 						setProgram(program.m_id);
 
@@ -7700,7 +8959,7 @@ namespace bgfx { namespace gl
 								case Binding::IndexBuffer:
 									{
 										const IndexBufferGL& buffer = m_indexBuffers[bind.m_idx];
-										GL_CHECK(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, ii, buffer.m_id) );
+										g_glStateCache.bindBufferBase(GL_SHADER_STORAGE_BUFFER, ii, buffer.m_id);
 										barrier |= GL_SHADER_STORAGE_BARRIER_BIT;
 									}
 									break;
@@ -7708,7 +8967,7 @@ namespace bgfx { namespace gl
 								case Binding::VertexBuffer:
 									{
 										const VertexBufferGL& buffer = m_vertexBuffers[bind.m_idx];
-										GL_CHECK(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, ii, buffer.m_id) );
+										g_glStateCache.bindBufferBase(GL_SHADER_STORAGE_BUFFER, ii, buffer.m_id);
 										barrier |= GL_SHADER_STORAGE_BARRIER_BIT;
 									}
 									break;
@@ -7736,7 +8995,7 @@ namespace bgfx { namespace gl
 								if (currentState.m_indirectBuffer.idx != compute.m_indirectBuffer.idx)
 								{
 									currentState.m_indirectBuffer = compute.m_indirectBuffer;
-									GL_CHECK(glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, vb.m_id) );
+									g_glStateCache.bindBuffer(GL_DISPATCH_INDIRECT_BUFFER, vb.m_id);
 								}
 
 								uint32_t numDrawIndirect = UINT16_MAX == compute.m_numIndirect
@@ -7756,7 +9015,7 @@ namespace bgfx { namespace gl
 								if (isValid(currentState.m_indirectBuffer) )
 								{
 									currentState.m_indirectBuffer.idx = kInvalidHandle;
-									GL_CHECK(glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, 0) );
+									g_glStateCache.bindBuffer(GL_DISPATCH_INDIRECT_BUFFER, 0);
 								}
 
 								GL_CHECK(glDispatchCompute(compute.m_numX, compute.m_numY, compute.m_numZ) );
@@ -7791,7 +9050,8 @@ namespace bgfx { namespace gl
 						;
 
 					if (occluded
-					||  _render->m_frameCache.isZeroArea(viewScissorRect, draw.m_scissor) )
+					||  _render->m_frameCache.isZeroArea(viewScissorRect, draw.m_scissor)
+					|| (isValid(key.m_program) && !updateProgram(key.m_program, false) ) )
 					{
 						if (resetState)
 						{
@@ -7833,7 +9093,7 @@ namespace bgfx { namespace gl
 					{
 						if (viewHasScissor)
 						{
-							GL_CHECK(glEnable(GL_SCISSOR_TEST) );
+							g_glStateCache.enable(GL_SCISSOR_TEST);
 							GL_CHECK(glScissor(viewScissorRect.m_x
 								, resolutionHeight-viewScissorRect.m_height-viewScissorRect.m_y
 								, viewScissorRect.m_width
@@ -7842,7 +9102,7 @@ namespace bgfx { namespace gl
 						}
 						else
 						{
-							GL_CHECK(glDisable(GL_SCISSOR_TEST) );
+							g_glStateCache.disable(GL_SCISSOR_TEST);
 						}
 					}
 					else
@@ -7850,7 +9110,7 @@ namespace bgfx { namespace gl
 						Rect scissorRect;
 						scissorRect.setIntersect(viewScissorRect, _render->m_frameCache.m_rectCache.m_cache[scissor]);
 
-						GL_CHECK(glEnable(GL_SCISSOR_TEST) );
+						g_glStateCache.enable(GL_SCISSOR_TEST);
 						GL_CHECK(glScissor(scissorRect.m_x
 							, resolutionHeight-scissorRect.m_height-scissorRect.m_y
 							, scissorRect.m_width
@@ -7863,7 +9123,7 @@ namespace bgfx { namespace gl
 				{
 					if (0 != newStencil)
 					{
-						GL_CHECK(glEnable(GL_STENCIL_TEST) );
+						g_glStateCache.enable(GL_STENCIL_TEST);
 
 						uint32_t bstencil = unpackStencil(1, newStencil);
 						uint8_t frontAndBack = bstencil != BGFX_STENCIL_NONE && bstencil != unpackStencil(0, newStencil);
@@ -7900,7 +9160,7 @@ namespace bgfx { namespace gl
 					}
 					else
 					{
-						GL_CHECK(glDisable(GL_STENCIL_TEST) );
+						g_glStateCache.disable(GL_STENCIL_TEST);
 					}
 				}
 
@@ -7926,30 +9186,30 @@ namespace bgfx { namespace gl
 				{
 					if (BGFX_STATE_FRONT_CCW & changedFlags)
 					{
-						GL_CHECK(glFrontFace( (BGFX_STATE_FRONT_CCW & newFlags) ? GL_CCW : GL_CW) );
+						g_glStateCache.frontFace( (BGFX_STATE_FRONT_CCW & newFlags) ? GL_CCW : GL_CW);
 					}
 
 					if (BGFX_STATE_CULL_MASK & changedFlags)
 					{
 						if (BGFX_STATE_CULL_CCW & newFlags)
 						{
-							GL_CHECK(glEnable(GL_CULL_FACE) );
-							GL_CHECK(glCullFace(GL_BACK) );
+							g_glStateCache.enable(GL_CULL_FACE);
+							g_glStateCache.cullFace(GL_BACK);
 						}
 						else if (BGFX_STATE_CULL_CW & newFlags)
 						{
-							GL_CHECK(glEnable(GL_CULL_FACE) );
-							GL_CHECK(glCullFace(GL_FRONT) );
+							g_glStateCache.enable(GL_CULL_FACE);
+							g_glStateCache.cullFace(GL_FRONT);
 						}
 						else
 						{
-							GL_CHECK(glDisable(GL_CULL_FACE) );
+							g_glStateCache.disable(GL_CULL_FACE);
 						}
 					}
 
 					if (BGFX_STATE_WRITE_Z & changedFlags)
 					{
-						GL_CHECK(glDepthMask(!!(BGFX_STATE_WRITE_Z & newFlags) ) );
+						g_glStateCache.depthMask(!!(BGFX_STATE_WRITE_Z & newFlags) );
 					}
 
 					if (BGFX_STATE_DEPTH_TEST_MASK & changedFlags)
@@ -7958,19 +9218,19 @@ namespace bgfx { namespace gl
 
 						if (0 != func)
 						{
-							GL_CHECK(glEnable(GL_DEPTH_TEST) );
-							GL_CHECK(glDepthFunc(s_cmpFunc[func]) );
+							g_glStateCache.enable(GL_DEPTH_TEST);
+							g_glStateCache.depthFunc(s_cmpFunc[func]);
 						}
 						else
 						{
 							if (BGFX_STATE_WRITE_Z & newFlags)
 							{
-								GL_CHECK(glEnable(GL_DEPTH_TEST) );
-								GL_CHECK(glDepthFunc(GL_ALWAYS) );
+								g_glStateCache.enable(GL_DEPTH_TEST);
+								g_glStateCache.depthFunc(GL_ALWAYS);
 							}
 							else
 							{
-								GL_CHECK(glDisable(GL_DEPTH_TEST) );
+								g_glStateCache.disable(GL_DEPTH_TEST);
 							}
 						}
 					}
@@ -7991,27 +9251,39 @@ namespace bgfx { namespace gl
 
 						if (BGFX_STATE_MSAA & changedFlags)
 						{
-							GL_CHECK(BGFX_STATE_MSAA & newFlags
-								? glEnable(GL_MULTISAMPLE)
-								: glDisable(GL_MULTISAMPLE)
-								);
+							if (BGFX_STATE_MSAA & newFlags)
+							{
+								g_glStateCache.enable(GL_MULTISAMPLE);
+							}
+							else
+							{
+								g_glStateCache.disable(GL_MULTISAMPLE);
+							}
 						}
 
 						if (BGFX_STATE_LINEAA & changedFlags)
 						{
-							GL_CHECK(BGFX_STATE_LINEAA & newFlags
-								? glEnable(GL_LINE_SMOOTH)
-								: glDisable(GL_LINE_SMOOTH)
-								);
+							if (BGFX_STATE_LINEAA & newFlags)
+							{
+								g_glStateCache.enable(GL_LINE_SMOOTH);
+							}
+							else
+							{
+								g_glStateCache.disable(GL_LINE_SMOOTH);
+							}
 						}
 
 						if (m_conservativeRasterSupport
 						&&  BGFX_STATE_CONSERVATIVE_RASTER & changedFlags)
 						{
-							GL_CHECK(BGFX_STATE_CONSERVATIVE_RASTER & newFlags
-								? glEnable(GL_CONSERVATIVE_RASTERIZATION_NV)
-								: glDisable(GL_CONSERVATIVE_RASTERIZATION_NV)
-								);
+							if (BGFX_STATE_CONSERVATIVE_RASTER & newFlags)
+							{
+								g_glStateCache.enable(GL_CONSERVATIVE_RASTERIZATION_NV);
+							}
+							else
+							{
+								g_glStateCache.disable(GL_CONSERVATIVE_RASTERIZATION_NV);
+							}
 						}
 					}
 
@@ -8021,7 +9293,7 @@ namespace bgfx { namespace gl
 						const GLboolean gg = !!(newFlags&BGFX_STATE_WRITE_G);
 						const GLboolean bb = !!(newFlags&BGFX_STATE_WRITE_B);
 						const GLboolean aa = !!(newFlags&BGFX_STATE_WRITE_A);
-						GL_CHECK(glColorMask(rr, gg, bb, aa) );
+						g_glStateCache.colorMask(rr, gg, bb, aa);
 					}
 
 					if ( ( (0
@@ -8036,11 +9308,11 @@ namespace bgfx { namespace gl
 						{
 							if (BGFX_STATE_BLEND_ALPHA_TO_COVERAGE & newFlags)
 							{
-								GL_CHECK(glEnable(GL_SAMPLE_ALPHA_TO_COVERAGE) );
+								g_glStateCache.enable(GL_SAMPLE_ALPHA_TO_COVERAGE);
 							}
 							else
 							{
-								GL_CHECK(glDisable(GL_SAMPLE_ALPHA_TO_COVERAGE) );
+								g_glStateCache.disable(GL_SAMPLE_ALPHA_TO_COVERAGE);
 							}
 						}
 
@@ -8074,13 +9346,13 @@ namespace bgfx { namespace gl
 							{
 								if (enabled)
 								{
-									GL_CHECK(glEnable(GL_BLEND) );
-									GL_CHECK(glBlendFuncSeparate(s_blendFactor[srcRGB].m_src
+									g_glStateCache.enable(GL_BLEND);
+									g_glStateCache.blendFuncSeparate(s_blendFactor[srcRGB].m_src
 										, s_blendFactor[dstRGB].m_dst
 										, s_blendFactor[srcA].m_src
 										, s_blendFactor[dstA].m_dst
-										) );
-									GL_CHECK(glBlendEquationSeparate(s_blendEquation[equRGB], s_blendEquation[equA]) );
+										);
+									g_glStateCache.blendEquationSeparate(s_blendEquation[equRGB], s_blendEquation[equA]);
 
 									if ( (s_blendFactor[srcRGB].m_factor || s_blendFactor[dstRGB].m_factor)
 									&&  blendFactor != draw.m_rgba)
@@ -8091,33 +9363,33 @@ namespace bgfx { namespace gl
 										GLclampf bb = ( (rgba>> 8)&0xff)/255.0f;
 										GLclampf aa = ( (rgba    )&0xff)/255.0f;
 
-										GL_CHECK(glBlendColor(rr, gg, bb, aa) );
+										g_glStateCache.blendColor(rr, gg, bb, aa);
 									}
 								}
 								else
 								{
-									GL_CHECK(glDisable(GL_BLEND) );
+									g_glStateCache.disable(GL_BLEND);
 								}
 							}
 							else
 							{
 								if (enabled)
 								{
-									GL_CHECK(glEnablei(GL_BLEND, 0) );
-									GL_CHECK(glBlendFuncSeparatei(0
+									g_glStateCache.enablei(GL_BLEND, 0);
+									g_glStateCache.blendFuncSeparatei(0
 										, s_blendFactor[srcRGB].m_src
 										, s_blendFactor[dstRGB].m_dst
 										, s_blendFactor[srcA].m_src
 										, s_blendFactor[dstA].m_dst
-										) );
-									GL_CHECK(glBlendEquationSeparatei(0
+										);
+									g_glStateCache.blendEquationSeparatei(0
 										, s_blendEquation[equRGB]
 										, s_blendEquation[equA]
-										) );
+										);
 								}
 								else
 								{
-									GL_CHECK(glDisablei(GL_BLEND, 0) );
+									g_glStateCache.disablei(GL_BLEND, 0);
 								}
 
 								for (uint32_t ii = 1, rgba = draw.m_rgba; ii < numRt; ++ii, rgba >>= 11)
@@ -8127,20 +9399,20 @@ namespace bgfx { namespace gl
 										const uint32_t src      = (rgba   )&0xf;
 										const uint32_t dst      = (rgba>>4)&0xf;
 										const uint32_t equation = (rgba>>8)&0x7;
-										GL_CHECK(glEnablei(GL_BLEND, ii) );
-										GL_CHECK(glBlendFunci(ii, s_blendFactor[src].m_src, s_blendFactor[dst].m_dst) );
-										GL_CHECK(glBlendEquationi(ii, s_blendEquation[equation]) );
+										g_glStateCache.enablei(GL_BLEND, ii);
+										g_glStateCache.blendFunci(ii, s_blendFactor[src].m_src, s_blendFactor[dst].m_dst);
+										g_glStateCache.blendEquationi(ii, s_blendEquation[equation]);
 									}
 									else
 									{
-										GL_CHECK(glDisablei(GL_BLEND, ii) );
+										g_glStateCache.disablei(GL_BLEND, ii);
 									}
 								}
 							}
 						}
 						else
 						{
-							GL_CHECK(glDisable(GL_BLEND) );
+							g_glStateCache.disable(GL_BLEND);
 						}
 
 						blendFactor = draw.m_rgba;
@@ -8181,6 +9453,7 @@ namespace bgfx { namespace gl
 					}
 
 					viewState.setPredefined<1>(this, view, program, _render, draw);
+					bindUniformBlocks(program);
 
 					{
 						GLbitfield barrier = 0;
@@ -8222,14 +9495,14 @@ namespace bgfx { namespace gl
 									case Binding::IndexBuffer:
 										{
 											const IndexBufferGL& buffer = m_indexBuffers[bind.m_idx];
-											GL_CHECK(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, stage, buffer.m_id) );
+											g_glStateCache.bindBufferBase(GL_SHADER_STORAGE_BUFFER, stage, buffer.m_id);
 										}
 										break;
 
 									case Binding::VertexBuffer:
 										{
 											const VertexBufferGL& buffer = m_vertexBuffers[bind.m_idx];
-											GL_CHECK(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, stage, buffer.m_id) );
+											g_glStateCache.bindBufferBase(GL_SHADER_STORAGE_BUFFER, stage, buffer.m_id);
 										}
 										break;
 									}
@@ -8286,14 +9559,14 @@ namespace bgfx { namespace gl
 						{
 							currentState.m_indexBuffer = draw.m_indexBuffer;
 
-							if (isValid(draw.m_indexBuffer) )
+							if (m_vaoSupport)
 							{
-								IndexBufferGL& ib = m_indexBuffers[draw.m_indexBuffer.idx];
-								GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ib.m_id) );
+								// Index buffer binding is part of vertex array object state.
+								bindAttribs = true;
 							}
 							else
 							{
-								GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0) );
+								bindIndexBuffer(draw.m_indexBuffer);
 							}
 						}
 
@@ -8304,8 +9577,15 @@ namespace bgfx { namespace gl
 
 						if (0 != currentState.m_streamMask)
 						{
-							if (bindAttribs)
+							if (bindAttribs
+							&&  !bindVertexArray(currentProgram, draw) )
 							{
+								if (m_vaoSupport)
+								{
+									g_glStateCache.bindVertexArray(defaultVao);
+									bindIndexBuffer(draw.m_indexBuffer);
+								}
+
 								if (isValid(boundProgram) )
 								{
 									m_program[boundProgram.idx].unbindAttributes();
@@ -8331,14 +9611,14 @@ namespace bgfx { namespace gl
 										const uint16_t decl = isValid(draw.m_stream[idx].m_layoutHandle)
 											? draw.m_stream[idx].m_layoutHandle.idx
 											: vb.m_layoutHandle.idx;
-										GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vb.m_id) );
+										g_glStateCache.bindBuffer(GL_ARRAY_BUFFER, vb.m_id);
 										program.bindAttributes(m_vertexLayouts[decl], draw.m_stream[idx].m_startVertex);
 									}
 								}
 
 								if (isValid(draw.m_instanceDataBuffer) )
 								{
-									GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffers[draw.m_instanceDataBuffer.idx].m_id) );
+									g_glStateCache.bindBuffer(GL_ARRAY_BUFFER, m_vertexBuffers[draw.m_instanceDataBuffer.idx].m_id);
 									program.bindInstanceData(draw.m_instanceDataStride, draw.m_instanceDataOffset);
 								}
 
@@ -8386,7 +9666,7 @@ namespace bgfx { namespace gl
 							if (currentState.m_indirectBuffer.idx != draw.m_indirectBuffer.idx)
 							{
 								currentState.m_indirectBuffer = draw.m_indirectBuffer;
-								GL_CHECK(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, vb.m_id) );
+								g_glStateCache.bindBuffer(GL_DRAW_INDIRECT_BUFFER, vb.m_id);
 							}
 
 							uint32_t numOffsetIndirect = 0;
@@ -8396,7 +9676,7 @@ namespace bgfx { namespace gl
 								{
 									const IndexBufferGL& nb = m_indexBuffers[draw.m_numIndirectBuffer.idx];
 									currentState.m_numIndirectBuffer = draw.m_numIndirectBuffer;
-									GL_CHECK(glBindBuffer(GL_PARAMETER_BUFFER_ARB, nb.m_id) );
+									g_glStateCache.bindBuffer(GL_PARAMETER_BUFFER_ARB, nb.m_id);
 								}
 
 								numOffsetIndirect = draw.m_numIndirectIndex * sizeof(uint32_t);
@@ -8469,12 +9749,12 @@ namespace bgfx { namespace gl
 							if (isValid(currentState.m_indirectBuffer) )
 							{
 								currentState.m_indirectBuffer.idx = kInvalidHandle;
-								GL_CHECK(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0) );
+								g_glStateCache.bindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
 
 								if (isValid(currentState.m_numIndirectBuffer) )
 								{
 									currentState.m_numIndirectBuffer.idx = kInvalidHandle;
-									GL_CHECK(glBindBuffer(GL_PARAMETER_BUFFER_ARB, 0) );
+									g_glStateCache.bindBuffer(GL_PARAMETER_BUFFER_ARB, 0);
 								}
 							}
 
@@ -8546,6 +9826,12 @@ namespace bgfx { namespace gl
 
 			if (isValid(boundProgram) )
 			{
+				if (0 != defaultVao)
+				{
+					// Attributes of bound program were set on default vertex array object.
+					g_glStateCache.bindVertexArray(defaultVao);
+				}
+
 				m_program[boundProgram.idx].unbindAttributes();
 				boundProgram = BGFX_INVALID_HANDLE;
 			}
@@ -8563,7 +9849,7 @@ namespace bgfx { namespace gl
 
 			if (m_vaoSupport)
 			{
-				GL_CHECK(glBindVertexArray(m_vao) );
+				g_glStateCache.bindVertexArray(m_vao);
 			}
 
 			if (0 < _render->m_numRenderItems)
@@ -8581,9 +9867,18 @@ namespace bgfx { namespace gl
 			}
 		}
 
+		if (m_asyncReadBackSupport)
+		{
+			// ReadTexture is post command, so pending texture read backs were issued
+			// after previous frame's draws. Resolve them now, so they are complete by
+			// the time frame number returned by readTexture is reached. They had this
+			// whole frame to finish, so this normally doesn't stall.
+			m_readBack.update(true);
+		}
+
 		BGFX_GL_PROFILER_END();
 
-		m_glctx.makeCurrent(NULL);
+		makeCurrent(NULL);
 		int64_t timeEnd = bx::getHPCounter();
 		int64_t frameTime = timeEnd - timeBegin;
 
@@ -8626,6 +9921,13 @@ namespace bgfx { namespace gl
 		bx::memCopy(perfStats.numPrims, statsNumPrimsRendered, sizeof(perfStats.numPrims) );
 		perfStats.gpuMemoryMax  = -INT64_MAX;
 		perfStats.gpuMemoryUsed = -INT64_MAX;
+		perfStats.shaderCompileTime    = m_shaderCompileTime;
+		perfStats.numProgramsCompiling = m_numProgramsPending;
+		perfStats.numStateCallsIssued  = g_glStateCache.getNumIssued();
+		perfStats.numStateCallsElided  = g_glStateCache.getNumElided();
+
+		m_shaderCompileTime = 0;
+		g_glStateCache.resetStats();
 
 		if (_render->m_debug & (BGFX_DEBUG_IFH|BGFX_DEBUG_STATS) )
 		{
@@ -8795,6 +10097,14 @@ namespace bgfx { namespace gl
 				pos++;
 				double captureMs = double(captureElapsed)*toMs;
 				tvm.printf(10, pos++, 0x8b, "     Capture: %7.4f [ms] ", captureMs);
+				tvm.printf(10, pos++, 0x8b, "     Shaders: %7.4f [ms] (compiling %d) "
+					, double(perfStats.shaderCompileTime)*toMs
+					, perfStats.numProgramsCompiling
+					);
+				tvm.printf(10, pos++, 0x8b, "    GL calls: %7d (elided %d) "
+					, perfStats.numStateCallsIssued
+					, perfStats.numStateCallsElided
+					);
 
 				uint8_t attr[2] = { 0x8c, 0x8a };
 				uint8_t attrIndex = _render->m_waitSubmit < _render->m_waitRender;
@@ -43,10 +43,23 @@
 #	define BGFX_GL_CONFIG_BLIT_EMULATION 0
 #endif // BGFX_GL_CONFIG_BLIT_EMULATION
 
+// Uniforms packed into std140 uniform block use location with block bit set,
+// fragment bit selecting block, and byte offset of uniform inside block.
+#define BGFX_GL_UNIFORM_BLOCK_LOC             UINT32_C(0x80000000)
+#define BGFX_GL_UNIFORM_BLOCK_LOC_FRAGMENT    UINT32_C(0x40000000)
+#define BGFX_GL_UNIFORM_BLOCK_LOC_OFFSET_MASK UINT32_C(0x0000ffff)
+#define BGFX_GL_UNIFORM_BLOCK_MAX_SIZE        (16<<10)
+
 #ifndef BGFX_GL_CONFIG_TEXTURE_READ_BACK_EMULATION
 #	define BGFX_GL_CONFIG_TEXTURE_READ_BACK_EMULATION 0
 #endif // BGFX_GL_CONFIG_TEXTURE_READ_BACK_EMULATION
 
+// Number of in-flight asynchronous readbacks (texture read back, screenshot,
+// capture) going through pixel pack buffers.
+#ifndef BGFX_GL_CONFIG_MAX_READ_BACK
+#	define BGFX_GL_CONFIG_MAX_READ_BACK 8
+#endif // BGFX_GL_CONFIG_MAX_READ_BACK
+
 #define BGFX_GL_PROFILER_BEGIN(_view, _abgr)                                               \
 	BX_MACRO_BLOCK_BEGIN                                                                   \
 		GL_CHECK(glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, s_viewName[view]) ); \
@@ -877,6 +890,10 @@ typedef uint64_t GLuint64;
 #	define GL_SAMPLER_2D_ARRAY_SHADOW 0x8DC4
 #endif // GL_SAMPLER_2D_ARRAY_SHADOW
 
+#ifndef GL_TEXTURE_BASE_LEVEL
+#	define GL_TEXTURE_BASE_LEVEL 0x813C
+#endif // GL_TEXTURE_BASE_LEVEL
+
 #ifndef GL_TEXTURE_MAX_LEVEL
 #	define GL_TEXTURE_MAX_LEVEL 0x813D
 #endif // GL_TEXTURE_MAX_LEVEL
@@ -985,6 +1002,62 @@ typedef uint64_t GLuint64;
 #	define GL_BUFFER_VARIABLE 0x92E5
 #endif // GL_BUFFER_VARIABLE
 
+#ifndef GL_UNIFORM_BUFFER
+#	define GL_UNIFORM_BUFFER 0x8A11
+#endif // GL_UNIFORM_BUFFER
+
+#ifndef GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+#	define GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT 0x8A34
+#endif // GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+
+#ifndef GL_MAX_UNIFORM_BLOCK_SIZE
+#	define GL_MAX_UNIFORM_BLOCK_SIZE 0x8A30
+#endif // GL_MAX_UNIFORM_BLOCK_SIZE
+
+#ifndef GL_UNIFORM_BLOCK_DATA_SIZE
+#	define GL_UNIFORM_BLOCK_DATA_SIZE 0x8A40
+#endif // GL_UNIFORM_BLOCK_DATA_SIZE
+
+#ifndef GL_UNIFORM_BLOCK_INDEX
+#	define GL_UNIFORM_BLOCK_INDEX 0x8A3A
+#endif // GL_UNIFORM_BLOCK_INDEX
+
+#ifndef GL_UNIFORM_OFFSET
+#	define GL_UNIFORM_OFFSET 0x8A3B
+#endif // GL_UNIFORM_OFFSET
+
+#ifndef GL_INVALID_INDEX
+#	define GL_INVALID_INDEX 0xFFFFFFFFu
+#endif // GL_INVALID_INDEX
+
+#ifndef GL_COMPLETION_STATUS_KHR
+#	define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif // GL_COMPLETION_STATUS_KHR
+
+#ifndef GL_PIXEL_PACK_BUFFER
+#	define GL_PIXEL_PACK_BUFFER 0x88EB
+#endif // GL_PIXEL_PACK_BUFFER
+
+#ifndef GL_STREAM_READ
+#	define GL_STREAM_READ 0x88E1
+#endif // GL_STREAM_READ
+
+#ifndef GL_MAP_READ_BIT
+#	define GL_MAP_READ_BIT 0x0001
+#endif // GL_MAP_READ_BIT
+
+#ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+#	define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#endif // GL_SYNC_GPU_COMMANDS_COMPLETE
+
+#ifndef GL_SYNC_FLUSH_COMMANDS_BIT
+#	define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#endif // GL_SYNC_FLUSH_COMMANDS_BIT
+
+#ifndef GL_TIMEOUT_EXPIRED
+#	define GL_TIMEOUT_EXPIRED 0x911B
+#endif // GL_TIMEOUT_EXPIRED
+
 #ifndef GL_UNSIGNED_INT_VEC2
 #	define GL_UNSIGNED_INT_VEC2 0x8DC6
 #endif // GL_UNSIGNED_INT_VEC2
@@ -1229,6 +1302,468 @@ namespace bgfx { namespace gl
 #define GL_IMPORT(_optional, _proto, _func, _import) extern _proto _func
 #include "glimports.h"
 
+	// Shadows GL state set by renderer, and elides state-setting calls that
+	// wouldn't change anything. Shadowed state belongs to current GL context,
+	// it must be invalidated when context changes, or when GL state might have
+	// been changed without going through cache.
+	class GlStateCache
+	{
+	public:
+		GlStateCache()
+		{
+			invalidate();
+			resetStats();
+		}
+
+		void invalidate()
+		{
+			bx::memSet(m_cap,     0xff, sizeof(m_cap) );
+			bx::memSet(m_buffer,  0xff, sizeof(m_buffer) );
+			bx::memSet(m_texture, 0xff, sizeof(m_texture) );
+			bx::memSet(m_sampler, 0xff, sizeof(m_sampler) );
+
+			m_activeTexture      = UINT32_MAX;
+			m_program            = UINT32_MAX;
+			m_vao                = UINT32_MAX;
+			m_blendFunc          = UINT64_MAX;
+			m_blendEquation      = UINT32_MAX;
+			m_blendColorValid    = false;
+			m_depthFunc          = UINT32_MAX;
+			m_cullFace           = UINT32_MAX;
+			m_frontFace          = UINT32_MAX;
+			m_depthMask          = UINT8_MAX;
+			m_colorMask          = UINT8_MAX;
+		}
+
+		void resetStats()
+		{
+			m_numIssued = 0;
+			m_numElided = 0;
+		}
+
+		uint32_t getNumIssued() const
+		{
+			return m_numIssued;
+		}
+
+		uint32_t getNumElided() const
+		{
+			return m_numElided;
+		}
+
+		void enable(GLenum _cap)
+		{
+			const uint32_t idx = capIndex(_cap);
+			if (UINT32_MAX == idx ? issue() : changed(m_cap[idx], uint8_t(1) ) )
+			{
+				GL_CHECK(glEnable(_cap) );
+			}
+		}
+
+		void disable(GLenum _cap)
+		{
+			const uint32_t idx = capIndex(_cap);
+			if (UINT32_MAX == idx ? issue() : changed(m_cap[idx], uint8_t(0) ) )
+			{
+				GL_CHECK(glDisable(_cap) );
+			}
+		}
+
+		// Indexed variants are not shadowed, they only invalidate shadowed
+		// non-indexed state they overlap with.
+		void enablei(GLenum _cap, GLuint _index)
+		{
+			invalidateCap(_cap);
+			issue();
+			GL_CHECK(glEnablei(_cap, _index) );
+		}
+
+		void disablei(GLenum _cap, GLuint _index)
+		{
+			invalidateCap(_cap);
+			issue();
+			GL_CHECK(glDisablei(_cap, _index) );
+		}
+
+		void bindBuffer(GLenum _target, GLuint _id)
+		{
+			const uint32_t idx = bufferIndex(_target);
+			if (UINT32_MAX == idx ? issue() : changed(m_buffer[idx], _id) )
+			{
+				GL_CHECK(glBindBuffer(_target, _id) );
+			}
+		}
+
+		// Binding to indexed binding point also binds buffer to generic
+		// binding point of target.
+		void bindBufferBase(GLenum _target, GLuint _index, GLuint _id)
+		{
+			setBuffer(_target, _id);
+			issue();
+			GL_CHECK(glBindBufferBase(_target, _index, _id) );
+		}
+
+		void bindBufferRange(GLenum _target, GLuint _index, GLuint _id, GLintptr _offset, GLsizeiptr _size)
+		{
+			setBuffer(_target, _id);
+			issue();
+			GL_CHECK(glBindBufferRange(_target, _index, _id, _offset, _size) );
+		}
+
+		void deleteBuffers(GLsizei _num, const GLuint* _ids)
+		{
+			for (GLsizei ii = 0; ii < _num; ++ii)
+			{
+				for (uint32_t jj = 0; jj < BX_COUNTOF(m_buffer); ++jj)
+				{
+					m_buffer[jj] = m_buffer[jj] == _ids[ii] ? 0 : m_buffer[jj];
+				}
+			}
+
+			GL_CHECK(glDeleteBuffers(_num, _ids) );
+		}
+
+		void activeTexture(GLenum _texture)
+		{
+			if (changed(m_activeTexture, _texture) )
+			{
+				GL_CHECK(glActiveTexture(_texture) );
+			}
+		}
+
+		void bindTexture(GLenum _target, GLuint _id)
+		{
+			const uint32_t unit = m_activeTexture - GL_TEXTURE0;
+			const uint32_t idx  = textureIndex(_target);
+			if ( (kMaxTextureUnits <= unit || UINT32_MAX == idx) ? issue() : changed(m_texture[unit][idx], _id) )
+			{
+				GL_CHECK(glBindTexture(_target, _id) );
+			}
+		}
+
+		void deleteTextures(GLsizei _num, const GLuint* _ids)
+		{
+			for (GLsizei ii = 0; ii < _num; ++ii)
+			{
+				for (uint32_t unit = 0; unit < kMaxTextureUnits; ++unit)
+				{
+					for (uint32_t jj = 0; jj < kNumTextureTargets; ++jj)
+					{
+						GLuint& id = m_texture[unit][jj];
+						id = id == _ids[ii] ? 0 : id;
+					}
+				}
+			}
+
+			GL_CHECK(glDeleteTextures(_num, _ids) );
+		}
+
+		void bindSampler(GLuint _unit, GLuint _sampler)
+		{
+			if (kMaxTextureUnits <= _unit ? issue() : changed(m_sampler[_unit], _sampler) )
+			{
+				GL_CHECK(glBindSampler(_unit, _sampler) );
+			}
+		}
+
+		void deleteSamplers(GLsizei _num, const GLuint* _samplers)
+		{
+			for (GLsizei ii = 0; ii < _num; ++ii)
+			{
+				for (uint32_t unit = 0; unit < kMaxTextureUnits; ++unit)
+				{
+					m_sampler[unit] = m_sampler[unit] == _samplers[ii] ? 0 : m_sampler[unit];
+				}
+			}
+
+			GL_CHECK(glDeleteSamplers(_num, _samplers) );
+		}
+
+		void useProgram(GLuint _program)
+		{
+			if (changed(m_program, _program) )
+			{
+				GL_CHECK(glUseProgram(_program) );
+			}
+		}
+
+		void deleteProgram(GLuint _program)
+		{
+			// Program in use is deleted only once it's not current anymore.
+			m_program = m_program == _program ? UINT32_MAX : m_program;
+			GL_CHECK(glDeleteProgram(_program) );
+		}
+
+		void bindVertexArray(GLuint _vao)
+		{
+			if (changed(m_vao, _vao) )
+			{
+				// Element array buffer binding is part of vertex array object state.
+				m_buffer[bufferIndex(GL_ELEMENT_ARRAY_BUFFER)] = UINT32_MAX;
+				GL_CHECK(glBindVertexArray(_vao) );
+			}
+		}
+
+		void deleteVertexArrays(GLsizei _num, const GLuint* _vaos)
+		{
+			for (GLsizei ii = 0; ii < _num; ++ii)
+			{
+				if (m_vao == _vaos[ii])
+				{
+					m_vao = 0;
+					m_buffer[bufferIndex(GL_ELEMENT_ARRAY_BUFFER)] = UINT32_MAX;
+				}
+			}
+
+			GL_CHECK(glDeleteVertexArrays(_num, _vaos) );
+		}
+
+		void blendFuncSeparate(GLenum _srcRgb, GLenum _dstRgb, GLenum _srcAlpha, GLenum _dstAlpha)
+		{
+			const uint64_t blendFunc = 0
+				| (uint64_t(_srcRgb  &UINT16_MAX)     )
+				| (uint64_t(_dstRgb  &UINT16_MAX)<<16)
+				| (uint64_t(_srcAlpha&UINT16_MAX)<<32)
+				| (uint64_t(_dstAlpha&UINT16_MAX)<<48)
+				;
+
+			if (changed(m_blendFunc, blendFunc) )
+			{
+				GL_CHECK(glBlendFuncSeparate(_srcRgb, _dstRgb, _srcAlpha, _dstAlpha) );
+			}
+		}
+
+		void blendEquationSeparate(GLenum _rgb, GLenum _alpha)
+		{
+			const uint32_t blendEquation = (_rgb&UINT16_MAX) | ( (_alpha&UINT16_MAX)<<16);
+
+			if (changed(m_blendEquation, blendEquation) )
+			{
+				GL_CHECK(glBlendEquationSeparate(_rgb, _alpha) );
+			}
+		}
+
+		void blendFunci(GLuint _buf, GLenum _src, GLenum _dst)
+		{
+			m_blendFunc = UINT64_MAX;
+			issue();
+			GL_CHECK(glBlendFunci(_buf, _src, _dst) );
+		}
+
+		void blendFuncSeparatei(GLuint _buf, GLenum _srcRgb, GLenum _dstRgb, GLenum _srcAlpha, GLenum _dstAlpha)
+		{
+			m_blendFunc = UINT64_MAX;
+			issue();
+			GL_CHECK(glBlendFuncSeparatei(_buf, _srcRgb, _dstRgb, _srcAlpha, _dstAlpha) );
+		}
+
+		void blendEquationi(GLuint _buf, GLenum _mode)
+		{
+			m_blendEquation = UINT32_MAX;
+			issue();
+			GL_CHECK(glBlendEquationi(_buf, _mode) );
+		}
+
+		void blendEquationSeparatei(GLuint _buf, GLenum _rgb, GLenum _alpha)
+		{
+			m_blendEquation = UINT32_MAX;
+			issue();
+			GL_CHECK(glBlendEquationSeparatei(_buf, _rgb, _alpha) );
+		}
+
+		void blendColor(GLfloat _red, GLfloat _green, GLfloat _blue, GLfloat _alpha)
+		{
+			if (m_blendColorValid
+			&&  m_blendColor[0] == _red
+			&&  m_blendColor[1] == _green
+			&&  m_blendColor[2] == _blue
+			&&  m_blendColor[3] == _alpha)
+			{
+				++m_numElided;
+				return;
+			}
+
+			m_blendColorValid = true;
+			m_blendColor[0] = _red;
+			m_blendColor[1] = _green;
+			m_blendColor[2] = _blue;
+			m_blendColor[3] = _alpha;
+
+			issue();
+			GL_CHECK(glBlendColor(_red, _green, _blue, _alpha) );
+		}
+
+		void depthFunc(GLenum _func)
+		{
+			if (changed(m_depthFunc, _func) )
+			{
+				GL_CHECK(glDepthFunc(_func) );
+			}
+		}
+
+		void depthMask(GLboolean _flag)
+		{
+			if (changed(m_depthMask, uint8_t(!!_flag) ) )
+			{
+				GL_CHECK(glDepthMask(_flag) );
+			}
+		}
+
+		void colorMask(GLboolean _red, GLboolean _green, GLboolean _blue, GLboolean _alpha)
+		{
+			const uint8_t colorMask = 0
+				| (!!_red   ? 1 : 0)
+				| (!!_green ? 2 : 0)
+				| (!!_blue  ? 4 : 0)
+				| (!!_alpha ? 8 : 0)
+				;
+
+			if (changed(m_colorMask, colorMask) )
+			{
+				GL_CHECK(glColorMask(_red, _green, _blue, _alpha) );
+			}
+		}
+
+		void cullFace(GLenum _mode)
+		{
+			if (changed(m_cullFace, _mode) )
+			{
+				GL_CHECK(glCullFace(_mode) );
+			}
+		}
+
+		void frontFace(GLenum _mode)
+		{
+			if (changed(m_frontFace, _mode) )
+			{
+				GL_CHECK(glFrontFace(_mode) );
+			}
+		}
+
+	private:
+		static constexpr uint32_t kMaxTextureUnits   = BGFX_CONFIG_MAX_TEXTURE_SAMPLERS;
+		static constexpr uint32_t kNumCaps           = 12;
+		static constexpr uint32_t kNumBufferTargets  = 8;
+		static constexpr uint32_t kNumTextureTargets = 7;
+
+		static uint32_t capIndex(GLenum _cap)
+		{
+			switch (_cap)
+			{
+			case GL_BLEND:                          return  0;
+			case GL_CULL_FACE:                      return  1;
+			case GL_DEPTH_TEST:                     return  2;
+			case GL_SCISSOR_TEST:                   return  3;
+			case GL_STENCIL_TEST:                   return  4;
+			case GL_DEPTH_CLAMP:                    return  5;
+			case GL_FRAMEBUFFER_SRGB:               return  6;
+			case GL_MULTISAMPLE:                    return  7;
+			case GL_LINE_SMOOTH:                    return  8;
+			case GL_CONSERVATIVE_RASTERIZATION_NV:  return  9;
+			case GL_SAMPLE_ALPHA_TO_COVERAGE:       return 10;
+			case GL_TEXTURE_CUBE_MAP_SEAMLESS:      return 11;
+			default:                                break;
+			}
+
+			return UINT32_MAX;
+		}
+
+		static uint32_t bufferIndex(GLenum _target)
+		{
+			switch (_target)
+			{
+			case GL_ARRAY_BUFFER:              return 0;
+			case GL_ELEMENT_ARRAY_BUFFER:      return 1;
+			case GL_UNIFORM_BUFFER:            return 2;
+			case GL_SHADER_STORAGE_BUFFER:     return 3;
+			case GL_DRAW_INDIRECT_BUFFER:      return 4;
+			case GL_DISPATCH_INDIRECT_BUFFER:  return 5;
+			case GL_PARAMETER_BUFFER_ARB:      return 6;
+			case GL_PIXEL_PACK_BUFFER:         return 7;
+			default:                           break;
+			}
+
+			return UINT32_MAX;
+		}
+
+		static uint32_t textureIndex(GLenum _target)
+		{
+			switch (_target)
+			{
+			case GL_TEXTURE_2D:                   return 0;
+			case GL_TEXTURE_2D_ARRAY:             return 1;
+			case GL_TEXTURE_3D:                   return 2;
+			case GL_TEXTURE_CUBE_MAP:             return 3;
+			case GL_TEXTURE_CUBE_MAP_ARRAY:       return 4;
+			case GL_TEXTURE_2D_MULTISAMPLE:       return 5;
+			case GL_TEXTURE_2D_MULTISAMPLE_ARRAY: return 6;
+			default:                              break;
+			}
+
+			return UINT32_MAX;
+		}
+
+		void invalidateCap(GLenum _cap)
+		{
+			const uint32_t idx = capIndex(_cap);
+			if (UINT32_MAX != idx)
+			{
+				m_cap[idx] = UINT8_MAX;
+			}
+		}
+
+		void setBuffer(GLenum _target, GLuint _id)
+		{
+			const uint32_t idx = bufferIndex(_target);
+			if (UINT32_MAX != idx)
+			{
+				m_buffer[idx] = _id;
+			}
+		}
+
+		bool issue()
+		{
+			++m_numIssued;
+			return true;
+		}
+
+		template<typename Ty>
+		bool changed(Ty& _shadow, Ty _value)
+		{
+			if (_shadow == _value)
+			{
+				++m_numElided;
+				return false;
+			}
+
+			_shadow = _value;
+			++m_numIssued;
+			return true;
+		}
+
+		uint8_t  m_cap[kNumCaps];
+		GLuint   m_buffer[kNumBufferTargets];
+		GLuint   m_texture[kMaxTextureUnits][kNumTextureTargets];
+		GLuint   m_sampler[kMaxTextureUnits];
+		GLenum   m_activeTexture;
+		GLuint   m_program;
+		GLuint   m_vao;
+		uint64_t m_blendFunc;
+		uint32_t m_blendEquation;
+		GLfloat  m_blendColor[4];
+		bool     m_blendColorValid;
+		GLenum   m_depthFunc;
+		GLenum   m_cullFace;
+		GLenum   m_frontFace;
+		uint8_t  m_depthMask;
+		uint8_t  m_colorMask;
+
+		uint32_t m_numIssued;
+		uint32_t m_numElided;
+	};
+
+	extern GlStateCache g_glStateCache;
+
 	class UniformStateCache
 	{
 	public:
@@ -1342,7 +1877,7 @@ namespace bgfx { namespace gl
 			HashMap::iterator it = m_hashMap.find(_hash);
 			if (it != m_hashMap.end() )
 			{
-				GL_CHECK(glDeleteSamplers(1, &it->second) );
+				g_glStateCache.deleteSamplers(1, &it->second);
 				m_hashMap.erase(it);
 			}
 		}
@@ -1351,7 +1886,7 @@ namespace bgfx { namespace gl
 		{
 			for (HashMap::iterator it = m_hashMap.begin(), itEnd = m_hashMap.end(); it != itEnd; ++it)
 			{
-				GL_CHECK(glDeleteSamplers(1, &it->second) );
+				g_glStateCache.deleteSamplers(1, &it->second);
 			}
 			m_hashMap.clear();
 		}
@@ -1366,6 +1901,121 @@ namespace bgfx { namespace gl
 		HashMap m_hashMap;
 	};
 
+	// Full description of vertex array object state. Stored with each cached
+	// vertex array object and compared on lookup, so that hash collision
+	// can't return vertex array object with different bindings.
+	struct VaoKey
+	{
+		VaoKey()
+		{
+			bx::memSet(this, 0, sizeof(VaoKey) );
+		}
+
+		bool operator==(const VaoKey& _rhs) const
+		{
+			return 0 == bx::memCmp(this, &_rhs, sizeof(VaoKey) );
+		}
+
+		uint32_t m_layoutHash[BGFX_CONFIG_MAX_VERTEX_STREAMS];
+		uint32_t m_startVertex[BGFX_CONFIG_MAX_VERTEX_STREAMS];
+		uint32_t m_instanceDataOffset;
+		uint16_t m_vertexBuffer[BGFX_CONFIG_MAX_VERTEX_STREAMS];
+		uint16_t m_program;
+		uint16_t m_instanceDataBuffer;
+		uint16_t m_instanceDataStride;
+		uint16_t m_indexBuffer;
+		uint16_t m_streamMask;
+		uint16_t m_instance;
+	};
+
+	class VaoStateCache
+	{
+	public:
+		GLuint add(uint32_t _hash, const VaoKey& _key)
+		{
+			invalidate(_hash);
+
+			Vao vao;
+			vao.m_key = _key;
+			GL_CHECK(glGenVertexArrays(1, &vao.m_id) );
+
+			m_hashMap.insert(stl::make_pair(_hash, vao) );
+
+			return vao.m_id;
+		}
+
+		GLuint find(uint32_t _hash, const VaoKey& _key)
+		{
+			HashMap::iterator it = m_hashMap.find(_hash);
+			if (it != m_hashMap.end()
+			&&  it->second.m_key == _key)
+			{
+				return it->second.m_id;
+			}
+
+			return UINT32_MAX;
+		}
+
+		void invalidate(uint32_t _hash)
+		{
+			HashMap::iterator it = m_hashMap.find(_hash);
+			if (it != m_hashMap.end() )
+			{
+				g_glStateCache.deleteVertexArrays(1, &it->second.m_id);
+				m_hashMap.erase(it);
+			}
+		}
+
+		void invalidate()
+		{
+			for (HashMap::iterator it = m_hashMap.begin(), itEnd = m_hashMap.end(); it != itEnd; ++it)
+			{
+				g_glStateCache.deleteVertexArrays(1, &it->second.m_id);
+			}
+			m_hashMap.clear();
+		}
+
+		uint32_t getCount() const
+		{
+			return uint32_t(m_hashMap.size() );
+		}
+
+	private:
+		struct Vao
+		{
+			VaoKey m_key;
+			GLuint m_id;
+		};
+
+		typedef stl::unordered_map<uint32_t, Vao> HashMap;
+		HashMap m_hashMap;
+	};
+
+	// Tracks vertex array objects referencing resource, so they can be
+	// invalidated when resource is destroyed.
+	class VaoCacheRef
+	{
+	public:
+		void add(uint32_t _hash)
+		{
+			m_vaoSet.insert(_hash);
+		}
+
+		void invalidate(VaoStateCache& _vaoCache)
+		{
+			for (VaoSet::iterator it = m_vaoSet.begin(), itEnd = m_vaoSet.end(); it != itEnd; ++it)
+			{
+				_vaoCache.invalidate(*it);
+			}
+
+			m_vaoSet.clear();
+		}
+
+	private:
+		typedef stl::unordered_set<uint32_t> VaoSet;
+		VaoSet m_vaoSet;
+	};
+
 	struct IndexBufferGL
 	{
 		void create(uint32_t _size, void* _data, uint16_t _flags)
@@ -1375,13 +2025,13 @@ namespace bgfx { namespace gl
 
 			GL_CHECK(glGenBuffers(1, &m_id) );
 			BX_ASSERT(0 != m_id, "Failed to generate buffer id.");
-			GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id) );
+			g_glStateCache.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id);
 			GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER
 				, _size
 				, _data
 				, (NULL==_data) ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW
 				) );
-			GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0) );
+			g_glStateCache.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 		}
 
 		void update(uint32_t _offset, uint32_t _size, void* _data, bool _discard = false)
@@ -1395,13 +2045,13 @@ namespace bgfx { namespace gl
 				create(m_size, NULL, m_flags);
 			}
 
-			GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id) );
+			g_glStateCache.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id);
 			GL_CHECK(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER
 				, _offset
 				, _size
 				, _data
 				) );
-			GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0) );
+			g_glStateCache.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 		}
 
 		void destroy();
@@ -1409,6 +2059,7 @@ namespace bgfx { namespace gl
 		GLuint m_id;
 		uint32_t m_size;
 		uint16_t m_flags;
+		VaoCacheRef m_vcref;
 	};
 
 	struct VertexBufferGL
@@ -1423,13 +2074,13 @@ namespace bgfx { namespace gl
 
 			GL_CHECK(glGenBuffers(1, &m_id) );
 			BX_ASSERT(0 != m_id, "Failed to generate buffer id.");
-			GL_CHECK(glBindBuffer(m_target, m_id) );
+			g_glStateCache.bindBuffer(m_target, m_id);
 			GL_CHECK(glBufferData(m_target
 				, _size
 				, _data
 				, (NULL==_data) ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW
 				) );
-			GL_CHECK(glBindBuffer(m_target, 0) );
+			g_glStateCache.bindBuffer(m_target, 0);
 		}
 
 		void update(uint32_t _offset, uint32_t _size, void* _data, bool _discard = false)
@@ -1443,13 +2094,13 @@ namespace bgfx { namespace gl
 				create(m_size, NULL, m_layoutHandle, 0);
 			}
 
-			GL_CHECK(glBindBuffer(m_target, m_id) );
+			g_glStateCache.bindBuffer(m_target, m_id);
 			GL_CHECK(glBufferSubData(m_target
 				, _offset
 				, _size
 				, _data
 				) );
-			GL_CHECK(glBindBuffer(m_target, 0) );
+			g_glStateCache.bindBuffer(m_target, 0);
 		}
 
 		void destroy();
@@ -1458,6 +2109,30 @@ namespace bgfx { namespace gl
 		GLenum m_target;
 		uint32_t m_size;
 		VertexLayoutHandle m_layoutHandle;
+		VaoCacheRef m_vcref;
+	};
+
+	struct BufferRingGL
+	{
+		BufferRingGL()
+			: m_id(0)
+			, m_target(GL_UNIFORM_BUFFER)
+			, m_size(0)
+			, m_pos(0)
+			, m_align(16)
+		{
+		}
+
+		void create(GLenum _target, uint32_t _size, uint32_t _align);
+		void destroy();
+		uint32_t write(const void* _data, uint32_t _size);
+		void bind(GLuint _binding, const void* _data, uint32_t _size);
+
+		GLuint   m_id;
+		GLenum   m_target;
+		uint32_t m_size;
+		uint32_t m_pos;
+		uint32_t m_align;
 	};
 
 	struct TextureGL
@@ -1471,6 +2146,7 @@ namespace bgfx { namespace gl
 			, m_flags(0)
 			, m_currentSamplerHash(UINT32_MAX)
 			, m_numMips(0)
+			, m_immutable(false)
 		{
 		}
 
@@ -1482,6 +2158,7 @@ namespace bgfx { namespace gl
 		void setSamplerState(uint32_t _flags, const float _rgba[4]);
 		void commit(uint32_t _stage, uint32_t _flags, const float _palette[][4]);
 		void resolve(uint8_t _resolve) const;
+		void setResidentMips(uint8_t _minMip);
 
 		bool isCubeMap() const
 		{
@@ -1505,6 +2182,7 @@ namespace bgfx { namespace gl
 		uint8_t m_numMips;
 		uint8_t m_requestedFormat;
 		uint8_t m_textureFormat;
+		bool m_immutable;
 	};
 
 	struct ShaderGL
@@ -1557,16 +2235,28 @@ namespace bgfx { namespace gl
 	{
 		ProgramGL()
 			: m_id(0)
+			, m_vsh(0)
+			, m_fsh(0)
+			, m_cacheId(0)
+			, m_cached(false)
+			, m_linkPending(false)
 			, m_constantBuffer(NULL)
 			, m_numPredefined(0)
 		{
 			m_instanceData[0] = -1;
+			m_uniformBlockSize[0] = 0;
+			m_uniformBlockSize[1] = 0;
 		}
 
 		void create(const ShaderGL& _vsh, const ShaderGL& _fsh);
 		void destroy();
 		void init();
 
+		// Returns true once program finished linking and is ready to use.
+		// When _wait is set, blocks until driver is done with pending link.
+		bool update(bool _wait);
+		void link();
+
 		void bindAttributesBegin();
 		void bindAttributes(const VertexLayout& _layout, uint32_t _baseVertex = 0);
 		void bindInstanceData(uint32_t _stride, uint32_t _baseVertex = 0) const;
@@ -1574,7 +2264,15 @@ namespace bgfx { namespace gl
 		void unbindInstanceData() const;
 		void unbindAttributes();
 
+		void bindAttributeFormats(const VertexLayout& _layout, GLuint _binding) const;
+		void bindInstanceDataFormats(GLuint _binding) const;
+
 		GLuint m_id;
+		GLuint m_vsh;
+		GLuint m_fsh;
+		uint64_t m_cacheId;
+		bool m_cached;
+		bool m_linkPending; // Link issued, completion is polled with GL_COMPLETION_STATUS_KHR.
 
 		uint8_t m_unboundUsedAttrib[Attrib::Count]; // For tracking unbound used attributes between begin()/end().
 		uint8_t m_usedCount;
@@ -1588,8 +2286,12 @@ namespace bgfx { namespace gl
 		uint8_t m_numSamplers;
 
 		UniformBuffer* m_constantBuffer;
-		PredefinedUniform m_predefined[PredefinedUniform::Count];
+		PredefinedUniform m_predefined[PredefinedUniform::Count*2];
 		uint8_t m_numPredefined;
+
+		uint32_t m_uniformBlockSize[2]; // Vertex, fragment std140 block size, 0 if not used.
+
+		VaoCacheRef m_vcref;
 	};
 
 	struct TimerQueryGL
@@ -1763,6 +2465,59 @@ namespace bgfx { namespace gl
 		bx::RingBufferControl m_control;
 	};
 
+	struct ReadBackGL
+	{
+		ReadBackGL()
+			: m_control(BX_COUNTOF(m_request) )
+			, m_numPendingTextures(0)
+		{
+		}
+
+		struct Type
+		{
+			enum Enum
+			{
+				Texture,
+				ScreenShot,
+				Capture,
+
+				Count
+			};
+		};
+
+		void create();
+		void destroy();
+
+		// Binds pixel pack buffer of at least _size bytes, readback call that
+		// follows writes to offset 0 instead of client memory.
+		void begin(uint32_t _size);
+		void end(Type::Enum _type, void* _data, uint32_t _width, uint32_t _height, bool _swizzle, const char* _filePath = NULL);
+
+		// Delivers completed readbacks. When _wait is set, blocks until all
+		// pending texture readbacks are delivered.
+		void update(bool _wait);
+		void flush();
+		bool resolve(bool _wait);
+
+		struct Request
+		{
+			bx::FilePath m_filePath;
+			void*    m_data;
+			GLsync   m_sync;
+			GLuint   m_pbo;
+			uint32_t m_pboSize;
+			uint32_t m_size;
+			uint32_t m_width;
+			uint32_t m_height;
+			uint8_t  m_type;
+			bool     m_swizzle;
+		};
+
+		Request m_request[BGFX_GL_CONFIG_MAX_READ_BACK];
+		bx::RingBufferControl m_control;
+		uint32_t m_numPendingTextures;
+	};
+
 } /* namespace gl */ } // namespace bgfx
 
 #endif // BGFX_RENDERER_GL_H_HEADER_GUARD
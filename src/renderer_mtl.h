@@ -960,6 +960,7 @@ namespace bgfx { namespace mtl
 			, m_height(0)
 			, m_depth(0)
 			, m_numMips(0)
+			, m_residentMip(0)
 		{
 			for(uint32_t ii = 0; ii < BX_COUNTOF(m_ptrMips); ++ii)
 			{
@@ -1022,6 +1023,7 @@ namespace bgfx { namespace mtl
 		uint8_t m_requestedFormat;
 		uint8_t m_textureFormat;
 		uint8_t m_numMips;
+		uint8_t m_residentMip;
 	};
 
 	struct FrameBufferMtl;
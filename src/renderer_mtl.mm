@@ -952,7 +952,7 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 			m_shaders[_handle.idx].destroy();
 		}
 
-		void createProgram(ProgramHandle _handle, ShaderHandle _vsh, ShaderHandle _fsh) override
+		void createProgram(ProgramHandle _handle, ShaderHandle _vsh, ShaderHandle _fsh, uint8_t /*_numConstants*/, const SpecializationConstant* /*_constants*/) override
 		{
 			m_program[_handle.idx].create(&m_shaders[_vsh.idx], isValid(_fsh) ? &m_shaders[_fsh.idx] : NULL);
 		}
@@ -975,6 +975,10 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 			m_program[_handle.idx].destroy();
 		}
 
+		void precachePipelines(ProgramHandle /*_handle*/, uint16_t /*_numStates*/, const uint64_t* /*_states*/, uint16_t /*_numLayouts*/, const VertexLayout* /*_layouts*/, uint16_t /*_numFrameBuffers*/, const FrameBufferHandle* /*_frameBuffers*/) override
+		{
+		}
+
 		void* createTexture(TextureHandle _handle, const Memory* _mem, uint64_t _flags, uint8_t _skip) override
 		{
 			m_textures[_handle.idx].create(_mem, _flags, _skip);
@@ -1050,6 +1054,13 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 			release(mem);
 		}
 
+		void setTextureResidentMips(TextureHandle _handle, uint8_t _minMip) override
+		{
+			TextureMtl& texture = m_textures[_handle.idx];
+			texture.m_residentMip = _minMip;
+			texture.m_sampler     = getSamplerState(uint32_t(texture.m_flags), _minMip);
+		}
+
 		void overrideInternal(TextureHandle _handle, uintptr_t _ptr) override
 		{
 			m_textures[_handle.idx].overrideInternal(_ptr);
@@ -1358,6 +1369,11 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 			return false;
 		}
 
+		bool getGpuCompletedFrame(uint32_t& /*_outFrameNum*/) override
+		{
+			return false;
+		}
+
 		void flip() override
 		{
 			if (NULL == m_commandBuffer)
@@ -2407,10 +2423,14 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 			return program.m_computePS;
 		}
 
-		SamplerState getSamplerState(uint32_t _flags)
+		SamplerState getSamplerState(uint32_t _flags, uint8_t _minMip = 0)
 		{
 			_flags &= BGFX_SAMPLER_BITS_MASK;
-			SamplerState sampler = m_samplerStateCache.find(_flags);
+
+			// Sampler flags use all low 32 bits (border color and reserved bits
+			// included), resident mip goes into upper 32 bits of the key.
+			const uint64_t key = uint64_t(_minMip) << 32 | _flags;
+			SamplerState sampler = m_samplerStateCache.find(key);
 
 			if (NULL == sampler)
 			{
@@ -2420,7 +2440,7 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 				m_samplerDescriptor.minFilter    = s_textureFilterMinMag[(_flags&BGFX_SAMPLER_MIN_MASK)>>BGFX_SAMPLER_MIN_SHIFT];
 				m_samplerDescriptor.magFilter    = s_textureFilterMinMag[(_flags&BGFX_SAMPLER_MAG_MASK)>>BGFX_SAMPLER_MAG_SHIFT];
 				m_samplerDescriptor.mipFilter    = s_textureFilterMip[(_flags&BGFX_SAMPLER_MIP_MASK)>>BGFX_SAMPLER_MIP_SHIFT];
-				m_samplerDescriptor.lodMinClamp  = 0;
+				m_samplerDescriptor.lodMinClamp  = float(_minMip);
 				m_samplerDescriptor.lodMaxClamp  = FLT_MAX;
 				m_samplerDescriptor.normalizedCoordinates = TRUE;
 				m_samplerDescriptor.maxAnisotropy =  (0 != (_flags & (BGFX_SAMPLER_MIN_ANISOTROPIC|BGFX_SAMPLER_MAG_ANISOTROPIC) ) ) ? m_mainFrameBuffer.m_swapChain->m_maxAnisotropy : 1;
@@ -2436,7 +2456,7 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 				}
 
 				sampler = m_device.newSamplerStateWithDescriptor(m_samplerDescriptor);
-				m_samplerStateCache.add(_flags, sampler);
+				m_samplerStateCache.add(key, sampler);
 			}
 
 			return sampler;
@@ -2805,7 +2825,8 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 
 	void TextureMtl::create(const Memory* _mem, uint64_t _flags, uint8_t _skip)
 	{
-		m_sampler = s_renderMtl->getSamplerState(uint32_t(_flags) );
+		m_sampler     = s_renderMtl->getSamplerState(uint32_t(_flags) );
+		m_residentMip = 0;
 
 		bimg::ImageContainer imageContainer;
 
@@ -3156,7 +3177,7 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 			s_renderMtl->m_renderCommandEncoder.setVertexTexture(p, _stage);
 			s_renderMtl->m_renderCommandEncoder.setVertexSamplerState(
 				  0 == (BGFX_SAMPLER_INTERNAL_DEFAULT & _flags)
-					? s_renderMtl->getSamplerState(_flags)
+					? s_renderMtl->getSamplerState(_flags, m_residentMip)
 					: m_sampler
 				, _stage
 				);
@@ -3168,7 +3189,7 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 			s_renderMtl->m_renderCommandEncoder.setFragmentTexture(p, _stage);
 			s_renderMtl->m_renderCommandEncoder.setFragmentSamplerState(
 				  0 == (BGFX_SAMPLER_INTERNAL_DEFAULT & _flags)
-					? s_renderMtl->getSamplerState(_flags)
+					? s_renderMtl->getSamplerState(_flags, m_residentMip)
 					: m_sampler
 				, _stage
 				);
@@ -4358,7 +4379,7 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 									m_computeCommandEncoder.setTexture(texture.m_ptr, stage);
 									m_computeCommandEncoder.setSamplerState(
 										0 == (BGFX_SAMPLER_INTERNAL_DEFAULT & flags)
-										? getSamplerState(flags)
+										? getSamplerState(flags, texture.m_residentMip)
 										: texture.m_sampler
 										, stage
 										);
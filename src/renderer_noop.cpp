@@ -89,6 +89,11 @@ namespace bgfx { namespace noop
 			return false;
 		}
 
+		bool getGpuCompletedFrame(uint32_t& /*_outFrameNum*/) override
+		{
+			return false;
+		}
+
 		void flip() override
 		{
 		}
@@ -149,7 +154,7 @@ namespace bgfx { namespace noop
 		{
 		}
 
-		void createProgram(ProgramHandle /*_handle*/, ShaderHandle /*_vsh*/, ShaderHandle /*_fsh*/) override
+		void createProgram(ProgramHandle /*_handle*/, ShaderHandle /*_vsh*/, ShaderHandle /*_fsh*/, uint8_t /*_numConstants*/, const SpecializationConstant* /*_constants*/) override
 		{
 		}
 
@@ -157,6 +162,10 @@ namespace bgfx { namespace noop
 		{
 		}
 
+		void precachePipelines(ProgramHandle /*_handle*/, uint16_t /*_numStates*/, const uint64_t* /*_states*/, uint16_t /*_numLayouts*/, const VertexLayout* /*_layouts*/, uint16_t /*_numFrameBuffers*/, const FrameBufferHandle* /*_frameBuffers*/) override
+		{
+		}
+
 		void* createTexture(TextureHandle /*_handle*/, const Memory* /*_mem*/, uint64_t /*_flags*/, uint8_t /*_skip*/) override
 		{
 			return NULL;
@@ -182,6 +191,10 @@ namespace bgfx { namespace noop
 		{
 		}
 
+		void setTextureResidentMips(TextureHandle /*_handle*/, uint8_t /*_minMip*/) override
+		{
+		}
+
 		void overrideInternal(TextureHandle /*_handle*/, uintptr_t /*_ptr*/) override
 		{
 		}
@@ -342,6 +342,9 @@ VK_IMPORT_DEVICE
 			EXT_shader_viewport_index_layer,
 			EXT_custom_border_color,
 			KHR_draw_indirect_count,
+			KHR_timeline_semaphore,
+			KHR_get_memory_requirements2,
+			KHR_dedicated_allocation,
 
 			Count
 		};
@@ -367,6 +370,9 @@ VK_IMPORT_DEVICE
 		{ "VK_EXT_shader_viewport_index_layer",     1, false, false, true                                                         , Layer::Count },
 		{ "VK_EXT_custom_border_color",             1, false, false, true                                                         , Layer::Count },
 		{ "VK_KHR_draw_indirect_count",             1, false, false, true                                                         , Layer::Count },
+		{ "VK_KHR_timeline_semaphore",              1, false, false, true                                                         , Layer::Count },
+		{ "VK_KHR_get_memory_requirements2",        1, false, false, true                                                         , Layer::Count },
+		{ "VK_KHR_dedicated_allocation",            1, false, false, true                                                         , Layer::Count },
 	};
 	BX_STATIC_ASSERT(Extension::Count == BX_COUNTOF(s_extension) );
 
@@ -895,34 +901,58 @@ VK_IMPORT_DEVICE
 		}
 	}
 
-	void setMemoryBarrier(
+	// Number of pipeline barriers and image barriers recorded since last submit.
+	static uint32_t s_numBarriers      = 0;
+	static uint32_t s_numImageBarriers = 0;
+
+	void pipelineBarrier(
 		  VkCommandBuffer _commandBuffer
 		, VkPipelineStageFlags _srcStages
 		, VkPipelineStageFlags _dstStages
+		, uint32_t _numMemoryBarriers
+		, const VkMemoryBarrier* _memoryBarriers
+		, uint32_t _numImageBarriers
+		, const VkImageMemoryBarrier* _imageBarriers
 		)
 	{
-		VkMemoryBarrier mb;
-		mb.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
-		mb.pNext = NULL;
-		mb.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
-		mb.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+		++s_numBarriers;
+		s_numImageBarriers += _numImageBarriers;
 
 		vkCmdPipelineBarrier(
 			  _commandBuffer
 			, _srcStages
 			, _dstStages
 			, 0
-			, 1
-			, &mb
-			, 0
-			, NULL
+			, _numMemoryBarriers
+			, _memoryBarriers
 			, 0
 			, NULL
+			, _numImageBarriers
+			, _imageBarriers
 			);
 	}
 
-	void setImageMemoryBarrier(
+	void setMemoryBarrier(
 		  VkCommandBuffer _commandBuffer
+		, VkPipelineStageFlags _srcStages
+		, VkPipelineStageFlags _dstStages
+		, VkAccessFlags _srcAccess = VK_ACCESS_MEMORY_WRITE_BIT
+		, VkAccessFlags _dstAccess = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT
+		)
+	{
+		VkMemoryBarrier mb;
+		mb.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		mb.pNext = NULL;
+		mb.srcAccessMask = _srcAccess;
+		mb.dstAccessMask = _dstAccess;
+
+		pipelineBarrier(_commandBuffer, _srcStages, _dstStages, 1, &mb, 0, NULL);
+	}
+
+	void getImageMemoryBarrier(
+		  VkImageMemoryBarrier& _imb
+		, VkPipelineStageFlags& _srcStageMask
+		, VkPipelineStageFlags& _dstStageMask
 		, VkImage _image
 		, VkImageAspectFlags _aspectMask
 		, VkImageLayout _oldLayout
@@ -1052,36 +1082,69 @@ VK_IMPORT_DEVICE
 			break;
 		}
 
+		_imb.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		_imb.pNext = NULL;
+		_imb.srcAccessMask = srcAccessMask;
+		_imb.dstAccessMask = dstAccessMask;
+		_imb.oldLayout = _oldLayout;
+		_imb.newLayout = _newLayout;
+		_imb.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		_imb.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		_imb.image = _image;
+		_imb.subresourceRange.aspectMask     = _aspectMask;
+		_imb.subresourceRange.baseMipLevel   = _baseMipLevel;
+		_imb.subresourceRange.levelCount     = _levelCount;
+		_imb.subresourceRange.baseArrayLayer = _baseArrayLayer;
+		_imb.subresourceRange.layerCount     = _layerCount;
+
+		_srcStageMask = srcStageMask;
+		_dstStageMask = dstStageMask;
+	}
+
+	void setImageMemoryBarrier(
+		  VkCommandBuffer _commandBuffer
+		, VkImage _image
+		, VkImageAspectFlags _aspectMask
+		, VkImageLayout _oldLayout
+		, VkImageLayout _newLayout
+		, uint32_t _baseMipLevel = 0
+		, uint32_t _levelCount = VK_REMAINING_MIP_LEVELS
+		, uint32_t _baseArrayLayer = 0
+		, uint32_t _layerCount = VK_REMAINING_ARRAY_LAYERS
+		)
+	{
 		VkImageMemoryBarrier imb;
-		imb.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-		imb.pNext = NULL;
-		imb.srcAccessMask = srcAccessMask;
-		imb.dstAccessMask = dstAccessMask;
-		imb.oldLayout = _oldLayout;
-		imb.newLayout = _newLayout;
-		imb.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-		imb.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-		imb.image = _image;
-		imb.subresourceRange.aspectMask     = _aspectMask;
-		imb.subresourceRange.baseMipLevel   = _baseMipLevel;
-		imb.subresourceRange.levelCount     = _levelCount;
-		imb.subresourceRange.baseArrayLayer = _baseArrayLayer;
-		imb.subresourceRange.layerCount     = _layerCount;
-		vkCmdPipelineBarrier(_commandBuffer
+		VkPipelineStageFlags srcStageMask;
+		VkPipelineStageFlags dstStageMask;
+		getImageMemoryBarrier(
+			  imb
 			, srcStageMask
 			, dstStageMask
-			, 0
-			, 0
-			, NULL
-			, 0
-			, NULL
-			, 1
-			, &imb
+			, _image
+			, _aspectMask
+			, _oldLayout
+			, _newLayout
+			, _baseMipLevel
+			, _levelCount
+			, _baseArrayLayer
+			, _layerCount
 			);
+
+		pipelineBarrier(_commandBuffer, srcStageMask, dstStageMask, 0, NULL, 1, &imb);
 	}
 
 #define MAX_DESCRIPTOR_SETS (1024 * BGFX_CONFIG_MAX_FRAME_LATENCY)
 
+	constexpr uint16_t kImageViewCacheSize = 1024;
+
+	// Cached descriptor sets are released after this many frames without use.
+	constexpr uint32_t kDescriptorSetMaxAge = 16;
+
+	// Resource kinds descriptor set cache tracks for invalidation.
+	constexpr uint32_t kDescriptorResourceTexture      = UINT32_C(0) << 16;
+	constexpr uint32_t kDescriptorResourceVertexBuffer = UINT32_C(1) << 16;
+	constexpr uint32_t kDescriptorResourceIndexBuffer  = UINT32_C(2) << 16;
+
 	struct RendererContextVK : public RendererContextI
 	{
 		RendererContextVK()
@@ -1125,9 +1188,11 @@ VK_IMPORT_DEVICE
 			const void* nextFeatures = NULL;
 			VkPhysicalDeviceLineRasterizationFeaturesEXT lineRasterizationFeatures;
 			VkPhysicalDeviceCustomBorderColorFeaturesEXT customBorderColorFeatures;
+			VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timelineSemaphoreFeatures;
 
 			bx::memSet(&lineRasterizationFeatures, 0, sizeof(lineRasterizationFeatures) );
 			bx::memSet(&customBorderColorFeatures, 0, sizeof(customBorderColorFeatures) );
+			bx::memSet(&timelineSemaphoreFeatures, 0, sizeof(timelineSemaphoreFeatures) );
 
 			m_fbh.idx = kInvalidHandle;
 			bx::memSet(m_uniforms, 0, sizeof(m_uniforms) );
@@ -1524,6 +1589,14 @@ VK_IMPORT_INSTANCE
 						customBorderColorFeatures.pNext = NULL;
 					}
 
+					if (s_extension[Extension::KHR_timeline_semaphore].m_supported)
+					{
+						next->pNext = (VkBaseOutStructure*)&timelineSemaphoreFeatures;
+						next = (VkBaseOutStructure*)&timelineSemaphoreFeatures;
+						timelineSemaphoreFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+						timelineSemaphoreFeatures.pNext = NULL;
+					}
+
 					nextFeatures = deviceFeatures2.pNext;
 
 					vkGetPhysicalDeviceFeatures2KHR(m_physicalDevice, &deviceFeatures2);
@@ -1565,6 +1638,11 @@ VK_IMPORT_INSTANCE
 					&& customBorderColorFeatures.customBorderColors
 					;
 
+				m_timelineSemaphoreSupport = true
+					&& s_extension[Extension::KHR_timeline_semaphore].m_supported
+					&& timelineSemaphoreFeatures.timelineSemaphore
+					;
+
 				m_timerQuerySupport = m_deviceProperties.limits.timestampComputeAndGraphics;
 
 				const bool indirectDrawSupport = true
@@ -1710,6 +1788,8 @@ VK_IMPORT_INSTANCE
 				}
 
 				vkGetPhysicalDeviceMemoryProperties(m_physicalDevice, &m_memoryProperties);
+
+				m_memoryAllocator.init(BGFX_CONFIG_DEVICE_MEMORY_BLOCK_SIZE, BGFX_CONFIG_DEVICE_MEMORY_DEDICATED_SIZE);
 			}
 
 			{
@@ -1873,13 +1953,30 @@ VK_IMPORT_DEVICE
 
 			vkGetDeviceQueue(m_device, m_globalQueueFamily, 0, &m_globalQueue);
 
+			m_dedicatedAllocationSupport = true
+				&& s_extension[Extension::KHR_get_memory_requirements2].m_supported
+				&& s_extension[Extension::KHR_dedicated_allocation].m_supported
+				&& NULL != vkGetBufferMemoryRequirements2KHR
+				&& NULL != vkGetImageMemoryRequirements2KHR
+				;
+
 			{
 				m_numFramesInFlight = _init.resolution.maxFrameLatency == 0
 					? BGFX_CONFIG_MAX_FRAME_LATENCY
 					: _init.resolution.maxFrameLatency
 					;
 
-				result = m_cmd.init(m_globalQueueFamily, m_globalQueue, m_numFramesInFlight);
+				m_numSubmittedFrames = 0;
+
+				m_timelineSemaphoreSupport = true
+					&& m_timelineSemaphoreSupport
+					&& NULL != vkGetSemaphoreCounterValueKHR
+					&& NULL != vkWaitSemaphoresKHR
+					;
+
+				BX_TRACE("Frame pacing: %s.", m_timelineSemaphoreSupport ? "timeline semaphore" : "fences");
+
+				result = m_cmd.init(m_globalQueueFamily, m_globalQueue, m_numFramesInFlight, m_timelineSemaphoreSupport);
 
 				if (VK_SUCCESS != result)
 				{
@@ -1959,19 +2056,62 @@ VK_IMPORT_DEVICE
 					goto error;
 				}
 
+				{
+					bx::HashMurmur2A hash;
+					hash.begin();
+					hash.add(BX_MAKEFOURCC('V', 'K', 'P', 'C') );
+					hash.add(m_deviceProperties.vendorID);
+					hash.add(m_deviceProperties.deviceID);
+					hash.add(m_deviceProperties.driverVersion);
+					hash.add(m_deviceProperties.pipelineCacheUUID, VK_UUID_SIZE);
+					m_pipelineCacheKey = hash.end();
+				}
+
+				const uint32_t length = g_callback->cacheReadSize(m_pipelineCacheKey);
+				void* cachedData = NULL;
+
 				VkPipelineCacheCreateInfo pcci;
 				pcci.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
 				pcci.pNext = NULL;
 				pcci.flags = 0;
 				pcci.initialDataSize = 0;
 				pcci.pInitialData    = NULL;
+
+				if (0 < length)
+				{
+					cachedData = BX_ALLOC(g_allocator, length);
+					if (g_callback->cacheRead(m_pipelineCacheKey, cachedData, length) )
+					{
+						BX_TRACE("Loading cached pipeline state (size %d).", length);
+						pcci.initialDataSize = length;
+						pcci.pInitialData    = cachedData;
+					}
+				}
+
 				result = vkCreatePipelineCache(m_device, &pcci, m_allocatorCb, &m_pipelineCache);
 
+				if (VK_SUCCESS != result
+				&&  NULL   != pcci.pInitialData)
+				{
+					BX_TRACE("Cached pipeline state rejected %d: %s.", result, getName(result) );
+					pcci.initialDataSize = 0;
+					pcci.pInitialData    = NULL;
+					result = vkCreatePipelineCache(m_device, &pcci, m_allocatorCb, &m_pipelineCache);
+				}
+
+				if (NULL != cachedData)
+				{
+					BX_FREE(g_allocator, cachedData);
+				}
+
 				if (VK_SUCCESS != result)
 				{
 					BX_TRACE("Init error: vkCreatePipelineCache failed %d: %s.", result, getName(result) );
 					goto error;
 				}
+
+				m_pipelineCacheDirty      = false;
+				m_pipelineCacheIdleFrames = 0;
 			}
 
 			{
@@ -1984,6 +2124,15 @@ VK_IMPORT_DEVICE
 				}
 			}
 
+			result = m_stagingRing.create(BGFX_CONFIG_STAGING_RING_SIZE, m_numFramesInFlight);
+
+			if (VK_SUCCESS != result)
+			{
+				BX_TRACE("Init warning: creating staging ring failed %d: %s, using temporary staging buffers.", result, getName(result) );
+			}
+
+			m_stagingRing.reset(m_cmd.m_currentFrameInFlight);
+
 			errorState = ErrorState::DescriptorCreated;
 
 			if (NULL == vkSetDebugUtilsObjectNameEXT)
@@ -2030,6 +2179,12 @@ VK_IMPORT_DEVICE
 				goto error;
 			}
 
+			m_pipelinePrecache.init(BGFX_CONFIG_PIPELINE_PRECACHE_NUM_THREADS);
+			m_numPipelinesCreated   = 0;
+			m_numPipelinesPrecached = 0;
+
+			m_presentThread.init(0 != BGFX_CONFIG_PRESENT_THREAD);
+
 			g_internalData.context = m_device;
 			return true;
 
@@ -2049,6 +2204,7 @@ VK_IMPORT_DEVICE
 				{
 					m_scratchBuffer[ii].destroy();
 				}
+				m_stagingRing.destroy();
 				vkDestroy(m_pipelineCache);
 				vkDestroy(m_descriptorPool);
 				BX_FALLTHROUGH;
@@ -2059,6 +2215,7 @@ VK_IMPORT_DEVICE
 
 			case ErrorState::CommandQueueCreated:
 				m_cmd.shutdown();
+				m_memoryAllocator.shutdown();
 				BX_FALLTHROUGH;
 
 			case ErrorState::DeviceCreated:
@@ -2090,6 +2247,11 @@ VK_IMPORT_DEVICE
 
 		void shutdown()
 		{
+			m_presentThread.shutdown();
+			m_pipelinePrecache.shutdown();
+			flushPipelinePrecache(true);
+			m_uploadBatch.discard();
+
 			VK_CHECK(vkDeviceWaitIdle(m_device) );
 
 			if (m_timerQuerySupport)
@@ -2101,6 +2263,7 @@ VK_IMPORT_DEVICE
 			preReset();
 
 			m_pipelineStateCache.invalidate();
+			m_descriptorSetCache.invalidate();
 			m_descriptorSetLayoutCache.invalidate();
 			m_renderPassCache.invalidate();
 			m_samplerCache.invalidate();
@@ -2140,7 +2303,10 @@ VK_IMPORT_DEVICE
 			m_backBuffer.destroy();
 
 			m_cmd.shutdown();
+			m_stagingRing.destroy();
+			m_memoryAllocator.shutdown();
 
+			savePipelineCache();
 			vkDestroy(m_pipelineCache);
 			vkDestroy(m_descriptorPool);
 
@@ -2174,8 +2340,63 @@ VK_IMPORT_DEVICE
 			return false;
 		}
 
+		bool getGpuCompletedFrame(uint32_t& _outFrameNum) override
+		{
+			if (0 == m_numSubmittedFrames)
+			{
+				return false;
+			}
+
+			const uint64_t completed = m_cmd.getCompleted();
+			const uint32_t num = bx::min<uint32_t>(m_numSubmittedFrames, BX_COUNTOF(m_submittedFrame) );
+
+			for (uint32_t ii = 0; ii < num; ++ii)
+			{
+				const SubmittedFrame& frame = m_submittedFrame[(m_numSubmittedFrames - 1 - ii) % BX_COUNTOF(m_submittedFrame)];
+
+				if (frame.m_submitted <= completed)
+				{
+					_outFrameNum = frame.m_frameNum;
+					return true;
+				}
+			}
+
+			// Command list reuse waits for submissions older than frames in
+			// flight, so frame before oldest recorded one is done.
+			const SubmittedFrame& oldest = m_submittedFrame[(m_numSubmittedFrames - num) % BX_COUNTOF(m_submittedFrame)];
+			_outFrameNum = num < BX_COUNTOF(m_submittedFrame)
+				? UINT32_MAX
+				: oldest.m_frameNum - 1
+				;
+
+			return true;
+		}
+
+		void waitPresent()
+		{
+			m_presentElapsed += m_presentThread.wait();
+		}
+
 		void flip() override
 		{
+			if (m_presentThread.m_enabled)
+			{
+				waitPresent();
+
+				for (uint16_t ii = 0; ii < m_numWindows; ++ii)
+				{
+					FrameBufferVK& fb = isValid(m_windows[ii])
+						? m_frameBuffers[m_windows[ii].idx]
+						: m_backBuffer
+						;
+
+					m_presentThread.push(&fb);
+				}
+
+				m_presentThread.kick();
+				return;
+			}
+
 			int64_t start = bx::getHPCounter();
 
 			for (uint16_t ii = 0; ii < m_numWindows; ++ii)
@@ -2200,6 +2421,7 @@ VK_IMPORT_DEVICE
 
 		void destroyIndexBuffer(IndexBufferHandle _handle) override
 		{
+			m_descriptorSetCache.invalidateWithResource(kDescriptorResourceIndexBuffer | _handle.idx);
 			m_indexBuffers[_handle.idx].destroy();
 		}
 
@@ -2221,6 +2443,7 @@ VK_IMPORT_DEVICE
 
 		void destroyVertexBuffer(VertexBufferHandle _handle) override
 		{
+			m_descriptorSetCache.invalidateWithResource(kDescriptorResourceVertexBuffer | _handle.idx);
 			m_vertexBuffers[_handle.idx].destroy();
 		}
 
@@ -2236,6 +2459,7 @@ VK_IMPORT_DEVICE
 
 		void destroyDynamicIndexBuffer(IndexBufferHandle _handle) override
 		{
+			m_descriptorSetCache.invalidateWithResource(kDescriptorResourceIndexBuffer | _handle.idx);
 			m_indexBuffers[_handle.idx].destroy();
 		}
 
@@ -2252,6 +2476,7 @@ VK_IMPORT_DEVICE
 
 		void destroyDynamicVertexBuffer(VertexBufferHandle _handle) override
 		{
+			m_descriptorSetCache.invalidateWithResource(kDescriptorResourceVertexBuffer | _handle.idx);
 			m_vertexBuffers[_handle.idx].destroy();
 		}
 
@@ -2262,19 +2487,119 @@ VK_IMPORT_DEVICE
 
 		void destroyShader(ShaderHandle _handle) override
 		{
+			m_pipelinePrecache.wait();
 			m_shaders[_handle.idx].destroy();
 		}
 
-		void createProgram(ProgramHandle _handle, ShaderHandle _vsh, ShaderHandle _fsh) override
+		void createProgram(ProgramHandle _handle, ShaderHandle _vsh, ShaderHandle _fsh, uint8_t _numConstants, const SpecializationConstant* _constants) override
 		{
-			m_program[_handle.idx].create(&m_shaders[_vsh.idx], isValid(_fsh) ? &m_shaders[_fsh.idx] : NULL);
+			m_program[_handle.idx].create(&m_shaders[_vsh.idx], isValid(_fsh) ? &m_shaders[_fsh.idx] : NULL, _numConstants, _constants);
 		}
 
 		void destroyProgram(ProgramHandle _handle) override
 		{
+			m_pipelinePrecache.wait();
 			m_program[_handle.idx].destroy();
 		}
 
+		void precachePipelines(ProgramHandle _handle, uint16_t _numStates, const uint64_t* _states, uint16_t _numLayouts, const VertexLayout* _layouts, uint16_t _numFrameBuffers, const FrameBufferHandle* _frameBuffers) override
+		{
+			const ProgramVK& program = m_program[_handle.idx];
+
+			const uint16_t numFrameBuffers = bx::max<uint16_t>(_numFrameBuffers, 1);
+			const uint16_t numLayouts      = bx::max<uint16_t>(_numLayouts, 1);
+
+			for (uint16_t ff = 0; ff < numFrameBuffers; ++ff)
+			{
+				FrameBufferHandle fbh = BGFX_INVALID_HANDLE;
+				if (0 < _numFrameBuffers)
+				{
+					fbh = _frameBuffers[ff];
+				}
+
+				const FrameBufferVK& frameBuffer = isValid(fbh)
+					? m_frameBuffers[fbh.idx]
+					: m_backBuffer
+					;
+
+				const uint32_t numAttachments = NULL == frameBuffer.m_nwh
+					? frameBuffer.m_num
+					: 1
+					;
+
+				for (uint16_t ll = 0; ll < numLayouts; ++ll)
+				{
+					const VertexLayout* layout = 0 == _numLayouts ? NULL : &_layouts[ll];
+					const uint8_t numStreams = NULL == layout ? 0 : 1;
+
+					for (uint16_t ii = 0; ii < _numStates; ++ii)
+					{
+						PipelinePrecacheVK::Job job;
+						job.m_state = _states[ii];
+
+						uint64_t stencil = BGFX_STENCIL_NONE;
+						job.m_hash = getPipelineHash(job.m_state, stencil, numStreams, &layout, program, 0, frameBuffer.m_renderPass);
+
+						if (VK_NULL_HANDLE != m_pipelineStateCache.find(job.m_hash) )
+						{
+							continue;
+						}
+
+						job.m_program        = _handle;
+						job.m_numStreams     = numStreams;
+						job.m_renderPass     = frameBuffer.m_renderPass;
+						job.m_samples        = frameBuffer.m_sampler.Sample;
+						job.m_numAttachments = numAttachments;
+						job.m_pipeline       = VK_NULL_HANDLE;
+
+						if (NULL != layout)
+						{
+							bx::memCopy(&job.m_layout, layout, sizeof(VertexLayout) );
+						}
+
+						m_pipelinePrecache.push(job);
+					}
+				}
+			}
+		}
+
+		void compilePipeline(PipelinePrecacheVK::Job& _job)
+		{
+			const VertexLayout* layout = &_job.m_layout;
+
+			_job.m_pipeline = createPipeline(
+				  _job.m_state
+				, BGFX_STENCIL_NONE
+				, _job.m_numStreams
+				, &layout
+				, m_program[_job.m_program.idx]
+				, 0
+				, _job.m_renderPass
+				, _job.m_samples
+				, _job.m_numAttachments
+				);
+		}
+
+		void flushPipelinePrecache(bool _discard)
+		{
+			PipelinePrecacheVK::Job job;
+			while (m_pipelinePrecache.pop(job) )
+			{
+				if (_discard
+				||  VK_NULL_HANDLE != m_pipelineStateCache.find(job.m_hash) )
+				{
+					vkDestroy(job.m_pipeline);
+					continue;
+				}
+
+				m_pipelineStateCache.add(job.m_hash, job.m_pipeline);
+
+				m_pipelineCacheDirty      = true;
+				m_pipelineCacheIdleFrames = 0;
+				++m_numPipelinesPrecached;
+			}
+		}
+
 		void* createTexture(TextureHandle _handle, const Memory* _mem, uint64_t _flags, uint8_t _skip) override
 		{
 			return m_textures[_handle.idx].create(m_commandBuffer, _mem, _flags, _skip);
@@ -2352,6 +2677,11 @@ VK_IMPORT_DEVICE
 			bgfx::release(mem);
 		}
 
+		void setTextureResidentMips(TextureHandle _handle, uint8_t _minMip) override
+		{
+			m_textures[_handle.idx].m_residentMip = _minMip;
+		}
+
 		void overrideInternal(TextureHandle /*_handle*/, uintptr_t /*_ptr*/) override
 		{
 		}
@@ -2363,6 +2693,7 @@ VK_IMPORT_DEVICE
 
 		void destroyTexture(TextureHandle _handle) override
 		{
+			m_descriptorSetCache.invalidateWithResource(kDescriptorResourceTexture | _handle.idx);
 			m_imageViewCache.invalidateWithParent(_handle.idx);
 			m_textures[_handle.idx].destroy();
 		}
@@ -2556,6 +2887,15 @@ VK_IMPORT_DEVICE
 			}
 		}
 
+		void release(DeviceMemoryAllocationVK& _allocation)
+		{
+			if (VK_NULL_HANDLE != _allocation.m_memory)
+			{
+				m_cmd.release(_allocation);
+				_allocation = DeviceMemoryAllocationVK();
+			}
+		}
+
 		void submitBlit(BlitState& _bs, uint16_t _view);
 
 		void submit(Frame* _render, ClearQuad& _clearQuad, TextVideoMemBlitter& _textVideoMemBlitter) override;
@@ -2655,10 +2995,11 @@ VK_IMPORT_DEVICE
 		void blitRender(TextVideoMemBlitter& _blitter, uint32_t _numIndices) override
 		{
 			const uint32_t numVertices = _numIndices*4/6;
-			if (0 < numVertices && m_backBuffer.isRenderable() )
+			if (0 < numVertices && acquireFrameBuffer(m_backBuffer) )
 			{
 				m_indexBuffers[_blitter.m_ib->handle.idx].update(m_commandBuffer, 0, _numIndices*2, _blitter.m_ib->data);
 				m_vertexBuffers[_blitter.m_vb->handle.idx].update(m_commandBuffer, 0, numVertices*_blitter.m_layout.m_stride, _blitter.m_vb->data, true);
+				flushUploads();
 
 				VkRenderPassBeginInfo rpbi;
 				rpbi.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
@@ -2745,6 +3086,9 @@ VK_IMPORT_DEVICE
 
 			if (m_depthClamp != depthClamp)
 			{
+				m_pipelinePrecache.wait();
+				flushPipelinePrecache(true);
+
 				m_depthClamp = depthClamp;
 				m_pipelineStateCache.invalidate();
 			}
@@ -2845,10 +3189,10 @@ VK_IMPORT_DEVICE
 				for (uint8_t ii = 0, num = oldFrameBuffer.m_num; ii < num; ++ii)
 				{
 					TextureVK& texture = m_textures[oldFrameBuffer.m_texture[ii].idx];
-					texture.setImageMemoryBarrier(m_commandBuffer, texture.m_sampledLayout);
+					texture.setImageMemoryBarrier(m_barrierBatch, texture.m_sampledLayout);
 					if (VK_NULL_HANDLE != texture.m_singleMsaaImage)
 					{
-						texture.setImageMemoryBarrier(m_commandBuffer, texture.m_sampledLayout, true);
+						texture.setImageMemoryBarrier(m_barrierBatch, texture.m_sampledLayout, true);
 					}
 				}
 
@@ -2859,7 +3203,7 @@ VK_IMPORT_DEVICE
 
 					if (!writeOnly)
 					{
-						texture.setImageMemoryBarrier(m_commandBuffer, texture.m_sampledLayout);
+						texture.setImageMemoryBarrier(m_barrierBatch, texture.m_sampledLayout);
 					}
 				}
 			}
@@ -2870,7 +3214,7 @@ VK_IMPORT_DEVICE
 				{
 					TextureVK& texture = m_textures[newFrameBuffer.m_texture[ii].idx];
 					texture.setImageMemoryBarrier(
-						  m_commandBuffer
+						  m_barrierBatch
 						, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
 						);
 				}
@@ -2879,29 +3223,49 @@ VK_IMPORT_DEVICE
 				{
 					TextureVK& texture = m_textures[newFrameBuffer.m_depth.idx];
 					texture.setImageMemoryBarrier(
-						  m_commandBuffer
+						  m_barrierBatch
 						, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
 						);
 				}
+			}
+
+			// Transitions of previous frame buffer attachments back to sampled layout and
+			// new frame buffer attachments are recorded with single barrier.
+			m_barrierBatch.flush(m_commandBuffer);
 
+			if (NULL == newFrameBuffer.m_nwh)
+			{
 				newFrameBuffer.acquire(m_commandBuffer);
 			}
 
-			if (_acquire)
+			if (_acquire
+			&&  NULL != newFrameBuffer.m_nwh)
+			{
+				// Swap chain image is acquired only once render pass into it begins,
+				// since acquire has to wait for present thread to finish presenting
+				// previous frame.
+				newFrameBuffer.m_needAcquire = true;
+			}
+
+			m_fbh = _fbh;
+		}
+
+		bool acquireFrameBuffer(FrameBufferVK& _fb)
+		{
+			if (_fb.m_needAcquire)
 			{
+				_fb.m_needAcquire = false;
+
 				int64_t start = bx::getHPCounter();
 
-				newFrameBuffer.acquire(m_commandBuffer);
+				_fb.acquire(m_commandBuffer);
 
 				int64_t now = bx::getHPCounter();
 
-				if (NULL != newFrameBuffer.m_nwh)
-				{
-					m_presentElapsed += now - start;
-				}
+				m_presentElapsed += now - start;
 			}
 
-			m_fbh = _fbh;
+			return _fb.isRenderable();
 		}
 
 		void setDebugWireframe(bool _wireframe)
@@ -2909,12 +3273,15 @@ VK_IMPORT_DEVICE
 			const bool wireframe = m_deviceFeatures.fillModeNonSolid && _wireframe;
 			if (m_wireframe != wireframe)
 			{
+				m_pipelinePrecache.wait();
+				flushPipelinePrecache(true);
+
 				m_wireframe = wireframe;
 				m_pipelineStateCache.invalidate();
 			}
 		}
 
-		void setBlendState(VkPipelineColorBlendStateCreateInfo& _desc, uint64_t _state, uint32_t _rgba = 0)
+		void setBlendState(VkPipelineColorBlendStateCreateInfo& _desc, uint64_t _state, uint32_t _numAttachments, uint32_t _rgba = 0)
 		{
 			VkPipelineColorBlendAttachmentState* bas = const_cast<VkPipelineColorBlendAttachmentState*>(_desc.pAttachments);
 
@@ -2949,20 +3316,10 @@ VK_IMPORT_DEVICE
 				bas->colorWriteMask = writeMask;
 			}
 
-			const FrameBufferVK& frameBuffer = isValid(m_fbh)
-				? m_frameBuffers[m_fbh.idx]
-				: m_backBuffer
-				;
-
-			const uint32_t numAttachments = NULL == frameBuffer.m_nwh
-				? frameBuffer.m_num
-				: 1
-				;
-
 			if (!!(BGFX_STATE_BLEND_INDEPENDENT & _state)
 			&&  m_deviceFeatures.independentBlend )
 			{
-				for (uint32_t ii = 1, rgba = _rgba; ii < numAttachments; ++ii, rgba >>= 11)
+				for (uint32_t ii = 1, rgba = _rgba; ii < _numAttachments; ++ii, rgba >>= 11)
 				{
 					++bas;
 					bas->blendEnable =  0 != (rgba & 0x7ff);
@@ -2984,7 +3341,7 @@ VK_IMPORT_DEVICE
 			}
 			else
 			{
-				for (uint32_t ii = 1; ii < numAttachments; ++ii)
+				for (uint32_t ii = 1; ii < _numAttachments; ++ii)
 				{
 					bx::memCopy(&bas[ii], bas, sizeof(VkPipelineColorBlendAttachmentState) );
 				}
@@ -2995,7 +3352,7 @@ VK_IMPORT_DEVICE
 			_desc.flags = 0;
 			_desc.logicOpEnable = VK_FALSE;
 			_desc.logicOp       = VK_LOGIC_OP_CLEAR;
-			_desc.attachmentCount = numAttachments;
+			_desc.attachmentCount = _numAttachments;
 			_desc.blendConstants[0] = 0.0f;
 			_desc.blendConstants[1] = 0.0f;
 			_desc.blendConstants[2] = 0.0f;
@@ -3141,7 +3498,7 @@ VK_IMPORT_DEVICE
 			}
 		}
 
-		VkResult getRenderPass(uint8_t _num, const VkFormat* _formats, const VkImageAspectFlags* _aspects, const bool* _resolve, VkSampleCountFlagBits _samples, ::VkRenderPass* _renderPass)
+		VkResult getRenderPass(uint8_t _num, const VkFormat* _formats, const VkImageAspectFlags* _aspects, const bool* _resolve, VkSampleCountFlagBits _samples, ::VkRenderPass* _renderPass, uint16_t _clearFlags = BGFX_CLEAR_NONE, uint16_t _discardFlags = BGFX_CLEAR_NONE)
 		{
 			VkResult result = VK_SUCCESS;
 
@@ -3158,6 +3515,8 @@ VK_IMPORT_DEVICE
 			{
 				hash.add(_resolve, sizeof(bool) * _num);
 			}
+			hash.add(_clearFlags);
+			hash.add(_discardFlags);
 			uint32_t hashKey = hash.end();
 
 			VkRenderPass renderPass = m_renderPassCache.find(hashKey);
@@ -3202,6 +3561,18 @@ VK_IMPORT_DEVICE
 
 				if (_aspects[ii] & VK_IMAGE_ASPECT_COLOR_BIT)
 				{
+					// Load and store ops don't affect render pass compatibility, variants can be
+					// used with frame buffers and pipelines created with default render pass.
+					if (0 != (_clearFlags & BGFX_CLEAR_COLOR) )
+					{
+						ad[ii].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+					}
+
+					if (0 != (_discardFlags & (BGFX_CLEAR_DISCARD_COLOR_0 << numColorAr) ) )
+					{
+						ad[ii].storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+					}
+
 					colorAr[numColorAr].layout     = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
 					colorAr[numColorAr].attachment = ii;
 
@@ -3224,8 +3595,10 @@ VK_IMPORT_DEVICE
 				}
 				else if (_aspects[ii] & (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT) )
 				{
-					ad[ii].stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_LOAD;
-					ad[ii].stencilStoreOp = VK_ATTACHMENT_STORE_OP_STORE;
+					ad[ii].loadOp         = 0 != (_clearFlags   & BGFX_CLEAR_DEPTH)           ? VK_ATTACHMENT_LOAD_OP_CLEAR      : VK_ATTACHMENT_LOAD_OP_LOAD;
+					ad[ii].storeOp        = 0 != (_discardFlags & BGFX_CLEAR_DISCARD_DEPTH)   ? VK_ATTACHMENT_STORE_OP_DONT_CARE : VK_ATTACHMENT_STORE_OP_STORE;
+					ad[ii].stencilLoadOp  = 0 != (_clearFlags   & BGFX_CLEAR_STENCIL)         ? VK_ATTACHMENT_LOAD_OP_CLEAR      : VK_ATTACHMENT_LOAD_OP_LOAD;
+					ad[ii].stencilStoreOp = 0 != (_discardFlags & BGFX_CLEAR_DISCARD_STENCIL) ? VK_ATTACHMENT_STORE_OP_DONT_CARE : VK_ATTACHMENT_STORE_OP_STORE;
 					ad[ii].initialLayout  = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
 					ad[ii].finalLayout    = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
 
@@ -3305,7 +3678,7 @@ VK_IMPORT_DEVICE
 			return result;
 		}
 
-		VkResult getRenderPass(uint8_t _num, const Attachment* _attachments, ::VkRenderPass* _renderPass)
+		VkResult getRenderPass(uint8_t _num, const Attachment* _attachments, ::VkRenderPass* _renderPass, uint16_t _clearFlags = BGFX_CLEAR_NONE, uint16_t _discardFlags = BGFX_CLEAR_NONE)
 		{
 			VkFormat formats[BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS];
 			VkImageAspectFlags aspects[BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS];
@@ -3319,10 +3692,10 @@ VK_IMPORT_DEVICE
 				samples = texture.m_sampler.Sample;
 			}
 
-			return getRenderPass(_num, formats, aspects, NULL, samples, _renderPass);
+			return getRenderPass(_num, formats, aspects, NULL, samples, _renderPass, _clearFlags, _discardFlags);
 		}
 
-		VkResult getRenderPass(const SwapChainVK& swapChain, ::VkRenderPass* _renderPass)
+		VkResult getRenderPass(const SwapChainVK& swapChain, ::VkRenderPass* _renderPass, uint16_t _clearFlags = BGFX_CLEAR_NONE, uint16_t _discardFlags = BGFX_CLEAR_NONE)
 		{
 			const VkFormat formats[2] =
 			{
@@ -3341,10 +3714,10 @@ VK_IMPORT_DEVICE
 			};
 			const VkSampleCountFlagBits samples = swapChain.m_sampler.Sample;
 
-			return getRenderPass(BX_COUNTOF(formats), formats, aspects, resolve, samples, _renderPass);
+			return getRenderPass(BX_COUNTOF(formats), formats, aspects, resolve, samples, _renderPass, _clearFlags, _discardFlags);
 		}
 
-		VkSampler getSampler(uint32_t _flags, VkFormat _format, const float _palette[][4])
+		VkSampler getSampler(uint32_t _flags, VkFormat _format, const float _palette[][4], uint8_t _minMip = 0)
 		{
 			uint32_t index = ((_flags & BGFX_SAMPLER_BORDER_COLOR_MASK) >> BGFX_SAMPLER_BORDER_COLOR_SHIFT);
 			index = bx::min<uint32_t>(BGFX_CONFIG_MAX_COLOR_PALETTE - 1, index);
@@ -3378,6 +3751,7 @@ VK_IMPORT_DEVICE
 				hash.add(_flags);
 				hash.add(-1);
 				hash.add(VK_FORMAT_UNDEFINED);
+				hash.add(_minMip);
 				hashKey = hash.end();
 
 				sampler = m_samplerCache.find(hashKey);
@@ -3389,6 +3763,7 @@ VK_IMPORT_DEVICE
 				hash.add(_flags);
 				hash.add(index);
 				hash.add(_format);
+				hash.add(_minMip);
 				hashKey = hash.end();
 
 				const uint32_t colorHashKey = m_samplerBorderColorCache.find(hashKey);
@@ -3428,7 +3803,7 @@ VK_IMPORT_DEVICE
 			sci.maxAnisotropy    = m_maxAnisotropy;
 			sci.compareEnable    = 0 != cmpFunc;
 			sci.compareOp        = s_cmpFunc[cmpFunc];
-			sci.minLod           = 0.0f;
+			sci.minLod           = float(_minMip);
 			sci.maxLod           = VK_LOD_CLAMP_NONE;
 			sci.borderColor      = VK_BORDER_COLOR_FLOAT_OPAQUE_BLACK;
 			sci.unnormalizedCoordinates = VK_FALSE;
@@ -3480,6 +3855,14 @@ VK_IMPORT_DEVICE
 
 			VkImageView view;
 			VK_CHECK(texture.createView(0, texture.m_numSides, _mip, _numMips, _type, aspectMask, false, &view) );
+
+			if (kImageViewCacheSize == m_imageViewCache.getCount() )
+			{
+				// Adding view evicts least recently used one, which cached
+				// descriptor sets might still reference.
+				m_descriptorSetCache.invalidate();
+			}
+
 			m_imageViewCache.add(hashKey, view, _handle.idx);
 
 			return view;
@@ -3492,6 +3875,7 @@ VK_IMPORT_DEVICE
 			bx::HashMurmur2A murmur;
 			murmur.begin();
 			murmur.add(program.m_vsh->m_hash);
+			murmur.add(program.m_specializationHash);
 			const uint32_t hash = murmur.end();
 
 			VkPipeline pipeline = m_pipelineStateCache.find(hash);
@@ -3512,7 +3896,7 @@ VK_IMPORT_DEVICE
 			cpci.stage.stage  = VK_SHADER_STAGE_COMPUTE_BIT;
 			cpci.stage.module = program.m_vsh->m_module;
 			cpci.stage.pName  = "main";
-			cpci.stage.pSpecializationInfo = NULL;
+			cpci.stage.pSpecializationInfo = program.getSpecializationInfo();
 
 			cpci.layout             = program.m_pipelineLayout;
 			cpci.basePipelineHandle = VK_NULL_HANDLE;
@@ -3522,13 +3906,14 @@ VK_IMPORT_DEVICE
 
 			m_pipelineStateCache.add(hash, pipeline);
 
+			m_pipelineCacheDirty      = true;
+			m_pipelineCacheIdleFrames = 0;
+
 			return pipeline;
 		}
 
-		VkPipeline getPipeline(uint64_t _state, uint64_t _stencil, uint8_t _numStreams, const VertexLayout** _layouts, ProgramHandle _program, uint8_t _numInstanceData)
+		uint32_t getPipelineHash(uint64_t& _state, uint64_t& _stencil, uint8_t _numStreams, const VertexLayout** _layouts, const ProgramVK& _program, uint8_t _numInstanceData, VkRenderPass _renderPass)
 		{
-			ProgramVK& program = m_program[_program.idx];
-
 			_state &= 0
 				| BGFX_STATE_WRITE_MASK
 				| BGFX_STATE_DEPTH_TEST_MASK
@@ -3550,7 +3935,7 @@ VK_IMPORT_DEVICE
 			if (0 < _numStreams)
 			{
 				bx::memCopy(&layout, _layouts[0], sizeof(VertexLayout) );
-				const uint16_t* attrMask = program.m_vsh->m_attrMask;
+				const uint16_t* attrMask = _program.m_vsh->m_attrMask;
 
 				for (uint32_t ii = 0; ii < Attrib::Count; ++ii)
 				{
@@ -3560,23 +3945,20 @@ VK_IMPORT_DEVICE
 				}
 			}
 
-			const FrameBufferVK& frameBuffer = isValid(m_fbh)
-				? m_frameBuffers[m_fbh.idx]
-				: m_backBuffer
-				;
-
 			bx::HashMurmur2A murmur;
 			murmur.begin();
 			murmur.add(_state);
 			murmur.add(_stencil);
-			murmur.add(program.m_vsh->m_hash);
-			murmur.add(program.m_vsh->m_attrMask, sizeof(program.m_vsh->m_attrMask) );
+			murmur.add(_program.m_vsh->m_hash);
+			murmur.add(_program.m_vsh->m_attrMask, sizeof(_program.m_vsh->m_attrMask) );
 
-			if (NULL != program.m_fsh)
+			if (NULL != _program.m_fsh)
 			{
-				murmur.add(program.m_fsh->m_hash);
+				murmur.add(_program.m_fsh->m_hash);
 			}
 
+			murmur.add(_program.m_specializationHash);
+
 			for (uint8_t ii = 0; ii < _numStreams; ++ii)
 			{
 				murmur.add(_layouts[ii]->m_hash);
@@ -3584,8 +3966,20 @@ VK_IMPORT_DEVICE
 
 			murmur.add(layout.m_attributes, sizeof(layout.m_attributes) );
 			murmur.add(_numInstanceData);
-			murmur.add(frameBuffer.m_renderPass);
-			const uint32_t hash = murmur.end();
+			murmur.add(_renderPass);
+			return murmur.end();
+		}
+
+		VkPipeline getPipeline(uint64_t _state, uint64_t _stencil, uint8_t _numStreams, const VertexLayout** _layouts, ProgramHandle _program, uint8_t _numInstanceData)
+		{
+			const ProgramVK& program = m_program[_program.idx];
+
+			const FrameBufferVK& frameBuffer = isValid(m_fbh)
+				? m_frameBuffers[m_fbh.idx]
+				: m_backBuffer
+				;
+
+			const uint32_t hash = getPipelineHash(_state, _stencil, _numStreams, _layouts, program, _numInstanceData, frameBuffer.m_renderPass);
 
 			VkPipeline pipeline = m_pipelineStateCache.find(hash);
 
@@ -3594,10 +3988,37 @@ VK_IMPORT_DEVICE
 				return pipeline;
 			}
 
+			const uint32_t numAttachments = NULL == frameBuffer.m_nwh
+				? frameBuffer.m_num
+				: 1
+				;
+
+			pipeline = createPipeline(
+				  _state
+				, _stencil
+				, _numStreams
+				, _layouts
+				, program
+				, _numInstanceData
+				, frameBuffer.m_renderPass
+				, frameBuffer.m_sampler.Sample
+				, numAttachments
+				);
+			m_pipelineStateCache.add(hash, pipeline);
+
+			m_pipelineCacheDirty      = true;
+			m_pipelineCacheIdleFrames = 0;
+			++m_numPipelinesCreated;
+
+			return pipeline;
+		}
+
+		VkPipeline createPipeline(uint64_t _state, uint64_t _stencil, uint8_t _numStreams, const VertexLayout** _layouts, const ProgramVK& _program, uint8_t _numInstanceData, VkRenderPass _renderPass, VkSampleCountFlagBits _samples, uint32_t _numAttachments)
+		{
 			VkPipelineColorBlendAttachmentState blendAttachmentState[BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS];
 			VkPipelineColorBlendStateCreateInfo colorBlendState;
 			colorBlendState.pAttachments = blendAttachmentState;
-			setBlendState(colorBlendState, _state);
+			setBlendState(colorBlendState, _state, _numAttachments);
 
 			VkPipelineInputAssemblyStateCreateInfo inputAssemblyState;
 			inputAssemblyState.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
@@ -3636,7 +4057,7 @@ VK_IMPORT_DEVICE
 			VkPipelineVertexInputStateCreateInfo vertexInputState;
 			vertexInputState.pVertexBindingDescriptions   = inputBinding;
 			vertexInputState.pVertexAttributeDescriptions = inputAttrib;
-			setInputLayout(vertexInputState, _numStreams, _layouts, program, _numInstanceData);
+			setInputLayout(vertexInputState, _numStreams, _layouts, _program, _numInstanceData);
 
 			const VkDynamicState dynamicStates[] =
 			{
@@ -3658,19 +4079,19 @@ VK_IMPORT_DEVICE
 			shaderStages[0].pNext = NULL;
 			shaderStages[0].flags = 0;
 			shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
-			shaderStages[0].module = program.m_vsh->m_module;
+			shaderStages[0].module = _program.m_vsh->m_module;
 			shaderStages[0].pName  = "main";
-			shaderStages[0].pSpecializationInfo = NULL;
+			shaderStages[0].pSpecializationInfo = _program.getSpecializationInfo();
 
-			if (NULL != program.m_fsh)
+			if (NULL != _program.m_fsh)
 			{
 				shaderStages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
 				shaderStages[1].pNext = NULL;
 				shaderStages[1].flags = 0;
 				shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-				shaderStages[1].module = program.m_fsh->m_module;
+				shaderStages[1].module = _program.m_fsh->m_module;
 				shaderStages[1].pName  = "main";
-				shaderStages[1].pSpecializationInfo = NULL;
+				shaderStages[1].pSpecializationInfo = _program.getSpecializationInfo();
 			}
 
 			VkPipelineViewportStateCreateInfo viewportState;
@@ -3686,7 +4107,7 @@ VK_IMPORT_DEVICE
 			multisampleState.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
 			multisampleState.pNext = NULL;
 			multisampleState.flags = 0;
-			multisampleState.rasterizationSamples  = frameBuffer.m_sampler.Sample;
+			multisampleState.rasterizationSamples  = _samples;
 			multisampleState.sampleShadingEnable   = VK_FALSE;
 			multisampleState.minSampleShading      = 0.0f;
 			multisampleState.pSampleMask           = NULL;
@@ -3697,7 +4118,7 @@ VK_IMPORT_DEVICE
 			graphicsPipeline.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
 			graphicsPipeline.pNext = NULL;
 			graphicsPipeline.flags = 0;
-			graphicsPipeline.stageCount = NULL == program.m_fsh ? 1 : 2;
+			graphicsPipeline.stageCount = NULL == _program.m_fsh ? 1 : 2;
 			graphicsPipeline.pStages    = shaderStages;
 			graphicsPipeline.pVertexInputState   = &vertexInputState;
 			graphicsPipeline.pInputAssemblyState = &inputAssemblyState;
@@ -3708,88 +4129,49 @@ VK_IMPORT_DEVICE
 			graphicsPipeline.pDepthStencilState  = &depthStencilState;
 			graphicsPipeline.pColorBlendState    = &colorBlendState;
 			graphicsPipeline.pDynamicState       = &dynamicState;
-			graphicsPipeline.layout     = program.m_pipelineLayout;
-			graphicsPipeline.renderPass = frameBuffer.m_renderPass;
+			graphicsPipeline.layout     = _program.m_pipelineLayout;
+			graphicsPipeline.renderPass = _renderPass;
 			graphicsPipeline.subpass    = 0;
 			graphicsPipeline.basePipelineHandle = VK_NULL_HANDLE;
 			graphicsPipeline.basePipelineIndex  = 0;
 
-			uint32_t length = g_callback->cacheReadSize(hash);
-			bool cached = length > 0;
-
-			void* cachedData = NULL;
-
-			VkPipelineCacheCreateInfo pcci;
-			pcci.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
-			pcci.pNext = NULL;
-			pcci.flags = 0;
-			pcci.initialDataSize = 0;
-			pcci.pInitialData    = NULL;
-
-			if (cached)
-			{
-				cachedData = BX_ALLOC(g_allocator, length);
-				if (g_callback->cacheRead(hash, cachedData, length) )
-				{
-					BX_TRACE("Loading cached pipeline state (size %d).", length);
-					bx::MemoryReader reader(cachedData, length);
-
-					pcci.initialDataSize = (size_t)reader.remaining();
-					pcci.pInitialData    = reader.getDataPtr();
-				}
-			}
-
-			VkPipelineCache cache;
-			VK_CHECK(vkCreatePipelineCache(m_device, &pcci, m_allocatorCb, &cache) );
-
+			VkPipeline pipeline;
 			VK_CHECK(vkCreateGraphicsPipelines(
 				  m_device
-				, cache
+				, m_pipelineCache
 				, 1
 				, &graphicsPipeline
 				, m_allocatorCb
 				, &pipeline
 				) );
-			m_pipelineStateCache.add(hash, pipeline);
-
-			size_t dataSize;
-			VK_CHECK(vkGetPipelineCacheData(m_device, cache, &dataSize, NULL) );
 
-			if (0 < dataSize)
-			{
-				if (length < dataSize)
-				{
-					cachedData = BX_REALLOC(g_allocator, cachedData, dataSize);
-				}
+			return pipeline;
+		}
 
-				VK_CHECK(vkGetPipelineCacheData(m_device, cache, &dataSize, cachedData) );
-				g_callback->cacheWrite(hash, cachedData, (uint32_t)dataSize);
+		void savePipelineCache()
+		{
+			if (!m_pipelineCacheDirty)
+			{
+				return;
 			}
 
-			VK_CHECK(vkMergePipelineCaches(m_device, m_pipelineCache, 1, &cache) );
-			vkDestroy(cache);
+			m_pipelineCacheDirty = false;
 
-			if (NULL != cachedData)
+			size_t dataSize;
+			VK_CHECK(vkGetPipelineCacheData(m_device, m_pipelineCache, &dataSize, NULL) );
+
+			if (0 < dataSize)
 			{
+				void* cachedData = BX_ALLOC(g_allocator, dataSize);
+				VK_CHECK(vkGetPipelineCacheData(m_device, m_pipelineCache, &dataSize, cachedData) );
+				BX_TRACE("Saving pipeline cache (size %d).", uint32_t(dataSize) );
+				g_callback->cacheWrite(m_pipelineCacheKey, cachedData, uint32_t(dataSize) );
 				BX_FREE(g_allocator, cachedData);
 			}
-
-			return pipeline;
 		}
 
 		VkDescriptorSet getDescriptorSet(const ProgramVK& program, const RenderBind& renderBind, const ScratchBufferVK& scratchBuffer, const float _palette[][4])
 		{
-			VkDescriptorSet descriptorSet;
-
-			VkDescriptorSetAllocateInfo dsai;
-			dsai.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-			dsai.pNext              = NULL;
-			dsai.descriptorPool     = m_descriptorPool;
-			dsai.descriptorSetCount = 1;
-			dsai.pSetLayouts        = &program.m_descriptorSetLayout;
-
-			VK_CHECK(vkAllocateDescriptorSets(m_device, &dsai, &descriptorSet) );
-
 			VkDescriptorImageInfo  imageInfo[BGFX_CONFIG_MAX_TEXTURE_SAMPLERS];
 			VkDescriptorBufferInfo bufferInfo[BGFX_CONFIG_MAX_TEXTURE_SAMPLERS];
 
@@ -3800,6 +4182,9 @@ VK_IMPORT_DEVICE
 			uint32_t bufferCount = 0;
 			uint32_t imageCount  = 0;
 
+			uint32_t resources[BGFX_CONFIG_MAX_TEXTURE_SAMPLERS];
+			uint8_t  numResources = 0;
+
 			for (uint32_t stage = 0; stage < BGFX_CONFIG_MAX_TEXTURE_SAMPLERS; ++stage)
 			{
 				const Binding& bind = renderBind.m_bind[stage];
@@ -3816,7 +4201,7 @@ VK_IMPORT_DEVICE
 
 							wds[wdsCount].sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
 							wds[wdsCount].pNext            = NULL;
-							wds[wdsCount].dstSet           = descriptorSet;
+							wds[wdsCount].dstSet           = VK_NULL_HANDLE;
 							wds[wdsCount].dstBinding       = bindInfo.binding;
 							wds[wdsCount].dstArrayElement  = 0;
 							wds[wdsCount].descriptorCount  = 1;
@@ -3829,6 +4214,7 @@ VK_IMPORT_DEVICE
 							wds[wdsCount].pTexelBufferView = NULL;
 
 							const TextureVK& texture = m_textures[bind.m_idx];
+							resources[numResources++] = kDescriptorResourceTexture | bind.m_idx;
 
 							VkImageViewType type = texture.m_type;
 							if (UINT32_MAX != bindInfo.index)
@@ -3866,7 +4252,7 @@ VK_IMPORT_DEVICE
 						{
 							wds[wdsCount].sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
 							wds[wdsCount].pNext            = NULL;
-							wds[wdsCount].dstSet           = descriptorSet;
+							wds[wdsCount].dstSet           = VK_NULL_HANDLE;
 							wds[wdsCount].dstBinding       = bindInfo.binding;
 							wds[wdsCount].dstArrayElement  = 0;
 							wds[wdsCount].descriptorCount  = 1;
@@ -3879,6 +4265,10 @@ VK_IMPORT_DEVICE
 								? m_vertexBuffers[bind.m_idx]
 								: m_indexBuffers[bind.m_idx]
 								;
+							resources[numResources++] = (bind.m_type == Binding::VertexBuffer
+								? kDescriptorResourceVertexBuffer
+								: kDescriptorResourceIndexBuffer
+								) | bind.m_idx;
 
 							bufferInfo[bufferCount].buffer = sb.m_buffer;
 							bufferInfo[bufferCount].offset = 0;
@@ -3893,12 +4283,14 @@ VK_IMPORT_DEVICE
 					case Binding::Texture:
 						{
 							TextureVK& texture = m_textures[bind.m_idx];
+							resources[numResources++] = kDescriptorResourceTexture | bind.m_idx;
+
 							const uint32_t samplerFlags = 0 == (BGFX_SAMPLER_INTERNAL_DEFAULT & bind.m_samplerFlags)
 								? bind.m_samplerFlags
 								: (uint32_t)texture.m_flags
 								;
 							const bool sampleStencil = !!(samplerFlags & BGFX_SAMPLER_SAMPLE_STENCIL);
-							VkSampler sampler = getSampler(samplerFlags, texture.m_format, _palette);
+							VkSampler sampler = getSampler(samplerFlags, texture.m_format, _palette, texture.m_residentMip);
 
 							const VkImageViewType type = UINT32_MAX == bindInfo.index
 								? texture.m_type
@@ -3922,7 +4314,7 @@ VK_IMPORT_DEVICE
 
 							wds[wdsCount].sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
 							wds[wdsCount].pNext            = NULL;
-							wds[wdsCount].dstSet           = descriptorSet;
+							wds[wdsCount].dstSet           = VK_NULL_HANDLE;
 							wds[wdsCount].dstBinding       = bindInfo.binding;
 							wds[wdsCount].dstArrayElement  = 0;
 							wds[wdsCount].descriptorCount  = 1;
@@ -3934,7 +4326,7 @@ VK_IMPORT_DEVICE
 
 							wds[wdsCount].sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
 							wds[wdsCount].pNext            = NULL;
-							wds[wdsCount].dstSet           = descriptorSet;
+							wds[wdsCount].dstSet           = VK_NULL_HANDLE;
 							wds[wdsCount].dstBinding       = bindInfo.samplerBinding;
 							wds[wdsCount].dstArrayElement  = 0;
 							wds[wdsCount].descriptorCount  = 1;
@@ -3962,7 +4354,7 @@ VK_IMPORT_DEVICE
 
 				wds[wdsCount].sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
 				wds[wdsCount].pNext            = NULL;
-				wds[wdsCount].dstSet           = descriptorSet;
+				wds[wdsCount].dstSet           = VK_NULL_HANDLE;
 				wds[wdsCount].dstBinding       = program.m_vsh->m_uniformBinding;
 				wds[wdsCount].dstArrayElement  = 0;
 				wds[wdsCount].descriptorCount  = 1;
@@ -3982,7 +4374,7 @@ VK_IMPORT_DEVICE
 
 				wds[wdsCount].sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
 				wds[wdsCount].pNext            = NULL;
-				wds[wdsCount].dstSet           = descriptorSet;
+				wds[wdsCount].dstSet           = VK_NULL_HANDLE;
 				wds[wdsCount].dstBinding       = program.m_fsh->m_uniformBinding;
 				wds[wdsCount].dstArrayElement  = 0;
 				wds[wdsCount].descriptorCount  = 1;
@@ -3994,10 +4386,57 @@ VK_IMPORT_DEVICE
 				++bufferCount;
 			}
 
+			bx::HashMurmur2A hash;
+			hash.begin();
+			hash.add(program.m_descriptorSetLayout);
+
+			for (uint32_t ii = 0; ii < wdsCount; ++ii)
+			{
+				const VkWriteDescriptorSet& write = wds[ii];
+				hash.add(write.dstBinding);
+				hash.add(write.descriptorType);
+
+				if (NULL != write.pImageInfo)
+				{
+					hash.add(write.pImageInfo->sampler);
+					hash.add(write.pImageInfo->imageView);
+					hash.add(write.pImageInfo->imageLayout);
+				}
+
+				if (NULL != write.pBufferInfo)
+				{
+					hash.add(write.pBufferInfo->buffer);
+					hash.add(write.pBufferInfo->offset);
+					hash.add(write.pBufferInfo->range);
+				}
+			}
+
+			const uint32_t hashKey = hash.end();
+
+			VkDescriptorSet descriptorSet = m_descriptorSetCache.find(hashKey);
+
+			if (VK_NULL_HANDLE != descriptorSet)
+			{
+				return descriptorSet;
+			}
+
+			VkDescriptorSetAllocateInfo dsai;
+			dsai.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+			dsai.pNext              = NULL;
+			dsai.descriptorPool     = m_descriptorPool;
+			dsai.descriptorSetCount = 1;
+			dsai.pSetLayouts        = &program.m_descriptorSetLayout;
+
+			VK_CHECK(vkAllocateDescriptorSets(m_device, &dsai, &descriptorSet) );
+
+			for (uint32_t ii = 0; ii < wdsCount; ++ii)
+			{
+				wds[ii].dstSet = descriptorSet;
+			}
+
 			vkUpdateDescriptorSets(m_device, wdsCount, wds, 0, NULL);
 
-			VkDescriptorSet temp = descriptorSet;
-			release(temp);
+			m_descriptorSetCache.add(hashKey, descriptorSet, numResources, resources);
 
 			return descriptorSet;
 		}
@@ -4173,53 +4612,38 @@ VK_IMPORT_DEVICE
 			}
 		}
 
-		void clearQuad(const Rect& _rect, const Clear& _clear, const float _palette[][4])
+		uint32_t getClearAttachments(const FrameBufferVK& _fb, const Clear& _clear, const float _palette[][4], VkClearAttachment* _attachments)
 		{
-			VkClearRect rect[1];
-			rect[0].rect.offset.x      = _rect.m_x;
-			rect[0].rect.offset.y      = _rect.m_y;
-			rect[0].rect.extent.width  = _rect.m_width;
-			rect[0].rect.extent.height = _rect.m_height;
-			rect[0].baseArrayLayer = 0;
-			rect[0].layerCount     = 1;
-
 			uint32_t numMrt;
 			bgfx::TextureFormat::Enum mrtFormat[BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS];
 			VkImageAspectFlags depthAspectMask;
 
-			const FrameBufferVK& fb = isValid(m_fbh)
-				? m_frameBuffers[m_fbh.idx]
-				: m_backBuffer
-				;
-
-			if (NULL == fb.m_nwh)
+			if (NULL == _fb.m_nwh)
 			{
-				numMrt = fb.m_num;
-				for (uint8_t ii = 0; ii < fb.m_num; ++ii)
+				numMrt = _fb.m_num;
+				for (uint8_t ii = 0; ii < _fb.m_num; ++ii)
 				{
-					mrtFormat[ii] = bgfx::TextureFormat::Enum(m_textures[fb.m_texture[ii].idx].m_requestedFormat);
+					mrtFormat[ii] = bgfx::TextureFormat::Enum(m_textures[_fb.m_texture[ii].idx].m_requestedFormat);
 				}
-				depthAspectMask = isValid(fb.m_depth) ? m_textures[fb.m_depth.idx].m_aspectMask : 0;
-				rect[0].layerCount = fb.m_attachment[0].numLayers;
+				depthAspectMask = isValid(_fb.m_depth) ? m_textures[_fb.m_depth.idx].m_aspectMask : 0;
 			}
 			else
 			{
 				numMrt = 1;
-				mrtFormat[0] = fb.m_swapChain.m_colorFormat;
-				depthAspectMask = fb.m_swapChain.m_backBufferDepthStencil.m_aspectMask;
+				mrtFormat[0] = _fb.m_swapChain.m_colorFormat;
+				depthAspectMask = _fb.m_swapChain.m_backBufferDepthStencil.m_aspectMask;
 			}
 
-			VkClearAttachment attachments[BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS + 1];
 			uint32_t mrt = 0;
 
 			if (BGFX_CLEAR_COLOR & _clear.m_flags)
 			{
 				for (uint32_t ii = 0; ii < numMrt; ++ii)
 				{
-					attachments[mrt].colorAttachment = mrt;
-					attachments[mrt].aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+					_attachments[mrt].colorAttachment = mrt;
+					_attachments[mrt].aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
 
-					VkClearColorValue& clearValue = attachments[mrt].clearValue.color;
+					VkClearColorValue& clearValue = _attachments[mrt].clearValue.color;
 
 					const bimg::ImageBlockInfo& blockInfo = bimg::getBlockInfo(bimg::TextureFormat::Enum(mrtFormat[ii]) );
 					const bx::EncodingType::Enum type = bx::EncodingType::Enum(blockInfo.encoding);
@@ -4270,25 +4694,247 @@ VK_IMPORT_DEVICE
 
 			if (0 != depthAspectMask)
 			{
-				attachments[mrt].aspectMask = depthAspectMask;
-				attachments[mrt].clearValue.depthStencil.stencil = _clear.m_stencil;
-				attachments[mrt].clearValue.depthStencil.depth   = _clear.m_depth;
+				_attachments[mrt].colorAttachment = VK_ATTACHMENT_UNUSED;
+				_attachments[mrt].aspectMask = depthAspectMask;
+				_attachments[mrt].clearValue.depthStencil.stencil = _clear.m_stencil;
+				_attachments[mrt].clearValue.depthStencil.depth   = _clear.m_depth;
 				++mrt;
 			}
 
-			if (mrt > 0)
+			return mrt;
+		}
+
+		uint32_t getClearValues(const FrameBufferVK& _fb, const Clear& _clear, const float _palette[][4], VkClearValue* _values)
+		{
+			VkClearAttachment attachments[BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS + 1];
+			const uint32_t num = getClearAttachments(_fb, _clear, _palette, attachments);
+
+			// Clear values are indexed by frame buffer attachment, not by color attachment.
+			const uint32_t numValues = NULL == _fb.m_nwh ? _fb.m_numTh : 2;
+			bx::memSet(_values, 0, numValues * sizeof(VkClearValue) );
+
+			uint32_t color = 0;
+			for (uint32_t ii = 0; ii < numValues; ++ii)
+			{
+				const bool isColor = NULL == _fb.m_nwh
+					? 0 != (m_textures[_fb.m_attachment[ii].handle.idx].m_aspectMask & VK_IMAGE_ASPECT_COLOR_BIT)
+					: 0 == ii
+					;
+
+				for (uint32_t jj = 0; jj < num; ++jj)
+				{
+					const VkClearAttachment& attachment = attachments[jj];
+
+					if (isColor
+						? (VK_IMAGE_ASPECT_COLOR_BIT == attachment.aspectMask && color == attachment.colorAttachment)
+						: (VK_IMAGE_ASPECT_COLOR_BIT != attachment.aspectMask)
+						)
+					{
+						_values[ii] = attachment.clearValue;
+						break;
+					}
+				}
+
+				color += isColor;
+			}
+
+			return numValues;
+		}
+
+		void clearQuad(const Rect& _rect, const Clear& _clear, const float _palette[][4])
+		{
+			const FrameBufferVK& fb = isValid(m_fbh)
+				? m_frameBuffers[m_fbh.idx]
+				: m_backBuffer
+				;
+
+			VkClearRect rect;
+			rect.rect.offset.x      = _rect.m_x;
+			rect.rect.offset.y      = _rect.m_y;
+			rect.rect.extent.width  = _rect.m_width;
+			rect.rect.extent.height = _rect.m_height;
+			rect.baseArrayLayer = 0;
+			rect.layerCount     = NULL == fb.m_nwh ? fb.m_attachment[0].numLayers : 1;
+
+			VkClearAttachment attachments[BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS + 1];
+			const uint32_t num = getClearAttachments(fb, _clear, _palette, attachments);
+
+			if (num > 0)
+			{
+				vkCmdClearAttachments(m_commandBuffer, num, attachments, 1, &rect);
+			}
+		}
+
+		uint16_t startRenderPass(const FrameBufferVK& _fb, const Rect& _rect, const Clear& _clear, uint16_t _clearFlags, uint16_t _discardFlags, const float _palette[][4])
+		{
+			VkClearValue clearValues[BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS * 2];
+
+			VkRenderPassBeginInfo rpbi;
+			rpbi.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+			rpbi.pNext = NULL;
+			rpbi.renderPass  = _fb.m_renderPass;
+			rpbi.framebuffer = _fb.m_currentFramebuffer;
+			rpbi.renderArea.offset.x = _rect.m_x;
+			rpbi.renderArea.offset.y = _rect.m_y;
+			rpbi.renderArea.extent.width  = _rect.m_width;
+			rpbi.renderArea.extent.height = _rect.m_height;
+			rpbi.clearValueCount = 0;
+			rpbi.pClearValues    = NULL;
+
+			if (VK_SUCCESS != _fb.getRenderPass(_clearFlags, _discardFlags, &rpbi.renderPass) )
+			{
+				rpbi.renderPass = _fb.m_renderPass;
+				_clearFlags = BGFX_CLEAR_NONE;
+			}
+			else if (BGFX_CLEAR_NONE != _clearFlags)
+			{
+				rpbi.clearValueCount = getClearValues(_fb, _clear, _palette, clearValues);
+				rpbi.pClearValues    = clearValues;
+			}
+
+			vkCmdBeginRenderPass(m_commandBuffer, &rpbi, VK_SUBPASS_CONTENTS_INLINE);
+
+			return _clearFlags;
+		}
+
+		void planRenderPasses(const Frame* _render)
+		{
+			bool hasCompute[BGFX_CONFIG_MAX_VIEWS] = {};
+			ViewId order[BGFX_CONFIG_MAX_VIEWS];
+			uint32_t numViews = 0;
+
+			for (uint32_t ii = 0, num = _render->m_numRenderItems; ii < num; ++ii)
+			{
+				const uint64_t key = _render->m_sortKeys[ii];
+				const ViewId view  = _render->m_viewRemap[SortKey::decodeView(key)];
+
+				if (0 == numViews
+				||  order[numViews-1] != view)
+				{
+					order[numViews++] = view;
+				}
+
+				hasCompute[view] |= 0 == (key & kSortKeyDrawBit);
+			}
+
+			// Per view GPU timing needs render pass boundaries at each view.
+			const bool merge = 0 == (_render->m_debug & BGFX_DEBUG_PROFILER);
+
+			BlitState bs(_render);
+
+			for (uint32_t ii = 0; ii < numViews; ++ii)
+			{
+				const ViewId view = order[ii];
+				const View& rv    = _render->m_view[view];
+
+				// Blits and compute can't be recorded inside render pass. Same as submit, blits
+				// of views without render items are executed by the next view.
+				bool hasBlit = false;
+				while (bs.hasItem(view) )
+				{
+					bs.advance();
+					hasBlit = true;
+				}
+
+				RenderPassPlanVK& plan = m_renderPassPlan[view];
+				plan.m_rect            = rv.m_rect;
+				plan.m_clearFlags      = BGFX_CLEAR_NONE;
+				plan.m_discardFlags    = BGFX_CLEAR_NONE;
+				plan.m_standaloneClear = hasCompute[view] || hasBlit;
+				plan.m_merge           = true
+					&& merge
+					&& 0 < ii
+					&& !plan.m_standaloneClear
+					&& rv.m_fbh.idx == _render->m_view[order[ii-1] ].m_fbh.idx
+					;
+			}
+
+			for (uint32_t ii = 0; ii < numViews;)
 			{
-				vkCmdClearAttachments(m_commandBuffer, mrt, attachments, BX_COUNTOF(rect), rect);
+				RenderPassPlanVK& head = m_renderPassPlan[order[ii] ];
+
+				uint32_t last = ii;
+				for (uint32_t jj = ii + 1; jj < numViews && m_renderPassPlan[order[jj] ].m_merge; ++jj)
+				{
+					const Rect& rect = m_renderPassPlan[order[jj] ].m_rect;
+					const uint16_t x0 = bx::min(head.m_rect.m_x, rect.m_x);
+					const uint16_t y0 = bx::min(head.m_rect.m_y, rect.m_y);
+					const uint16_t x1 = bx::max<uint16_t>(head.m_rect.m_x + head.m_rect.m_width,  rect.m_x + rect.m_width);
+					const uint16_t y1 = bx::max<uint16_t>(head.m_rect.m_y + head.m_rect.m_height, rect.m_y + rect.m_height);
+					head.m_rect.set(x0, y0, uint16_t(x1 - x0), uint16_t(y1 - y0) );
+					last = jj;
+				}
+
+				// Clear of the first view can be done by load op only if it covers whole render area.
+				const View& firstView = _render->m_view[order[ii] ];
+				const uint16_t clearFlags = firstView.m_clear.m_flags & (BGFX_CLEAR_COLOR|BGFX_CLEAR_DEPTH|BGFX_CLEAR_STENCIL);
+
+				Rect clearRect = firstView.m_rect;
+				if (!firstView.m_scissor.isZero() )
+				{
+					clearRect.setIntersect(firstView.m_rect, firstView.m_scissor);
+				}
+
+				if (BGFX_CLEAR_NONE != clearFlags
+				&&  clearRect.m_x      == head.m_rect.m_x
+				&&  clearRect.m_y      == head.m_rect.m_y
+				&&  clearRect.m_width  == head.m_rect.m_width
+				&&  clearRect.m_height == head.m_rect.m_height)
+				{
+					head.m_clearFlags = clearFlags;
+				}
+
+				// Discard of the last view is applied only when frame buffer changes after it.
+				const View& lastView = _render->m_view[order[last] ];
+				if (last + 1 == numViews
+				||  lastView.m_fbh.idx != _render->m_view[order[last + 1] ].m_fbh.idx)
+				{
+					head.m_discardFlags = lastView.m_clear.m_flags & BGFX_CLEAR_DISCARD_MASK;
+				}
+
+				ii = last + 1;
 			}
 		}
 
 		void kick(bool _finishAll = false)
 		{
+			flushUploads();
+
 			m_cmd.kick(_finishAll);
 			VK_CHECK(m_cmd.alloc(&m_commandBuffer) );
+			m_stagingRing.reset(m_cmd.m_currentFrameInFlight);
 			m_cmd.finish(_finishAll);
 		}
 
+		StagingAllocationVK allocStaging(uint32_t _size, uint32_t _align)
+		{
+			StagingAllocationVK staging;
+
+			if (!m_stagingRing.alloc(_size, _align, staging) )
+			{
+				staging.m_offset = 0;
+				VK_CHECK(createStagingBuffer(_size, &staging.m_buffer, &staging.m_memory) );
+				VK_CHECK(vkMapMemory(m_device, staging.m_memory, 0, _size, 0, (void**)&staging.m_data) );
+			}
+
+			return staging;
+		}
+
+		void releaseStaging(StagingAllocationVK& _staging)
+		{
+			if (VK_NULL_HANDLE != _staging.m_memory)
+			{
+				vkUnmapMemory(m_device, _staging.m_memory);
+				release(_staging.m_buffer);
+				release(_staging.m_memory);
+			}
+		}
+
+		void flushUploads()
+		{
+			m_uploadBatch.flush(m_commandBuffer);
+		}
+
 		int32_t selectMemoryType(uint32_t _memoryTypeBits, uint32_t _propertyFlags, int32_t _startIndex = 0) const
 		{
 			for (int32_t ii = _startIndex, num = m_memoryProperties.memoryTypeCount; ii < num; ++ii)
@@ -4331,6 +4977,82 @@ VK_IMPORT_DEVICE
 			return result;
 		}
 
+		// Returns true when driver prefers, or requires, buffer to have its own device memory allocation.
+		bool getBufferMemoryRequirements(::VkBuffer _buffer, VkMemoryRequirements* _requirements) const
+		{
+			if (!m_dedicatedAllocationSupport)
+			{
+				vkGetBufferMemoryRequirements(m_device, _buffer, _requirements);
+				return false;
+			}
+
+			VkBufferMemoryRequirementsInfo2KHR bmri;
+			bmri.sType  = VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2_KHR;
+			bmri.pNext  = NULL;
+			bmri.buffer = _buffer;
+
+			VkMemoryDedicatedRequirementsKHR mdr;
+			mdr.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS_KHR;
+			mdr.pNext = NULL;
+
+			VkMemoryRequirements2KHR mr;
+			mr.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2_KHR;
+			mr.pNext = &mdr;
+
+			vkGetBufferMemoryRequirements2KHR(m_device, &bmri, &mr);
+			*_requirements = mr.memoryRequirements;
+
+			return mdr.prefersDedicatedAllocation || mdr.requiresDedicatedAllocation;
+		}
+
+		// Returns true when driver prefers, or requires, image to have its own device memory allocation.
+		bool getImageMemoryRequirements(::VkImage _image, VkMemoryRequirements* _requirements) const
+		{
+			if (!m_dedicatedAllocationSupport)
+			{
+				vkGetImageMemoryRequirements(m_device, _image, _requirements);
+				return false;
+			}
+
+			VkImageMemoryRequirementsInfo2KHR imri;
+			imri.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2_KHR;
+			imri.pNext = NULL;
+			imri.image = _image;
+
+			VkMemoryDedicatedRequirementsKHR mdr;
+			mdr.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS_KHR;
+			mdr.pNext = NULL;
+
+			VkMemoryRequirements2KHR mr;
+			mr.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2_KHR;
+			mr.pNext = &mdr;
+
+			vkGetImageMemoryRequirements2KHR(m_device, &imri, &mr);
+			*_requirements = mr.memoryRequirements;
+
+			return mdr.prefersDedicatedAllocation || mdr.requiresDedicatedAllocation;
+		}
+
+		VkResult allocateMemory(const VkMemoryRequirements* requirements, VkMemoryPropertyFlags propertyFlags, DeviceMemoryAllocationVK* memory, bool image, const VkMemoryDedicatedAllocateInfoKHR* dedicated = NULL)
+		{
+			VkResult result = VK_ERROR_UNKNOWN;
+			int32_t searchIndex = -1;
+			do
+			{
+				searchIndex++;
+				searchIndex = selectMemoryType(requirements->memoryTypeBits, propertyFlags, searchIndex);
+
+				if (searchIndex >= 0)
+				{
+					result = m_memoryAllocator.alloc(*requirements, searchIndex, image, dedicated, *memory);
+				}
+			}
+			while (result != VK_SUCCESS
+			   &&  searchIndex >= 0);
+
+			return result;
+		}
+
 		VkResult createHostBuffer(uint32_t _size, VkMemoryPropertyFlags _flags, ::VkBuffer* _buffer, ::VkDeviceMemory* _memory, const void* _data = NULL)
 		{
 			VkResult result = VK_SUCCESS;
@@ -4424,6 +5146,8 @@ VK_IMPORT_DEVICE
 
 		bool m_lineAASupport;
 		bool m_borderColorSupport;
+		bool m_timelineSemaphoreSupport;
+		bool m_dedicatedAllocationSupport;
 		bool m_timerQuerySupport;
 
 		FrameBufferVK m_backBuffer;
@@ -4434,9 +5158,21 @@ VK_IMPORT_DEVICE
 		int64_t m_presentElapsed;
 
 		ScratchBufferVK m_scratchBuffer[BGFX_CONFIG_MAX_FRAME_LATENCY];
+		StagingRingVK   m_stagingRing;
+		UploadBatchVK   m_uploadBatch;
+		BarrierBatchVK  m_barrierBatch;
 
 		uint32_t        m_numFramesInFlight;
 		CommandQueueVK  m_cmd;
+
+		struct SubmittedFrame
+		{
+			uint32_t m_frameNum;
+			uint64_t m_submitted;
+		};
+
+		SubmittedFrame  m_submittedFrame[BGFX_CONFIG_MAX_FRAME_LATENCY + 1];
+		uint32_t        m_numSubmittedFrames;
 		VkCommandBuffer m_commandBuffer;
 
 		VkDevice m_device;
@@ -4444,6 +5180,9 @@ VK_IMPORT_DEVICE
 		VkQueue  m_globalQueue;
 		VkDescriptorPool m_descriptorPool;
 		VkPipelineCache  m_pipelineCache;
+		uint64_t         m_pipelineCacheKey;
+		uint32_t         m_pipelineCacheIdleFrames;
+		bool             m_pipelineCacheDirty;
 
 		TimerQueryVK m_gpuTimer;
 		OcclusionQueryVK m_occlusionQuery;
@@ -4464,11 +5203,18 @@ VK_IMPORT_DEVICE
 		UniformRegistry m_uniformReg;
 
 		StateCacheT<VkPipeline> m_pipelineStateCache;
+		DescriptorSetCacheVK    m_descriptorSetCache;
+		PipelinePrecacheVK      m_pipelinePrecache;
+		PresentThreadVK         m_presentThread;
+		RenderPassPlanVK        m_renderPassPlan[BGFX_CONFIG_MAX_VIEWS];
+		MemoryAllocatorVK       m_memoryAllocator;
+		uint32_t                m_numPipelinesCreated;
+		uint32_t                m_numPipelinesPrecached;
 		StateCacheT<VkDescriptorSetLayout> m_descriptorSetLayoutCache;
 		StateCacheT<VkRenderPass> m_renderPassCache;
 		StateCacheT<VkSampler> m_samplerCache;
 		StateCacheT<uint32_t> m_samplerBorderColorCache;
-		StateCacheLru<VkImageView, 1024> m_imageViewCache;
+		StateCacheLru<VkImageView, kImageViewCacheSize> m_imageViewCache;
 
 		Resolution m_resolution;
 		float m_maxAnisotropy;
@@ -4565,6 +5311,287 @@ VK_DESTROY
 		s_renderVK->release(_obj);
 	}
 
+	void MemoryAllocatorVK::init(VkDeviceSize _blockSize, VkDeviceSize _dedicatedSize)
+	{
+		m_blockSize     = _blockSize;
+		m_dedicatedSize = bx::min(_dedicatedSize, _blockSize);
+
+		m_numAllocations = 0;
+		m_numDedicated   = 0;
+		m_allocated      = 0;
+		m_used           = 0;
+	}
+
+	void MemoryAllocatorVK::shutdown()
+	{
+		BX_WARN(0 == m_numAllocations && 0 == m_numDedicated
+			, "Device memory leak: %d sub-allocations, %d dedicated allocations."
+			, m_numAllocations
+			, m_numDedicated
+			);
+
+		for (uint32_t ii = 0, num = uint32_t(m_block.size() ); ii < num; ++ii)
+		{
+			vkDestroy(m_block[ii].m_memory);
+		}
+
+		m_block.clear();
+
+		m_numAllocations = 0;
+		m_numDedicated   = 0;
+		m_allocated      = 0;
+		m_used           = 0;
+	}
+
+	bool MemoryAllocatorVK::allocFromBlock(Block& _block, VkDeviceSize _size, VkDeviceSize _alignment, VkDeviceSize& _offset)
+	{
+		for (uint32_t ii = 0, num = uint32_t(_block.m_free.size() ); ii < num; ++ii)
+		{
+			Range& range = _block.m_free[ii];
+
+			// Vulkan alignment is always power of two, align in 64-bit since alignment
+			// of large images can't be represented with int32_t.
+			const VkDeviceSize offset = (range.m_offset + _alignment - 1) & ~(_alignment - 1);
+			const VkDeviceSize end    = range.m_offset + range.m_size;
+
+			if (offset + _size > end)
+			{
+				continue;
+			}
+
+			const VkDeviceSize head = offset - range.m_offset;
+			const VkDeviceSize tail = end - (offset + _size);
+
+			if (0 == head)
+			{
+				if (0 == tail)
+				{
+					_block.m_free.erase(_block.m_free.begin() + ii);
+				}
+				else
+				{
+					range.m_offset = offset + _size;
+					range.m_size   = tail;
+				}
+			}
+			else
+			{
+				range.m_size = head;
+
+				if (0 != tail)
+				{
+					Range rest;
+					rest.m_offset = offset + _size;
+					rest.m_size   = tail;
+					_block.m_free.insert(_block.m_free.begin() + ii + 1, rest);
+				}
+			}
+
+			_offset = offset;
+			return true;
+		}
+
+		return false;
+	}
+
+	VkResult MemoryAllocatorVK::alloc(const VkMemoryRequirements& _requirements, uint32_t _memoryTypeIndex, bool _image, const VkMemoryDedicatedAllocateInfoKHR* _dedicated, DeviceMemoryAllocationVK& _allocation)
+	{
+		const VkDevice device = s_renderVK->m_device;
+		const VkAllocationCallbacks* allocatorCb = s_renderVK->m_allocatorCb;
+
+		VkMemoryAllocateInfo ma;
+		ma.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		ma.pNext = NULL;
+		ma.memoryTypeIndex = _memoryTypeIndex;
+
+		VkResult result = VK_SUCCESS;
+
+		if (NULL != _dedicated
+		||  _requirements.size >= m_dedicatedSize)
+		{
+			ma.pNext = _dedicated;
+			ma.allocationSize = _requirements.size;
+			result = vkAllocateMemory(device, &ma, allocatorCb, &_allocation.m_memory);
+
+			if (VK_SUCCESS == result)
+			{
+				_allocation.m_offset = 0;
+				_allocation.m_size   = _requirements.size;
+				_allocation.m_block  = UINT32_MAX;
+
+				++m_numDedicated;
+				m_allocated += int64_t(_requirements.size);
+				m_used      += int64_t(_requirements.size);
+			}
+
+			return result;
+		}
+
+		const VkDeviceSize alignment = bx::max<VkDeviceSize>(1, _requirements.alignment);
+
+		uint32_t freeSlot = UINT32_MAX;
+
+		for (uint32_t ii = 0, num = uint32_t(m_block.size() ); ii < num; ++ii)
+		{
+			Block& block = m_block[ii];
+
+			if (VK_NULL_HANDLE == block.m_memory)
+			{
+				freeSlot = bx::min(freeSlot, ii);
+				continue;
+			}
+
+			VkDeviceSize offset;
+			if (block.m_memoryTypeIndex == _memoryTypeIndex
+			&&  block.m_image == _image
+			&&  allocFromBlock(block, _requirements.size, alignment, offset) )
+			{
+				++block.m_numAllocations;
+
+				_allocation.m_memory = block.m_memory;
+				_allocation.m_offset = offset;
+				_allocation.m_size   = _requirements.size;
+				_allocation.m_block  = ii;
+
+				++m_numAllocations;
+				m_used += int64_t(_requirements.size);
+				return VK_SUCCESS;
+			}
+		}
+
+		ma.allocationSize = m_blockSize;
+
+		::VkDeviceMemory memory;
+		result = vkAllocateMemory(device, &ma, allocatorCb, &memory);
+
+		if (VK_SUCCESS != result)
+		{
+			return result;
+		}
+
+		if (UINT32_MAX == freeSlot)
+		{
+			freeSlot = uint32_t(m_block.size() );
+			m_block.push_back(Block() );
+		}
+
+		Block& block = m_block[freeSlot];
+		block.m_memory          = memory;
+		block.m_size            = m_blockSize;
+		block.m_memoryTypeIndex = _memoryTypeIndex;
+		block.m_numAllocations  = 1;
+		block.m_image           = _image;
+		block.m_free.clear();
+
+		if (_requirements.size < m_blockSize)
+		{
+			Range range;
+			range.m_offset = _requirements.size;
+			range.m_size   = m_blockSize - _requirements.size;
+			block.m_free.push_back(range);
+		}
+
+		_allocation.m_memory = memory;
+		_allocation.m_offset = 0;
+		_allocation.m_size   = _requirements.size;
+		_allocation.m_block  = freeSlot;
+
+		++m_numAllocations;
+		m_allocated += int64_t(m_blockSize);
+		m_used      += int64_t(_requirements.size);
+
+		return VK_SUCCESS;
+	}
+
+	void MemoryAllocatorVK::free(const DeviceMemoryAllocationVK& _allocation)
+	{
+		if (VK_NULL_HANDLE == _allocation.m_memory)
+		{
+			return;
+		}
+
+		m_used -= int64_t(_allocation.m_size);
+
+		if (UINT32_MAX == _allocation.m_block)
+		{
+			VkDeviceMemory memory = _allocation.m_memory;
+			vkDestroy(memory);
+
+			--m_numDedicated;
+			m_allocated -= int64_t(_allocation.m_size);
+			return;
+		}
+
+		Block& block = m_block[_allocation.m_block];
+		BX_ASSERT(block.m_memory == _allocation.m_memory, "Freeing allocation from wrong device memory block.");
+
+		--m_numAllocations;
+		--block.m_numAllocations;
+
+		RangeArray& ranges = block.m_free;
+
+		uint32_t idx = 0;
+		for (uint32_t num = uint32_t(ranges.size() ); idx < num && ranges[idx].m_offset < _allocation.m_offset; ++idx)
+		{
+		}
+
+		Range range;
+		range.m_offset = _allocation.m_offset;
+		range.m_size   = _allocation.m_size;
+		ranges.insert(ranges.begin() + idx, range);
+
+		if (idx + 1 < ranges.size()
+		&&  ranges[idx].m_offset + ranges[idx].m_size == ranges[idx + 1].m_offset)
+		{
+			ranges[idx].m_size += ranges[idx + 1].m_size;
+			ranges.erase(ranges.begin() + idx + 1);
+		}
+
+		if (0 < idx
+		&&  ranges[idx - 1].m_offset + ranges[idx - 1].m_size == ranges[idx].m_offset)
+		{
+			ranges[idx - 1].m_size += ranges[idx].m_size;
+			ranges.erase(ranges.begin() + idx);
+		}
+
+		if (0 == block.m_numAllocations)
+		{
+			// Keep one empty block per memory type around to avoid allocation
+			// thrashing when resource is destroyed and created every frame.
+			bool hasEmpty = false;
+			for (uint32_t ii = 0, num = uint32_t(m_block.size() ); ii < num && !hasEmpty; ++ii)
+			{
+				const Block& other = m_block[ii];
+				hasEmpty = true
+					&& ii != _allocation.m_block
+					&& VK_NULL_HANDLE != other.m_memory
+					&& 0 == other.m_numAllocations
+					&& other.m_memoryTypeIndex == block.m_memoryTypeIndex
+					&& other.m_image == block.m_image
+					;
+			}
+
+			if (hasEmpty)
+			{
+				vkDestroy(block.m_memory);
+				block.m_free.clear();
+				m_allocated -= int64_t(block.m_size);
+			}
+		}
+	}
+
+	uint32_t MemoryAllocatorVK::getNumBlocks() const
+	{
+		uint32_t numBlocks = 0;
+
+		for (uint32_t ii = 0, num = uint32_t(m_block.size() ); ii < num; ++ii)
+		{
+			numBlocks += VK_NULL_HANDLE != m_block[ii].m_memory;
+		}
+
+		return numBlocks;
+	}
+
 	void ScratchBufferVK::create(uint32_t _size, uint32_t _count)
 	{
 		const VkAllocationCallbacks* allocatorCb = s_renderVK->m_allocatorCb;
@@ -4616,19 +5643,94 @@ VK_DESTROY
 		VK_CHECK(vkMapMemory(device, m_deviceMem, 0, m_size, 0, (void**)&m_data) );
 	}
 
-	void ScratchBufferVK::destroy()
-	{
-		reset();
+	void ScratchBufferVK::destroy()
+	{
+		reset();
+
+		vkUnmapMemory(s_renderVK->m_device, m_deviceMem);
+
+		s_renderVK->release(m_buffer);
+		s_renderVK->release(m_deviceMem);
+	}
+
+	void ScratchBufferVK::reset()
+	{
+		m_pos = 0;
+	}
+
+	VkResult StagingRingVK::create(uint32_t _size, uint32_t _numFramesInFlight)
+	{
+		m_regionSize = bx::strideAlign(_size / bx::max<uint32_t>(1, _numFramesInFlight), 256);
+		m_begin      = 0;
+		m_pos        = 0;
+
+		const uint32_t totalSize = m_regionSize * bx::max<uint32_t>(1, _numFramesInFlight);
+
+		VkResult result = s_renderVK->createStagingBuffer(totalSize, &m_buffer, &m_deviceMem);
+
+		if (VK_SUCCESS != result)
+		{
+			BX_TRACE("Create staging ring error: createStagingBuffer failed %d: %s.", result, getName(result) );
+			destroy();
+			return result;
+		}
+
+		result = vkMapMemory(s_renderVK->m_device, m_deviceMem, 0, totalSize, 0, (void**)&m_data);
+
+		if (VK_SUCCESS != result)
+		{
+			BX_TRACE("Create staging ring error: vkMapMemory failed %d: %s.", result, getName(result) );
+			destroy();
+			return result;
+		}
+
+		return result;
+	}
+
+	void StagingRingVK::destroy()
+	{
+		if (NULL != m_data)
+		{
+			vkUnmapMemory(s_renderVK->m_device, m_deviceMem);
+			m_data = NULL;
+		}
+
+		vkDestroy(m_buffer);
+		vkDestroy(m_deviceMem);
+
+		m_regionSize = 0;
+		m_begin      = 0;
+		m_pos        = 0;
+	}
+
+	void StagingRingVK::reset(uint32_t _frameInFlight)
+	{
+		m_begin = _frameInFlight * m_regionSize;
+		m_pos   = m_begin;
+	}
+
+	bool StagingRingVK::alloc(uint32_t _size, uint32_t _align, StagingAllocationVK& _staging)
+	{
+		if (NULL == m_data)
+		{
+			return false;
+		}
+
+		const uint32_t offset = bx::strideAlign(m_pos, _align);
+
+		if (offset + _size > m_begin + m_regionSize)
+		{
+			return false;
+		}
 
-		vkUnmapMemory(s_renderVK->m_device, m_deviceMem);
+		m_pos = offset + _size;
 
-		s_renderVK->release(m_buffer);
-		s_renderVK->release(m_deviceMem);
-	}
+		_staging.m_buffer = m_buffer;
+		_staging.m_memory = VK_NULL_HANDLE;
+		_staging.m_offset = offset;
+		_staging.m_data   = &m_data[offset];
 
-	void ScratchBufferVK::reset()
-	{
-		m_pos = 0;
+		return true;
 	}
 
 	uint32_t ScratchBufferVK::write(const void* _data, uint32_t _size)
@@ -4699,11 +5801,17 @@ VK_DESTROY
 		VK_CHECK(vkCreateBuffer(device, &bci, allocatorCb, &m_buffer) );
 
 		VkMemoryRequirements mr;
-		vkGetBufferMemoryRequirements(device, m_buffer, &mr);
+		const bool dedicated = s_renderVK->getBufferMemoryRequirements(m_buffer, &mr);
 
-		VK_CHECK(s_renderVK->allocateMemory(&mr, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &m_deviceMem) );
+		VkMemoryDedicatedAllocateInfoKHR mdai;
+		mdai.sType  = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO_KHR;
+		mdai.pNext  = NULL;
+		mdai.image  = VK_NULL_HANDLE;
+		mdai.buffer = m_buffer;
 
-		VK_CHECK(vkBindBufferMemory(device, m_buffer, m_deviceMem, 0) );
+		VK_CHECK(s_renderVK->allocateMemory(&mr, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &m_deviceMem, false, dedicated ? &mdai : NULL) );
+
+		VK_CHECK(vkBindBufferMemory(device, m_buffer, m_deviceMem.m_memory, m_deviceMem.m_offset) );
 
 		if (!m_dynamic)
 		{
@@ -4715,24 +5823,16 @@ VK_DESTROY
 	{
 		BX_UNUSED(_discard);
 
-		VkBuffer stagingBuffer;
-		VkDeviceMemory stagingMem;
-		VK_CHECK(s_renderVK->createStagingBuffer(_size, &stagingBuffer, &stagingMem, _data) );
+		StagingAllocationVK staging = s_renderVK->allocStaging(_size, 16);
+		bx::memCopy(staging.m_data, _data, _size);
 
 		VkBufferCopy region;
-		region.srcOffset = 0;
+		region.srcOffset = staging.m_offset;
 		region.dstOffset = _offset;
 		region.size      = _size;
-		vkCmdCopyBuffer(_commandBuffer, stagingBuffer, m_buffer, 1, &region);
+		s_renderVK->m_uploadBatch.uploadBuffer(_commandBuffer, staging.m_buffer, m_buffer, region);
 
-		setMemoryBarrier(
-			  _commandBuffer
-			, VK_PIPELINE_STAGE_TRANSFER_BIT
-			, VK_PIPELINE_STAGE_TRANSFER_BIT
-			);
-
-		s_renderVK->release(stagingBuffer);
-		s_renderVK->release(stagingMem);
+		s_renderVK->releaseStaging(staging);
 	}
 
 	void BufferVK::destroy()
@@ -5044,6 +6144,37 @@ VK_DESTROY
 
 		bx::read(&reader, m_size, &err);
 
+		m_numSpecializationConstants = 0;
+
+		if (0 < reader.remaining() )
+		{
+			uint8_t numConstants;
+			bx::read(&reader, numConstants, &err);
+
+			for (uint8_t ii = 0; ii < numConstants; ++ii)
+			{
+				uint8_t nameSize = 0;
+				bx::read(&reader, nameSize, &err);
+
+				char name[256];
+				bx::read(&reader, &name, nameSize, &err);
+				name[nameSize] = '\0';
+
+				uint32_t id;
+				bx::read(&reader, id, &err);
+
+				uint32_t value;
+				bx::read(&reader, value, &err);
+
+				BX_TRACE("\tspecialization constant: %s, id %3d, default 0x%08x", name, id, value);
+
+				if (m_numSpecializationConstants < BX_COUNTOF(m_specializationConstantId) )
+				{
+					m_specializationConstantId[m_numSpecializationConstants++] = id;
+				}
+			}
+		}
+
 		// fill binding description with uniform information
 		uint16_t bidx = 0;
 		if (m_size > 0)
@@ -5130,7 +6261,23 @@ VK_DESTROY
 		}
 	}
 
-	void ProgramVK::create(const ShaderVK* _vsh, const ShaderVK* _fsh)
+	static bool hasSpecializationConstant(const ShaderVK* _shader, uint32_t _id)
+	{
+		if (NULL != _shader)
+		{
+			for (uint8_t ii = 0; ii < _shader->m_numSpecializationConstants; ++ii)
+			{
+				if (_id == _shader->m_specializationConstantId[ii])
+				{
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+
+	void ProgramVK::create(const ShaderVK* _vsh, const ShaderVK* _fsh, uint8_t _numConstants, const SpecializationConstant* _constants)
 	{
 		BX_ASSERT(NULL != _vsh->m_code, "Vertex shader doesn't exist.");
 		m_vsh = _vsh;
@@ -5153,6 +6300,56 @@ VK_DESTROY
 			m_numPredefined += _fsh->m_numPredefined;
 		}
 
+		const uint8_t num = bx::min<uint8_t>(_numConstants, BGFX_CONFIG_MAX_SPECIALIZATION_CONSTANTS);
+		uint8_t numConstants = 0;
+
+		for (uint8_t ii = 0; ii < num; ++ii)
+		{
+			const SpecializationConstant& constant = _constants[ii];
+
+			BX_WARN(false
+				|| hasSpecializationConstant(_vsh, constant.id)
+				|| hasSpecializationConstant(_fsh, constant.id)
+				, "Specialization constant id %d is not declared by program shaders, value is ignored."
+				, constant.id
+				);
+
+			// Map entries must have unique constant ids, last value set wins.
+			uint8_t idx = 0;
+			while (idx < numConstants
+			&&     m_specializationEntry[idx].constantID != constant.id)
+			{
+				++idx;
+			}
+
+			BX_WARN(idx == numConstants, "Specialization constant id %d is set more than once.", constant.id);
+
+			if (idx == numConstants)
+			{
+				VkSpecializationMapEntry& entry = m_specializationEntry[numConstants++];
+				entry.constantID = constant.id;
+				entry.offset     = idx * sizeof(uint32_t);
+				entry.size       = sizeof(uint32_t);
+			}
+
+			m_specializationData[idx] = constant.value;
+		}
+
+		bx::HashMurmur2A murmur;
+		murmur.begin();
+
+		for (uint8_t ii = 0; ii < numConstants; ++ii)
+		{
+			murmur.add(m_specializationEntry[ii].constantID);
+			murmur.add(m_specializationData[ii]);
+		}
+
+		m_specializationInfo.mapEntryCount = numConstants;
+		m_specializationInfo.pMapEntries   = m_specializationEntry;
+		m_specializationInfo.dataSize      = numConstants * sizeof(uint32_t);
+		m_specializationInfo.pData         = m_specializationData;
+		m_specializationHash = 0 == numConstants ? 0 : murmur.end();
+
 		m_numTextures = 0;
 
 		for (uint8_t stage = 0; stage < BX_COUNTOF(m_bindInfo); ++stage)
@@ -5289,6 +6486,8 @@ VK_DESTROY
 	{
 		s_renderVK->release(m_pipelineLayout);
 		m_numPredefined = 0;
+		m_specializationInfo.mapEntryCount = 0;
+		m_specializationHash = 0;
 		m_vsh = NULL;
 		m_fsh = NULL;
 	}
@@ -5505,18 +6704,14 @@ VK_DESTROY
 	{
 		m_control.reserve(1);
 
-		const VkCommandBuffer commandBuffer = s_renderVK->m_commandBuffer;
-
 		m_handle[m_control.m_current] = _handle;
-		vkCmdBeginQuery(commandBuffer, m_queryPool, _handle.idx, 0);
+		vkCmdBeginQuery(s_renderVK->m_commandBuffer, m_queryPool, _handle.idx, 0);
 	}
 
 	void OcclusionQueryVK::end()
 	{
-		const VkCommandBuffer commandBuffer = s_renderVK->m_commandBuffer;
-
 		const OcclusionQueryHandle handle = m_handle[m_control.m_current];
-		vkCmdEndQuery(commandBuffer, m_queryPool, handle.idx);
+		vkCmdEndQuery(s_renderVK->m_commandBuffer, m_queryPool, handle.idx);
 
 		m_control.commit(1);
 	}
@@ -5703,6 +6898,7 @@ VK_DESTROY
 		m_numLayers = 1;
 		m_requestedFormat = uint8_t(bimg::TextureFormat::Count);
 		m_textureFormat   = uint8_t(bimg::TextureFormat::Count);
+		m_residentMip     = 0;
 		m_format = _format;
 		m_components = { VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY };
 		m_aspectMask = getAspectMask(m_format);
@@ -5789,16 +6985,22 @@ VK_DESTROY
 		}
 
 		VkMemoryRequirements imageMemReq;
-		vkGetImageMemoryRequirements(device, m_textureImage, &imageMemReq);
+		const bool dedicated = s_renderVK->getImageMemoryRequirements(m_textureImage, &imageMemReq);
+
+		VkMemoryDedicatedAllocateInfoKHR mdai;
+		mdai.sType  = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO_KHR;
+		mdai.pNext  = NULL;
+		mdai.image  = m_textureImage;
+		mdai.buffer = VK_NULL_HANDLE;
 
-		result = s_renderVK->allocateMemory(&imageMemReq, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &m_textureDeviceMem);
+		result = s_renderVK->allocateMemory(&imageMemReq, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &m_textureDeviceMem, true, dedicated ? &mdai : NULL);
 		if (VK_SUCCESS != result)
 		{
 			BX_TRACE("Create texture image error: allocateMemory failed %d: %s.", result, getName(result) );
 			return result;
 		}
 
-		result = vkBindImageMemory(device, m_textureImage, m_textureDeviceMem, 0);
+		result = vkBindImageMemory(device, m_textureImage, m_textureDeviceMem.m_memory, m_textureDeviceMem.m_offset);
 		if (VK_SUCCESS != result)
 		{
 			BX_TRACE("Create texture image error: vkBindImageMemory failed %d: %s.", result, getName(result) );
@@ -5832,16 +7034,22 @@ VK_DESTROY
 			}
 
 			VkMemoryRequirements imageMemReq_resolve;
-			vkGetImageMemoryRequirements(device, m_singleMsaaImage, &imageMemReq_resolve);
+			const bool dedicatedResolve = s_renderVK->getImageMemoryRequirements(m_singleMsaaImage, &imageMemReq_resolve);
 
-			result = s_renderVK->allocateMemory(&imageMemReq_resolve, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &m_singleMsaaDeviceMem);
+			VkMemoryDedicatedAllocateInfoKHR mdaiResolve;
+			mdaiResolve.sType  = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO_KHR;
+			mdaiResolve.pNext  = NULL;
+			mdaiResolve.image  = m_singleMsaaImage;
+			mdaiResolve.buffer = VK_NULL_HANDLE;
+
+			result = s_renderVK->allocateMemory(&imageMemReq_resolve, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &m_singleMsaaDeviceMem, true, dedicatedResolve ? &mdaiResolve : NULL);
 			if (VK_SUCCESS != result)
 			{
 				BX_TRACE("Create texture image error: allocateMemory failed %d: %s.", result, getName(result) );
 				return result;
 			}
 
-			result = vkBindImageMemory(device, m_singleMsaaImage, m_singleMsaaDeviceMem, 0);
+			result = vkBindImageMemory(device, m_singleMsaaImage, m_singleMsaaDeviceMem.m_memory, m_singleMsaaDeviceMem.m_offset);
 			if (VK_SUCCESS != result)
 			{
 				BX_TRACE("Create texture image error: vkBindImageMemory failed %d: %s.", result, getName(result) );
@@ -5884,6 +7092,7 @@ VK_DESTROY
 			m_numLayers = ti.numLayers;
 			m_requestedFormat = uint8_t(imageContainer.m_format);
 			m_textureFormat   = uint8_t(getViableTextureFormat(imageContainer) );
+			m_residentMip     = 0;
 			m_format = bimg::isDepth(bimg::TextureFormat::Enum(m_textureFormat) )
 				? s_textureFormat[m_textureFormat].m_fmtDsv
 				: (m_flags & BGFX_TEXTURE_SRGB) ? s_textureFormat[m_textureFormat].m_fmtSrgb : s_textureFormat[m_textureFormat].m_fmt
@@ -6081,35 +7290,20 @@ VK_DESTROY
 
 			if (totalMemSize > 0)
 			{
-				const VkDevice device = s_renderVK->m_device;
-
-				VkBuffer stagingBuffer;
-				VkDeviceMemory stagingDeviceMem;
-				VK_CHECK(s_renderVK->createStagingBuffer(totalMemSize, &stagingBuffer, &stagingDeviceMem) );
-
-				uint8_t* mappedMemory;
-				VK_CHECK(vkMapMemory(
-					  device
-					, stagingDeviceMem
-					, 0
-					, totalMemSize
-					, 0
-					, (void**)&mappedMemory
-					) );
+				StagingAllocationVK staging = s_renderVK->allocStaging(totalMemSize, getStagingAlign() );
+				uint8_t* mappedMemory = staging.m_data;
 
 				// copy image to staging buffer
 				for (uint32_t ii = 0; ii < numSrd; ++ii)
 				{
 					bx::memCopy(mappedMemory, imageInfos[ii].data, imageInfos[ii].size);
 					mappedMemory += imageInfos[ii].size;
+					bufferCopyInfo[ii].bufferOffset += staging.m_offset;
 				}
 
-				vkUnmapMemory(device, stagingDeviceMem);
+				copyBufferToTexture(_commandBuffer, staging.m_buffer, numSrd, bufferCopyInfo);
 
-				copyBufferToTexture(_commandBuffer, stagingBuffer, numSrd, bufferCopyInfo);
-
-				s_renderVK->release(stagingBuffer);
-				s_renderVK->release(stagingDeviceMem);
+				s_renderVK->releaseStaging(staging);
 			}
 			else
 			{
@@ -6133,6 +7327,11 @@ VK_DESTROY
 
 	void TextureVK::destroy()
 	{
+		if (m_uploadPending)
+		{
+			s_renderVK->flushUploads();
+		}
+
 		m_readback.destroy();
 
 		if (VK_NULL_HANDLE != m_textureImage)
@@ -6194,9 +7393,9 @@ VK_DESTROY
 			};
 		}
 
-		VkBuffer stagingBuffer = VK_NULL_HANDLE;
-		VkDeviceMemory stagingDeviceMem = VK_NULL_HANDLE;
-		VK_CHECK(s_renderVK->createStagingBuffer(size, &stagingBuffer, &stagingDeviceMem, data) );
+		StagingAllocationVK staging = s_renderVK->allocStaging(size, getStagingAlign() );
+		bx::memCopy(staging.m_data, data, size);
+		region.bufferOffset = staging.m_offset;
 
 		if (VK_IMAGE_VIEW_TYPE_3D == m_type)
 		{
@@ -6212,10 +7411,9 @@ VK_DESTROY
 			region.imageSubresource.baseArrayLayer = _z;
 		}
 
-		copyBufferToTexture(_commandBuffer, stagingBuffer, 1, &region);
+		copyBufferToTexture(_commandBuffer, staging.m_buffer, 1, &region);
 
-		s_renderVK->release(stagingBuffer);
-		s_renderVK->release(stagingDeviceMem);
+		s_renderVK->releaseStaging(staging);
 
 		if (NULL != temp)
 		{
@@ -6272,107 +7470,422 @@ VK_DESTROY
 				);
 		}
 
-		if (needMipGen)
+		if (needMipGen)
+		{
+			setImageMemoryBarrier(_commandBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+			int32_t mipWidth  = bx::max<int32_t>(int32_t(m_width)  >> _mip, 1);
+			int32_t mipHeight = bx::max<int32_t>(int32_t(m_height) >> _mip, 1);
+
+			const VkFilter filter = bimg::isDepth(bimg::TextureFormat::Enum(m_textureFormat) )
+				? VK_FILTER_NEAREST
+				: VK_FILTER_LINEAR
+				;
+
+			VkImageBlit blit;
+			blit.srcOffsets[0] = { 0, 0, 0 };
+			blit.srcOffsets[1] = { mipWidth, mipHeight, 1 };
+			blit.srcSubresource.aspectMask = m_aspectMask;
+			blit.srcSubresource.mipLevel = 0;
+			blit.srcSubresource.baseArrayLayer = _layer;
+			blit.srcSubresource.layerCount = _numLayers;
+			blit.dstOffsets[0] = { 0, 0, 0 };
+			blit.dstOffsets[1] = { mipWidth, mipHeight, 1 };
+			blit.dstSubresource.aspectMask = m_aspectMask;
+			blit.dstSubresource.mipLevel = 0;
+			blit.dstSubresource.baseArrayLayer = _layer;
+			blit.dstSubresource.layerCount = _numLayers;
+
+			for (uint32_t i = _mip + 1; i < m_numMips; i++)
+			{
+				blit.srcOffsets[1] = { mipWidth, mipHeight, 1 };
+				blit.srcSubresource.mipLevel = i - 1;
+
+				mipWidth  = bx::uint32_max(mipWidth  >> 1, 1);
+				mipHeight = bx::uint32_max(mipHeight >> 1, 1);
+
+				blit.dstOffsets[1] = { mipWidth, mipHeight, 1 };
+				blit.dstSubresource.mipLevel = i;
+
+				vk::setImageMemoryBarrier(
+					  _commandBuffer
+					, m_textureImage
+					, m_aspectMask
+					, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
+					, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
+					, blit.srcSubresource.mipLevel
+					, 1
+					, _layer
+					, _numLayers
+					);
+
+				vkCmdBlitImage(
+					  _commandBuffer
+					, m_textureImage
+					, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
+					, m_textureImage
+					, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
+					, 1
+					, &blit
+					, filter
+					);
+			}
+
+			vk::setImageMemoryBarrier(
+				  _commandBuffer
+				, m_textureImage
+				, m_aspectMask
+				, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
+				, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
+				, _mip
+				, m_numMips - _mip - 1
+				, _layer
+				, _numLayers
+				);
+		}
+
+		setImageMemoryBarrier(_commandBuffer, oldLayout);
+		setImageMemoryBarrier(_commandBuffer, oldSingleMsaaLayout, true);
+	}
+
+	void TextureVK::copyBufferToTexture(VkCommandBuffer _commandBuffer, VkBuffer _stagingBuffer, uint32_t _bufferImageCopyCount, VkBufferImageCopy* _bufferImageCopy)
+	{
+		s_renderVK->m_uploadBatch.uploadImage(_commandBuffer, *this, _stagingBuffer, _bufferImageCopyCount, _bufferImageCopy);
+	}
+
+	uint32_t TextureVK::getStagingAlign() const
+	{
+		// bufferOffset must be multiple of 4 and of texel block size.
+		const bimg::ImageBlockInfo& blockInfo = bimg::getBlockInfo(bimg::TextureFormat::Enum(m_textureFormat) );
+		return bx::max<uint32_t>(1, blockInfo.blockSize) * 4;
+	}
+
+	void UploadBatchVK::uploadBuffer(VkCommandBuffer _commandBuffer, VkBuffer _src, VkBuffer _dst, const VkBufferCopy& _region)
+	{
+		// Copies within batch are not ordered, overlapping writes must be in separate batches.
+		for (const BufferUpload& upload : m_bufferUploads)
+		{
+			if (upload.m_dst == _dst
+			&&  upload.m_region.dstOffset < _region.dstOffset + _region.size
+			&&  _region.dstOffset < upload.m_region.dstOffset + upload.m_region.size)
+			{
+				flush(_commandBuffer);
+				break;
+			}
+		}
+
+		BufferUpload upload;
+		upload.m_src    = _src;
+		upload.m_dst    = _dst;
+		upload.m_region = _region;
+		m_bufferUploads.push_back(upload);
+	}
+
+	void UploadBatchVK::uploadImage(VkCommandBuffer _commandBuffer, TextureVK& _texture, VkBuffer _src, uint32_t _numRegions, const VkBufferImageCopy* _regions)
+	{
+		if (_texture.m_uploadPending)
+		{
+			flush(_commandBuffer);
+		}
+
+		ImageUpload upload;
+		upload.m_texture     = &_texture;
+		upload.m_src         = _src;
+		upload.m_layout      = VK_IMAGE_LAYOUT_UNDEFINED;
+		upload.m_firstRegion = uint32_t(m_regions.size() );
+		upload.m_numRegions  = _numRegions;
+		m_imageUploads.push_back(upload);
+
+		for (uint32_t ii = 0; ii < _numRegions; ++ii)
+		{
+			m_regions.push_back(_regions[ii]);
+		}
+
+		_texture.m_uploadPending = true;
+	}
+
+	void UploadBatchVK::flush(VkCommandBuffer _commandBuffer)
+	{
+		if (isEmpty() )
+		{
+			return;
+		}
+
+		VkPipelineStageFlags srcStageMask = 0;
+		VkPipelineStageFlags dstStageMask = 0;
+
+		m_barriers.clear();
+
+		for (ImageUpload& upload : m_imageUploads)
+		{
+			TextureVK& texture = *upload.m_texture;
+
+			upload.m_layout = VK_IMAGE_LAYOUT_UNDEFINED == texture.m_currentImageLayout
+				? texture.m_sampledLayout
+				: texture.m_currentImageLayout
+				;
+
+			if (VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL != texture.m_currentImageLayout)
+			{
+				VkImageMemoryBarrier imb;
+				VkPipelineStageFlags srcStages;
+				VkPipelineStageFlags dstStages;
+				getImageMemoryBarrier(
+					  imb
+					, srcStages
+					, dstStages
+					, texture.m_textureImage
+					, texture.m_aspectMask
+					, texture.m_currentImageLayout
+					, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
+					);
+
+				m_barriers.push_back(imb);
+				srcStageMask |= srcStages;
+				dstStageMask |= dstStages;
+
+				texture.m_currentImageLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+			}
+		}
+
+		if (!m_barriers.empty() )
+		{
+			pipelineBarrier(
+				  _commandBuffer
+				, srcStageMask
+				, dstStageMask
+				, 0
+				, NULL
+				, uint32_t(m_barriers.size() )
+				, m_barriers.data()
+				);
+		}
+
+		for (uint32_t ii = 0, num = uint32_t(m_bufferUploads.size() ); ii < num;)
+		{
+			// Consecutive copies between same buffers are issued as single command.
+			const BufferUpload& first = m_bufferUploads[ii];
+
+			VkBufferCopy regions[16];
+			uint32_t numRegions = 0;
+
+			for (; ii < num && numRegions < BX_COUNTOF(regions); ++ii, ++numRegions)
+			{
+				const BufferUpload& upload = m_bufferUploads[ii];
+
+				if (upload.m_src != first.m_src
+				||  upload.m_dst != first.m_dst)
+				{
+					break;
+				}
+
+				regions[numRegions] = upload.m_region;
+			}
+
+			vkCmdCopyBuffer(_commandBuffer, first.m_src, first.m_dst, numRegions, regions);
+		}
+
+		for (const ImageUpload& upload : m_imageUploads)
+		{
+			vkCmdCopyBufferToImage(
+				  _commandBuffer
+				, upload.m_src
+				, upload.m_texture->m_textureImage
+				, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
+				, upload.m_numRegions
+				, &m_regions[upload.m_firstRegion]
+				);
+		}
+
+		srcStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+		dstStageMask = 0;
+
+		m_barriers.clear();
+
+		for (const ImageUpload& upload : m_imageUploads)
+		{
+			TextureVK& texture = *upload.m_texture;
+
+			VkImageMemoryBarrier imb;
+			VkPipelineStageFlags srcStages;
+			VkPipelineStageFlags dstStages;
+			getImageMemoryBarrier(
+				  imb
+				, srcStages
+				, dstStages
+				, texture.m_textureImage
+				, texture.m_aspectMask
+				, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
+				, upload.m_layout
+				);
+
+			m_barriers.push_back(imb);
+			dstStageMask |= dstStages;
+
+			texture.m_currentImageLayout = upload.m_layout;
+			texture.m_uploadPending      = false;
+		}
+
+		VkMemoryBarrier mb;
+		mb.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		mb.pNext = NULL;
+		mb.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		mb.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+
+		const bool hasBufferUploads = !m_bufferUploads.empty();
+
+		if (hasBufferUploads)
+		{
+			dstStageMask |= 0
+				| VK_PIPELINE_STAGE_TRANSFER_BIT
+				| VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT
+				| VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT
+				| VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT
+				;
+		}
+
+		pipelineBarrier(
+			  _commandBuffer
+			, srcStageMask
+			, dstStageMask
+			, hasBufferUploads ? 1 : 0
+			, hasBufferUploads ? &mb : NULL
+			, uint32_t(m_barriers.size() )
+			, m_barriers.empty() ? NULL : m_barriers.data()
+			);
+
+		m_bufferUploads.clear();
+		m_imageUploads.clear();
+		m_regions.clear();
+	}
+
+	void UploadBatchVK::discard()
+	{
+		for (const ImageUpload& upload : m_imageUploads)
 		{
-			setImageMemoryBarrier(_commandBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+			upload.m_texture->m_uploadPending = false;
+		}
 
-			int32_t mipWidth  = bx::max<int32_t>(int32_t(m_width)  >> _mip, 1);
-			int32_t mipHeight = bx::max<int32_t>(int32_t(m_height) >> _mip, 1);
+		m_bufferUploads.clear();
+		m_imageUploads.clear();
+		m_regions.clear();
+	}
 
-			const VkFilter filter = bimg::isDepth(bimg::TextureFormat::Enum(m_textureFormat) )
-				? VK_FILTER_NEAREST
-				: VK_FILTER_LINEAR
-				;
+	void BarrierBatchVK::imageBarrier(VkImage _image, VkImageAspectFlags _aspectMask, VkImageLayout _oldLayout, VkImageLayout _newLayout)
+	{
+		VkImageMemoryBarrier imb;
+		VkPipelineStageFlags srcStages;
+		VkPipelineStageFlags dstStages;
+		getImageMemoryBarrier(
+			  imb
+			, srcStages
+			, dstStages
+			, _image
+			, _aspectMask
+			, _oldLayout
+			, _newLayout
+			);
 
-			VkImageBlit blit;
-			blit.srcOffsets[0] = { 0, 0, 0 };
-			blit.srcOffsets[1] = { mipWidth, mipHeight, 1 };
-			blit.srcSubresource.aspectMask = m_aspectMask;
-			blit.srcSubresource.mipLevel = 0;
-			blit.srcSubresource.baseArrayLayer = _layer;
-			blit.srcSubresource.layerCount = _numLayers;
-			blit.dstOffsets[0] = { 0, 0, 0 };
-			blit.dstOffsets[1] = { mipWidth, mipHeight, 1 };
-			blit.dstSubresource.aspectMask = m_aspectMask;
-			blit.dstSubresource.mipLevel = 0;
-			blit.dstSubresource.baseArrayLayer = _layer;
-			blit.dstSubresource.layerCount = _numLayers;
+		m_dstStageMask |= dstStages;
 
-			for (uint32_t i = _mip + 1; i < m_numMips; i++)
+		// Barriers in single command are not ordered, transition of image that's already
+		// in batch is merged with previous one.
+		for (VkImageMemoryBarrier& barrier : m_barriers)
+		{
+			if (barrier.image == _image)
 			{
-				blit.srcOffsets[1] = { mipWidth, mipHeight, 1 };
-				blit.srcSubresource.mipLevel = i - 1;
+				barrier.newLayout      = _newLayout;
+				barrier.dstAccessMask |= imb.dstAccessMask;
+				return;
+			}
+		}
 
-				mipWidth  = bx::uint32_max(mipWidth  >> 1, 1);
-				mipHeight = bx::uint32_max(mipHeight >> 1, 1);
+		m_srcStageMask |= srcStages;
+		m_barriers.push_back(imb);
+	}
 
-				blit.dstOffsets[1] = { mipWidth, mipHeight, 1 };
-				blit.dstSubresource.mipLevel = i;
+	void BarrierBatchVK::memoryBarrier(VkPipelineStageFlags _srcStages, VkAccessFlags _srcAccess, VkPipelineStageFlags _dstStages, VkAccessFlags _dstAccess)
+	{
+		m_srcStageMask  |= _srcStages;
+		m_dstStageMask  |= _dstStages;
+		m_srcAccessMask |= _srcAccess;
+		m_dstAccessMask |= _dstAccess;
+	}
 
-				vk::setImageMemoryBarrier(
-					  _commandBuffer
-					, m_textureImage
-					, m_aspectMask
-					, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
-					, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
-					, blit.srcSubresource.mipLevel
-					, 1
-					, _layer
-					, _numLayers
-					);
+	void BarrierBatchVK::flush(VkCommandBuffer _commandBuffer)
+	{
+		if (isEmpty() )
+		{
+			return;
+		}
 
-				vkCmdBlitImage(
-					  _commandBuffer
-					, m_textureImage
-					, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
-					, m_textureImage
-					, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
-					, 1
-					, &blit
-					, filter
-					);
-			}
+		VkMemoryBarrier mb;
+		mb.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		mb.pNext = NULL;
+		mb.srcAccessMask = m_srcAccessMask;
+		mb.dstAccessMask = m_dstAccessMask;
 
-			vk::setImageMemoryBarrier(
-				  _commandBuffer
-				, m_textureImage
-				, m_aspectMask
-				, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
-				, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
-				, _mip
-				, m_numMips - _mip - 1
-				, _layer
-				, _numLayers
-				);
-		}
+		const bool hasMemoryBarrier = 0 != (m_srcAccessMask | m_dstAccessMask);
 
-		setImageMemoryBarrier(_commandBuffer, oldLayout);
-		setImageMemoryBarrier(_commandBuffer, oldSingleMsaaLayout, true);
+		pipelineBarrier(
+			  _commandBuffer
+			, m_srcStageMask
+			, m_dstStageMask
+			, hasMemoryBarrier ? 1 : 0
+			, hasMemoryBarrier ? &mb : NULL
+			, uint32_t(m_barriers.size() )
+			, m_barriers.empty() ? NULL : m_barriers.data()
+			);
+
+		m_barriers.clear();
+		m_srcStageMask  = 0;
+		m_dstStageMask  = 0;
+		m_srcAccessMask = 0;
+		m_dstAccessMask = 0;
 	}
 
-	void TextureVK::copyBufferToTexture(VkCommandBuffer _commandBuffer, VkBuffer _stagingBuffer, uint32_t _bufferImageCopyCount, VkBufferImageCopy* _bufferImageCopy)
+	VkImageLayout TextureVK::setImageMemoryBarrier(BarrierBatchVK& _batch, VkImageLayout _newImageLayout, bool _singleMsaaImage)
 	{
-		const VkImageLayout oldLayout = m_currentImageLayout == VK_IMAGE_LAYOUT_UNDEFINED
-			? m_sampledLayout
+		if (m_uploadPending)
+		{
+			s_renderVK->m_uploadBatch.flush(s_renderVK->m_commandBuffer);
+		}
+
+		if (_singleMsaaImage && VK_NULL_HANDLE == m_singleMsaaImage)
+		{
+			return VK_IMAGE_LAYOUT_UNDEFINED;
+		}
+
+		VkImageLayout& currentLayout = _singleMsaaImage
+			? m_currentSingleMsaaImageLayout
 			: m_currentImageLayout
 			;
 
-		setImageMemoryBarrier(_commandBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+		const VkImageLayout oldLayout = currentLayout;
 
-		vkCmdCopyBufferToImage(
-			  _commandBuffer
-			, _stagingBuffer
-			, m_textureImage
-			, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
-			, _bufferImageCopyCount
-			, _bufferImageCopy
+		if (currentLayout == _newImageLayout)
+		{
+			return oldLayout;
+		}
+
+		_batch.imageBarrier(
+			  _singleMsaaImage ? m_singleMsaaImage : m_textureImage
+			, m_aspectMask
+			, currentLayout
+			, _newImageLayout
 			);
 
-		setImageMemoryBarrier(_commandBuffer, oldLayout);
+		currentLayout = _newImageLayout;
+		return oldLayout;
 	}
 
 	VkImageLayout TextureVK::setImageMemoryBarrier(VkCommandBuffer _commandBuffer, VkImageLayout _newImageLayout, bool _singleMsaaImage)
 	{
+		if (m_uploadPending)
+		{
+			s_renderVK->m_uploadBatch.flush(_commandBuffer);
+		}
+
 		if (_singleMsaaImage && VK_NULL_HANDLE == m_singleMsaaImage)
 		{
 			return VK_IMAGE_LAYOUT_UNDEFINED;
@@ -6550,7 +8063,7 @@ VK_DESTROY
 				m_backBufferColorImage[ii]     = VK_NULL_HANDLE;
 				m_backBufferColorImageView[ii] = VK_NULL_HANDLE;
 				m_backBufferFrameBuffer[ii]    = VK_NULL_HANDLE;
-				m_backBufferFence[ii]          = VK_NULL_HANDLE;
+				m_backBufferSubmitted[ii]      = 0;
 				m_presentDoneSemaphore[ii]     = VK_NULL_HANDLE;
 				m_renderDoneSemaphore[ii]      = VK_NULL_HANDLE;
 			}
@@ -6621,6 +8134,8 @@ VK_DESTROY
 
 	void SwapChainVK::destroy()
 	{
+		s_renderVK->waitPresent();
+
 		if (VK_NULL_HANDLE != m_swapchain)
 		{
 			releaseFrameBuffer();
@@ -6638,6 +8153,8 @@ VK_DESTROY
 
 	void SwapChainVK::update(VkCommandBuffer _commandBuffer, void* _nwh, const Resolution& _resolution)
 	{
+		s_renderVK->waitPresent();
+
 		const VkPhysicalDevice physicalDevice = s_renderVK->m_physicalDevice;
 
 		m_lastImageRenderedSemaphore = VK_NULL_HANDLE;
@@ -7062,7 +8579,7 @@ VK_DESTROY
 		{
 			release(m_backBufferColorImageView[ii]);
 
-			m_backBufferFence[ii] = VK_NULL_HANDLE;
+			m_backBufferSubmitted[ii] = 0;
 
 			release(m_presentDoneSemaphore[ii]);
 			release(m_renderDoneSemaphore[ii]);
@@ -7352,6 +8869,8 @@ VK_DESTROY
 
 	bool SwapChainVK::acquire(VkCommandBuffer _commandBuffer)
 	{
+		s_renderVK->waitPresent();
+
 		if (VK_NULL_HANDLE == m_swapchain
 		||  m_needToRefreshSwapchain)
 		{
@@ -7394,16 +8913,7 @@ VK_DESTROY
 				return false;
 			}
 
-			if (VK_NULL_HANDLE != m_backBufferFence[m_backBufferColorIdx])
-			{
-				VK_CHECK(vkWaitForFences(
-					  device
-					, 1
-					, &m_backBufferFence[m_backBufferColorIdx]
-					, VK_TRUE
-					, UINT64_MAX
-					) );
-			}
+			VK_CHECK(s_renderVK->m_cmd.wait(m_backBufferSubmitted[m_backBufferColorIdx]) );
 
 			transitionImage(_commandBuffer);
 
@@ -7427,7 +8937,11 @@ VK_DESTROY
 			pi.pSwapchains        = &m_swapchain;
 			pi.pImageIndices      = &m_backBufferColorIdx;
 			pi.pResults           = NULL;
-			VkResult result = vkQueuePresentKHR(m_queue, &pi);
+			VkResult result;
+			{
+				bx::MutexScope scope(s_renderVK->m_cmd.m_queueMutex);
+				result = vkQueuePresentKHR(m_queue, &pi);
+			}
 
 			switch (result)
 			{
@@ -7600,100 +9114,338 @@ VK_DESTROY
 		m_sampler = m_swapChain.m_sampler;
 	}
 
-	void FrameBufferVK::resolve()
+	void FrameBufferVK::resolve()
+	{
+		if (!m_needResolve)
+		{
+			return;
+		}
+
+		if (NULL == m_nwh)
+		{
+			for (uint32_t ii = 0; ii < m_numTh; ++ii)
+			{
+				const Attachment& at = m_attachment[ii];
+
+				if (isValid(at.handle) )
+				{
+					TextureVK& texture = s_renderVK->m_textures[at.handle.idx];
+					texture.resolve(s_renderVK->m_commandBuffer, at.resolve, at.layer, at.numLayers, at.mip);
+				}
+			}
+		}
+		else if (isRenderable()
+		&&       m_sampler.Count > 1
+		&&       m_swapChain.m_supportsManualResolve)
+		{
+			m_swapChain.m_backBufferColorMsaa.m_singleMsaaImage = m_swapChain.m_backBufferColorImage[m_swapChain.m_backBufferColorIdx];
+			m_swapChain.m_backBufferColorMsaa.m_currentSingleMsaaImageLayout = m_swapChain.m_backBufferColorImageLayout[m_swapChain.m_backBufferColorIdx];
+
+			m_swapChain.m_backBufferColorMsaa.resolve(s_renderVK->m_commandBuffer, 0, 0, 1, 0);
+
+			m_swapChain.m_backBufferColorMsaa.m_singleMsaaImage = VK_NULL_HANDLE;
+			m_swapChain.m_backBufferColorMsaa.m_currentSingleMsaaImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		}
+
+		m_needResolve = false;
+	}
+
+	uint16_t FrameBufferVK::destroy()
+	{
+		preReset();
+
+		if (NULL != m_nwh)
+		{
+			m_swapChain.destroy();
+			m_nwh = NULL;
+			m_needPresent = false;
+			m_needAcquire = false;
+		}
+
+		m_numTh = 0;
+		m_num = 0;
+		m_depth = BGFX_INVALID_HANDLE;
+
+		m_needResolve = false;
+
+		uint16_t denseIdx = m_denseIdx;
+		m_denseIdx = UINT16_MAX;
+		return denseIdx;
+	}
+
+	bool FrameBufferVK::acquire(VkCommandBuffer _commandBuffer)
+	{
+		bool acquired = true;
+
+		if (NULL != m_nwh)
+		{
+			acquired = m_swapChain.acquire(_commandBuffer);
+			m_needPresent = m_swapChain.m_needPresent;
+			m_currentFramebuffer = m_swapChain.m_backBufferFrameBuffer[m_swapChain.m_backBufferColorIdx];
+		}
+
+		m_needResolve = true;
+
+		return acquired;
+	}
+
+	void FrameBufferVK::present()
+	{
+		m_swapChain.present();
+		m_needPresent = false;
+	}
+
+	bool FrameBufferVK::isRenderable() const
+	{
+		return false
+			|| (NULL == m_nwh)
+			|| m_swapChain.m_needPresent
+			;
+	}
+
+	VkResult FrameBufferVK::getRenderPass(uint16_t _clearFlags, uint16_t _discardFlags, VkRenderPass* _renderPass) const
+	{
+		if (BGFX_CLEAR_NONE == (_clearFlags | _discardFlags) )
+		{
+			*_renderPass = m_renderPass;
+			return VK_SUCCESS;
+		}
+
+		return NULL == m_nwh
+			? s_renderVK->getRenderPass(m_numTh, m_attachment, _renderPass, _clearFlags, _discardFlags)
+			: s_renderVK->getRenderPass(m_swapChain, _renderPass, _clearFlags, _discardFlags)
+			;
+	}
+
+	static int32_t pipelinePrecacheThread(bx::Thread* _self, void* _userData)
+	{
+		BX_UNUSED(_self);
+		PipelinePrecacheVK* precache = (PipelinePrecacheVK*)_userData;
+		return precache->run();
+	}
+
+	void PipelinePrecacheVK::init(uint32_t _numThreads)
+	{
+		m_exit       = false;
+		m_numActive  = 0;
+		m_numThreads = bx::min<uint32_t>(_numThreads, kMaxThreads);
+
+		for (uint32_t ii = 0; ii < m_numThreads; ++ii)
+		{
+			m_thread[ii].init(pipelinePrecacheThread, this, 0, "bgfx - vk pipeline precache thread");
+		}
+	}
+
+	void PipelinePrecacheVK::shutdown()
+	{
+		{
+			bx::MutexScope scope(m_mutex);
+			m_exit = true;
+			m_pending.clear();
+		}
+
+		for (uint32_t ii = 0; ii < m_numThreads; ++ii)
+		{
+			m_sem.post();
+		}
+
+		for (uint32_t ii = 0; ii < m_numThreads; ++ii)
+		{
+			m_thread[ii].shutdown();
+		}
+
+		m_numThreads = 0;
+	}
+
+	void PipelinePrecacheVK::push(const Job& _job)
+	{
+		if (0 == m_numThreads)
+		{
+			Job job = _job;
+			s_renderVK->compilePipeline(job);
+
+			bx::MutexScope scope(m_mutex);
+			m_done.push_back(job);
+			return;
+		}
+
+		{
+			bx::MutexScope scope(m_mutex);
+			m_pending.push_back(_job);
+		}
+
+		m_sem.post();
+	}
+
+	bool PipelinePrecacheVK::pop(Job& _job)
 	{
-		if (!m_needResolve)
+		bx::MutexScope scope(m_mutex);
+
+		if (m_done.empty() )
 		{
-			return;
+			return false;
 		}
 
-		if (NULL == m_nwh)
+		_job = m_done.back();
+		m_done.pop_back();
+		return true;
+	}
+
+	void PipelinePrecacheVK::wait()
+	{
+		for (;;)
 		{
-			for (uint32_t ii = 0; ii < m_numTh; ++ii)
 			{
-				const Attachment& at = m_attachment[ii];
+				bx::MutexScope scope(m_mutex);
 
-				if (isValid(at.handle) )
+				if (m_pending.empty()
+				&&  0 == m_numActive)
 				{
-					TextureVK& texture = s_renderVK->m_textures[at.handle.idx];
-					texture.resolve(s_renderVK->m_commandBuffer, at.resolve, at.layer, at.numLayers, at.mip);
+					return;
 				}
 			}
+
+			bx::yield();
 		}
-		else if (isRenderable()
-		&&       m_sampler.Count > 1
-		&&       m_swapChain.m_supportsManualResolve)
+	}
+
+	int32_t PipelinePrecacheVK::run()
+	{
+		for (;;)
 		{
-			m_swapChain.m_backBufferColorMsaa.m_singleMsaaImage = m_swapChain.m_backBufferColorImage[m_swapChain.m_backBufferColorIdx];
-			m_swapChain.m_backBufferColorMsaa.m_currentSingleMsaaImageLayout = m_swapChain.m_backBufferColorImageLayout[m_swapChain.m_backBufferColorIdx];
+			m_sem.wait();
 
-			m_swapChain.m_backBufferColorMsaa.resolve(s_renderVK->m_commandBuffer, 0, 0, 1, 0);
+			Job job;
 
-			m_swapChain.m_backBufferColorMsaa.m_singleMsaaImage = VK_NULL_HANDLE;
-			m_swapChain.m_backBufferColorMsaa.m_currentSingleMsaaImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+			{
+				bx::MutexScope scope(m_mutex);
+
+				if (m_exit)
+				{
+					break;
+				}
+
+				if (m_pending.empty() )
+				{
+					continue;
+				}
+
+				job = m_pending.back();
+				m_pending.pop_back();
+				++m_numActive;
+			}
+
+			s_renderVK->compilePipeline(job);
+
+			{
+				bx::MutexScope scope(m_mutex);
+				m_done.push_back(job);
+				--m_numActive;
+			}
 		}
 
-		m_needResolve = false;
+		return 0;
 	}
 
-	uint16_t FrameBufferVK::destroy()
+	static int32_t presentThread(bx::Thread* _self, void* _userData)
 	{
-		preReset();
+		BX_UNUSED(_self);
+		PresentThreadVK* present = (PresentThreadVK*)_userData;
+		return present->run();
+	}
 
-		if (NULL != m_nwh)
+	void PresentThreadVK::init(bool _enabled)
+	{
+		m_numFrameBuffers = 0;
+		m_elapsed = 0;
+		m_pending = false;
+		m_exit    = false;
+		m_enabled = _enabled;
+
+		if (m_enabled)
 		{
-			m_swapChain.destroy();
-			m_nwh = NULL;
-			m_needPresent = false;
+			m_thread.init(presentThread, this, 0, "bgfx - vk present thread");
 		}
+	}
 
-		m_numTh = 0;
-		m_num = 0;
-		m_depth = BGFX_INVALID_HANDLE;
+	void PresentThreadVK::shutdown()
+	{
+		if (m_enabled)
+		{
+			wait();
 
-		m_needResolve = false;
+			m_exit = true;
+			m_sem.post();
+			m_thread.shutdown();
 
-		uint16_t denseIdx = m_denseIdx;
-		m_denseIdx = UINT16_MAX;
-		return denseIdx;
+			m_enabled = false;
+		}
 	}
 
-	bool FrameBufferVK::acquire(VkCommandBuffer _commandBuffer)
+	void PresentThreadVK::push(FrameBufferVK* _frameBuffer)
 	{
-		bool acquired = true;
+		BX_ASSERT(!m_pending, "Present is still pending, wait must be called first.");
+		BX_ASSERT(m_numFrameBuffers < BX_COUNTOF(m_frameBuffer), "Too many frame buffers to present.");
+		m_frameBuffer[m_numFrameBuffers++] = _frameBuffer;
+	}
 
-		if (NULL != m_nwh)
+	void PresentThreadVK::kick()
+	{
+		if (0 < m_numFrameBuffers)
 		{
-			acquired = m_swapChain.acquire(_commandBuffer);
-			m_needPresent = m_swapChain.m_needPresent;
-			m_currentFramebuffer = m_swapChain.m_backBufferFrameBuffer[m_swapChain.m_backBufferColorIdx];
+			m_pending = true;
+			m_sem.post();
 		}
-
-		m_needResolve = true;
-
-		return acquired;
 	}
 
-	void FrameBufferVK::present()
+	int64_t PresentThreadVK::wait()
 	{
-		m_swapChain.present();
-		m_needPresent = false;
+		if (!m_pending)
+		{
+			return 0;
+		}
+
+		m_done.wait();
+		m_pending = false;
+		m_numFrameBuffers = 0;
+
+		return m_elapsed;
 	}
 
-	bool FrameBufferVK::isRenderable() const
+	int32_t PresentThreadVK::run()
 	{
-		return false
-			|| (NULL == m_nwh)
-			|| m_swapChain.m_needPresent
-			;
+		for (;;)
+		{
+			m_sem.wait();
+
+			if (m_exit)
+			{
+				break;
+			}
+
+			const int64_t start = bx::getHPCounter();
+
+			for (uint32_t ii = 0; ii < m_numFrameBuffers; ++ii)
+			{
+				m_frameBuffer[ii]->present();
+			}
+
+			m_elapsed = bx::getHPCounter() - start;
+
+			m_done.post();
+		}
+
+		return 0;
 	}
 
-	VkResult CommandQueueVK::init(uint32_t _queueFamily, VkQueue _queue, uint32_t _numFramesInFlight)
+	VkResult CommandQueueVK::init(uint32_t _queueFamily, VkQueue _queue, uint32_t _numFramesInFlight, bool _timelineSemaphore)
 	{
 		m_queueFamily = _queueFamily;
 		m_queue = _queue;
 		m_numFramesInFlight = bx::clamp<uint32_t>(_numFramesInFlight, 1, BGFX_CONFIG_MAX_FRAME_LATENCY);
 		m_activeCommandBuffer = VK_NULL_HANDLE;
+		m_timelineSemaphoreSupport = _timelineSemaphore;
+		m_timelineSemaphore = VK_NULL_HANDLE;
 
 		return reset();
 	}
@@ -7709,10 +9461,9 @@ VK_DESTROY
 		m_numWaitSemaphores   = 0;
 
 		m_activeCommandBuffer = VK_NULL_HANDLE;
-		m_currentFence        = VK_NULL_HANDLE;
-		m_completedFence      = VK_NULL_HANDLE;
 
 		m_submitted = 0;
+		m_completed = 0;
 
 		VkCommandPoolCreateInfo cpci;
 		cpci.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
@@ -7733,8 +9484,37 @@ VK_DESTROY
 
 		VkResult result = VK_SUCCESS;
 
+		if (m_timelineSemaphoreSupport)
+		{
+			VkSemaphoreTypeCreateInfoKHR stci;
+			stci.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+			stci.pNext = NULL;
+			stci.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+			stci.initialValue  = 0;
+
+			VkSemaphoreCreateInfo sci;
+			sci.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+			sci.pNext = &stci;
+			sci.flags = 0;
+
+			result = vkCreateSemaphore(
+				  s_renderVK->m_device
+				, &sci
+				, s_renderVK->m_allocatorCb
+				, &m_timelineSemaphore
+				);
+
+			if (VK_SUCCESS != result)
+			{
+				BX_TRACE("Create command queue error: vkCreateSemaphore failed %d: %s.", result, getName(result) );
+				return result;
+			}
+		}
+
 		for (uint32_t ii = 0; ii < m_numFramesInFlight; ++ii)
 		{
+			m_commandList[ii].m_submitted = 0;
+
 			result = vkCreateCommandPool(
 				  s_renderVK->m_device
 				, &cpci
@@ -7762,6 +9542,11 @@ VK_DESTROY
 				return result;
 			}
 
+			if (m_timelineSemaphoreSupport)
+			{
+				continue;
+			}
+
 			result = vkCreateFence(
 				  s_renderVK->m_device
 				, &fci
@@ -7790,6 +9575,8 @@ VK_DESTROY
 			m_commandList[ii].m_commandBuffer = VK_NULL_HANDLE;
 			vkDestroy(m_commandList[ii].m_commandPool);
 		}
+
+		vkDestroy(m_timelineSemaphore);
 	}
 
 	VkResult CommandQueueVK::alloc(VkCommandBuffer* _commandBuffer)
@@ -7801,11 +9588,11 @@ VK_DESTROY
 			const VkDevice device = s_renderVK->m_device;
 			CommandList& commandList = m_commandList[m_currentFrameInFlight];
 
-			result = vkWaitForFences(device, 1, &commandList.m_fence, VK_TRUE, UINT64_MAX);
+			result = wait(commandList.m_submitted);
 
 			if (VK_SUCCESS != result)
 			{
-				BX_TRACE("Allocate command buffer error: vkWaitForFences failed %d: %s.", result, getName(result) );
+				BX_TRACE("Allocate command buffer error: waiting for submission %d failed %d: %s.", commandList.m_submitted, result, getName(result) );
 				return result;
 			}
 
@@ -7832,7 +9619,6 @@ VK_DESTROY
 			}
 
 			m_activeCommandBuffer = commandList.m_commandBuffer;
-			m_currentFence = commandList.m_fence;
 		}
 
 		if (NULL != _commandBuffer)
@@ -7874,14 +9660,40 @@ VK_DESTROY
 
 			VK_CHECK(vkEndCommandBuffer(m_activeCommandBuffer) );
 
-			m_completedFence = m_currentFence;
-			m_currentFence = VK_NULL_HANDLE;
+			m_submitted++;
 
-			VK_CHECK(vkResetFences(device, 1, &m_completedFence) );
+			CommandList& commandList = m_commandList[m_currentFrameInFlight];
+			commandList.m_submitted = m_submitted;
 
 			VkSubmitInfo si;
 			si.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 			si.pNext = NULL;
+
+			VkTimelineSemaphoreSubmitInfoKHR tssi;
+
+			if (m_timelineSemaphoreSupport)
+			{
+				addSignalSemaphore(m_timelineSemaphore);
+
+				// Values of binary semaphores are ignored.
+				for (uint32_t ii = 0; ii < m_numSignalSemaphores; ++ii)
+				{
+					m_signalSemaphoreValues[ii] = m_submitted;
+				}
+
+				tssi.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+				tssi.pNext = NULL;
+				tssi.waitSemaphoreValueCount   = 0;
+				tssi.pWaitSemaphoreValues      = NULL;
+				tssi.signalSemaphoreValueCount = m_numSignalSemaphores;
+				tssi.pSignalSemaphoreValues    = m_signalSemaphoreValues;
+				si.pNext = &tssi;
+			}
+			else
+			{
+				VK_CHECK(vkResetFences(device, 1, &commandList.m_fence) );
+			}
+
 			si.waitSemaphoreCount    = m_numWaitSemaphores;
 			si.pWaitSemaphores       = &m_waitSemaphores[0];
 			si.pWaitDstStageMask     = m_waitSemaphoreStages;
@@ -7893,20 +9705,105 @@ VK_DESTROY
 			m_numWaitSemaphores   = 0;
 			m_numSignalSemaphores = 0;
 
-			VK_CHECK(vkQueueSubmit(m_queue, 1, &si, m_completedFence) );
+			{
+				bx::MutexScope scope(m_queueMutex);
+				VK_CHECK(vkQueueSubmit(m_queue, 1, &si, commandList.m_fence) );
+			}
 
 			if (_wait)
 			{
-				VK_CHECK(vkWaitForFences(device, 1, &m_completedFence, VK_TRUE, UINT64_MAX) );
+				VK_CHECK(wait(m_submitted) );
 			}
 
 			m_activeCommandBuffer = VK_NULL_HANDLE;
 
 			m_currentFrameInFlight = (m_currentFrameInFlight + 1) % m_numFramesInFlight;
-			m_submitted++;
 		}
 	}
 
+	uint64_t CommandQueueVK::getCompleted()
+	{
+		const VkDevice device = s_renderVK->m_device;
+
+		if (m_timelineSemaphoreSupport)
+		{
+			uint64_t value;
+			if (VK_SUCCESS == vkGetSemaphoreCounterValueKHR(device, m_timelineSemaphore, &value) )
+			{
+				m_completed = bx::max(m_completed, value);
+			}
+		}
+		else
+		{
+			// Queue executes submissions in order, newest signaled fence
+			// tells how far GPU got.
+			for (uint32_t ii = 0; ii < m_numFramesInFlight; ++ii)
+			{
+				const CommandList& commandList = m_commandList[ii];
+
+				if (commandList.m_submitted > m_completed
+				&&  VK_SUCCESS == vkGetFenceStatus(device, commandList.m_fence) )
+				{
+					m_completed = commandList.m_submitted;
+				}
+			}
+		}
+
+		return m_completed;
+	}
+
+	VkResult CommandQueueVK::wait(uint64_t _submitted)
+	{
+		if (_submitted <= m_completed)
+		{
+			return VK_SUCCESS;
+		}
+
+		const VkDevice device = s_renderVK->m_device;
+
+		VkResult result = VK_SUCCESS;
+
+		if (m_timelineSemaphoreSupport)
+		{
+			VkSemaphoreWaitInfoKHR swi;
+			swi.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+			swi.pNext = NULL;
+			swi.flags = 0;
+			swi.semaphoreCount = 1;
+			swi.pSemaphores    = &m_timelineSemaphore;
+			swi.pValues        = &_submitted;
+
+			result = vkWaitSemaphoresKHR(device, &swi, UINT64_MAX);
+
+			if (VK_SUCCESS != result)
+			{
+				BX_TRACE("Wait error: vkWaitSemaphoresKHR failed %d: %s.", result, getName(result) );
+				return result;
+			}
+		}
+		else
+		{
+			const CommandList& commandList = m_commandList[(_submitted - 1) % m_numFramesInFlight];
+
+			// Command list was reused by later submission only after this
+			// submission completed.
+			if (commandList.m_submitted == _submitted)
+			{
+				result = vkWaitForFences(device, 1, &commandList.m_fence, VK_TRUE, UINT64_MAX);
+
+				if (VK_SUCCESS != result)
+				{
+					BX_TRACE("Wait error: vkWaitForFences failed %d: %s.", result, getName(result) );
+					return result;
+				}
+			}
+		}
+
+		m_completed = _submitted;
+
+		return result;
+	}
+
 	void CommandQueueVK::finish(bool _finishAll)
 	{
 		if (_finishAll)
@@ -7932,6 +9829,11 @@ VK_DESTROY
 		m_release[m_currentFrameInFlight].push_back(resource);
 	}
 
+	void CommandQueueVK::release(const DeviceMemoryAllocationVK& _allocation)
+	{
+		m_releaseMemory[m_currentFrameInFlight].push_back(_allocation);
+	}
+
 	void CommandQueueVK::consume()
 	{
 		m_consumeIndex = (m_consumeIndex + 1) % m_numFramesInFlight;
@@ -7961,6 +9863,13 @@ VK_DESTROY
 		}
 
 		m_release[m_consumeIndex].clear();
+
+		for (const DeviceMemoryAllocationVK& allocation : m_releaseMemory[m_consumeIndex])
+		{
+			s_renderVK->m_memoryAllocator.free(allocation);
+		}
+
+		m_releaseMemory[m_consumeIndex].clear();
 	}
 
 	void RendererContextVK::submitBlit(BlitState& _bs, uint16_t _view)
@@ -7993,16 +9902,18 @@ VK_DESTROY
 			TextureVK& dst = m_textures[blit.m_dst.idx];
 
 			src.setImageMemoryBarrier(
-				  m_commandBuffer
+				  m_barrierBatch
 				, blit.m_src.idx == blit.m_dst.idx ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
 				, VK_NULL_HANDLE != src.m_singleMsaaImage
 				);
 
 			if (blit.m_src.idx != blit.m_dst.idx)
 			{
-				dst.setImageMemoryBarrier(m_commandBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+				dst.setImageMemoryBarrier(m_barrierBatch, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 			}
 
+			m_barrierBatch.flush(m_commandBuffer);
+
 			const uint16_t srcSamples = VK_NULL_HANDLE != src.m_singleMsaaImage ? 1 : src.m_sampler.Count;
 			const uint16_t dstSamples = dst.m_sampler.Count;
 			BX_UNUSED(srcSamples, dstSamples);
@@ -8061,10 +9972,13 @@ VK_DESTROY
 				, &copyInfo
 				);
 
-			setMemoryBarrier(
-				  m_commandBuffer
-				, VK_PIPELINE_STAGE_TRANSFER_BIT
+			// Dependency between copies is recorded together with transitions of next
+			// blit, or with transitions back to original layouts after last one.
+			m_barrierBatch.memoryBarrier(
+				  VK_PIPELINE_STAGE_TRANSFER_BIT
+				, VK_ACCESS_TRANSFER_WRITE_BIT
 				, VK_PIPELINE_STAGE_TRANSFER_BIT
+				, VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT
 				);
 		}
 
@@ -8077,9 +9991,11 @@ VK_DESTROY
 			TextureVK& src = m_textures[blit.m_src.idx];
 			TextureVK& dst = m_textures[blit.m_dst.idx];
 
-			src.setImageMemoryBarrier(m_commandBuffer, srcLayouts[item], VK_NULL_HANDLE != src.m_singleMsaaImage);
-			dst.setImageMemoryBarrier(m_commandBuffer, dstLayouts[item]);
+			src.setImageMemoryBarrier(m_barrierBatch, srcLayouts[item], VK_NULL_HANDLE != src.m_singleMsaaImage);
+			dst.setImageMemoryBarrier(m_barrierBatch, dstLayouts[item]);
 		}
+
+		m_barrierBatch.flush(m_commandBuffer);
 	}
 
 	void RendererContextVK::submit(Frame* _render, ClearQuad& _clearQuad, TextVideoMemBlitter& _textVideoMemBlitter)
@@ -8096,6 +10012,9 @@ VK_DESTROY
 			renderDocTriggerCapture();
 		}
 
+		flushPipelinePrecache(false);
+		m_descriptorSetCache.gc(kDescriptorSetMaxAge, MAX_DESCRIPTOR_SETS/2);
+
 		BGFX_VK_PROFILER_BEGIN_LITERAL("rendererSubmit", kColorView);
 
 		int64_t timeBegin = bx::getHPCounter();
@@ -8122,6 +10041,8 @@ VK_DESTROY
 			m_vertexBuffers[vb->handle.idx].update(m_commandBuffer, 0, _render->m_vboffset, vb->data);
 		}
 
+		flushUploads();
+
 		_render->sort();
 
 		RenderDraw currentState;
@@ -8151,6 +10072,9 @@ VK_DESTROY
 		uint64_t blendFactor = UINT64_MAX;
 
 		bool wasCompute     = false;
+		// Previous frame's (or pre-frame) dispatches may have written resources read by
+		// first dispatch of this frame, and submission order alone doesn't make them visible.
+		bool computeWrite   = true;
 		bool viewHasScissor = false;
 		bool restoreScissor = false;
 		Rect viewScissorRect;
@@ -8178,13 +10102,11 @@ VK_DESTROY
 			, VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT
 			);
 
-		VkRenderPassBeginInfo rpbi;
-		rpbi.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-		rpbi.pNext = NULL;
-		rpbi.clearValueCount = 0;
-		rpbi.pClearValues    = NULL;
+		VkViewport viewport = {};
+		VkRect2D viewScissor = {};
 
 		bool beginRenderPass = false;
+		const RenderPassPlanVK* passPlan = NULL;
 
 		Profiler<TimerQueryVK> profiler(
 			  _render
@@ -8199,6 +10121,8 @@ VK_DESTROY
 		{
 			viewState.m_rect = _render->m_view[0].m_rect;
 
+			planRenderPasses(_render);
+
 			int32_t numItems = _render->m_numRenderItems;
 			for (int32_t item = 0; item < numItems;)
 			{
@@ -8218,10 +10142,18 @@ VK_DESTROY
 
 				if (viewChanged)
 				{
-					if (beginRenderPass)
+					const RenderPassPlanVK& plan = m_renderPassPlan[key.m_view];
+
+					if (!plan.m_merge)
 					{
-						vkCmdEndRenderPass(m_commandBuffer);
-						beginRenderPass = false;
+						if (beginRenderPass)
+						{
+							vkCmdEndRenderPass(m_commandBuffer);
+							beginRenderPass = false;
+							computeWrite    = false;
+						}
+
+						passPlan = &plan;
 					}
 
 					view = key.m_view;
@@ -8245,12 +10177,12 @@ VK_DESTROY
 						setFrameBuffer(fbh);
 					}
 
-					const FrameBufferVK& fb = isValid(m_fbh)
+					FrameBufferVK& fb = isValid(m_fbh)
 						? m_frameBuffers[m_fbh.idx]
 						: m_backBuffer
 						;
 
-					isFrameBufferValid = fb.isRenderable();
+					isFrameBufferValid = fb.m_needAcquire || fb.isRenderable();
 
 					if (isFrameBufferValid)
 					{
@@ -8261,39 +10193,64 @@ VK_DESTROY
 						viewScissorRect = viewHasScissor ? scissorRect : rect;
 						restoreScissor = false;
 
-						rpbi.framebuffer = fb.m_currentFramebuffer;
-						rpbi.renderPass  = fb.m_renderPass;
-						rpbi.renderArea.offset.x = rect.m_x;
-						rpbi.renderArea.offset.y = rect.m_y;
-						rpbi.renderArea.extent.width  = rect.m_width;
-						rpbi.renderArea.extent.height = rect.m_height;
-
-						VkViewport vp;
-						vp.x        =  float(rect.m_x);
-						vp.y        =  float(rect.m_y + rect.m_height);
-						vp.width    =  float(rect.m_width);
-						vp.height   = -float(rect.m_height);
-						vp.minDepth = 0.0f;
-						vp.maxDepth = 1.0f;
-						vkCmdSetViewport(m_commandBuffer, 0, 1, &vp);
-
-						VkRect2D rc;
-						rc.offset.x      = viewScissorRect.m_x;
-						rc.offset.y      = viewScissorRect.m_y;
-						rc.extent.width  = viewScissorRect.m_width;
-						rc.extent.height = viewScissorRect.m_height;
-						vkCmdSetScissor(m_commandBuffer, 0, 1, &rc);
+						viewport.x        =  float(rect.m_x);
+						viewport.y        =  float(rect.m_y + rect.m_height);
+						viewport.width    =  float(rect.m_width);
+						viewport.height   = -float(rect.m_height);
+						viewport.minDepth = 0.0f;
+						viewport.maxDepth = 1.0f;
+
+						viewScissor.offset.x      = viewScissorRect.m_x;
+						viewScissor.offset.y      = viewScissorRect.m_y;
+						viewScissor.extent.width  = viewScissorRect.m_width;
+						viewScissor.extent.height = viewScissorRect.m_height;
+
+						vkCmdSetViewport(m_commandBuffer, 0, 1, &viewport);
+						vkCmdSetScissor(m_commandBuffer, 0, 1, &viewScissor);
+						currentState.m_scissor = UINT16_MAX;
 
 						const Clear& clr = _render->m_view[view].m_clear;
-						if (BGFX_CLEAR_NONE != clr.m_flags)
+						if (BGFX_CLEAR_NONE != (clr.m_flags & BGFX_CLEAR_MASK)
+						&&  acquireFrameBuffer(fb) )
 						{
-							vkCmdBeginRenderPass(m_commandBuffer, &rpbi, VK_SUBPASS_CONTENTS_INLINE);
+							uint16_t clearFlags = BGFX_CLEAR_NONE;
 
-							Rect clearRect = rect;
-							clearRect.setIntersect(rect, viewScissorRect);
-							clearQuad(clearRect, clr, _render->m_colorPalette);
+							if (!beginRenderPass)
+							{
+								// Clear before blits and compute is recorded in its own render pass,
+								// otherwise render pass is started here and kept for the following
+								// views.
+								clearFlags = startRenderPass(
+									  fb
+									, passPlan->m_rect
+									, clr
+									, &plan == passPlan ? plan.m_clearFlags : BGFX_CLEAR_NONE
+									, plan.m_standaloneClear ? BGFX_CLEAR_NONE : passPlan->m_discardFlags
+									, _render->m_colorPalette
+									);
+								beginRenderPass = true;
+								currentState.m_scissor = UINT16_MAX;
 
-							vkCmdEndRenderPass(m_commandBuffer);
+								if (wasCompute)
+								{
+									wasCompute = false;
+									currentBindHash = 0;
+								}
+							}
+
+							if (BGFX_CLEAR_NONE == clearFlags)
+							{
+								Rect clearRect = rect;
+								clearRect.setIntersect(rect, viewScissorRect);
+								clearQuad(clearRect, clr, _render->m_colorPalette);
+							}
+
+							if (plan.m_standaloneClear)
+							{
+								vkCmdEndRenderPass(m_commandBuffer);
+								beginRenderPass = false;
+								computeWrite    = false;
+							}
 						}
 
 						submitBlit(bs, view);
@@ -8313,12 +10270,19 @@ VK_DESTROY
 					}
 
 					// renderpass external subpass dependencies handle graphics -> compute and compute -> graphics
-					// but not compute -> compute (possibly also across views if they contain no draw calls)
-					setMemoryBarrier(
-						  m_commandBuffer
-						, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT
-						, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT
-					);
+					// but not compute -> compute (possibly also across views if they contain no draw calls),
+					// barrier is needed only if there was dispatch since last render pass or barrier.
+					if (computeWrite)
+					{
+						setMemoryBarrier(
+							  m_commandBuffer
+							, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT
+							, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT
+							, VK_ACCESS_SHADER_WRITE_BIT
+							, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT
+							);
+						computeWrite = false;
+					}
 
 					const RenderCompute& compute = renderItem.compute;
 
@@ -8430,6 +10394,8 @@ VK_DESTROY
 						vkCmdDispatch(m_commandBuffer, compute.m_numX, compute.m_numY, compute.m_numZ);
 					}
 
+					computeWrite = true;
+
 					continue;
 				}
 
@@ -8454,6 +10420,13 @@ VK_DESTROY
 					}
 				}
 
+				if (!beginRenderPass
+				&&  !acquireFrameBuffer(isValid(m_fbh) ? m_frameBuffers[m_fbh.idx] : m_backBuffer) )
+				{
+					isFrameBufferValid = false;
+					continue;
+				}
+
 				const uint64_t changedFlags = currentState.m_stateFlags ^ draw.m_stateFlags;
 				currentState.m_stateFlags = draw.m_stateFlags;
 
@@ -8469,7 +10442,19 @@ VK_DESTROY
 					setViewType(view, " ");
 					BGFX_VK_PROFILER_BEGIN(view, kColorDraw);
 
-					vkCmdBeginRenderPass(m_commandBuffer, &rpbi, VK_SUBPASS_CONTENTS_INLINE);
+					const FrameBufferVK& fb = isValid(m_fbh)
+						? m_frameBuffers[m_fbh.idx]
+						: m_backBuffer
+						;
+
+					startRenderPass(
+						  fb
+						, passPlan->m_rect
+						, _render->m_view[view].m_clear
+						, BGFX_CLEAR_NONE
+						, passPlan->m_discardFlags
+						, _render->m_colorPalette
+						);
 					beginRenderPass = true;
 
 					currentProgram = BGFX_INVALID_HANDLE;
@@ -8606,12 +10591,7 @@ VK_DESTROY
 							||  viewHasScissor)
 							{
 								restoreScissor = false;
-								VkRect2D rc;
-								rc.offset.x      = viewScissorRect.m_x;
-								rc.offset.y      = viewScissorRect.m_y;
-								rc.extent.width  = viewScissorRect.m_width;
-								rc.extent.height = viewScissorRect.m_height;
-								vkCmdSetScissor(m_commandBuffer, 0, 1, &rc);
+								vkCmdSetScissor(m_commandBuffer, 0, 1, &viewScissor);
 							}
 						}
 						else
@@ -8977,6 +10957,20 @@ VK_DESTROY
 		bx::memCopy(perfStats.numPrims, statsNumPrimsRendered, sizeof(perfStats.numPrims) );
 		perfStats.gpuMemoryMax  = gpuMemoryAvailable;
 		perfStats.gpuMemoryUsed = gpuMemoryUsed;
+		perfStats.numPipelinesCreated   = m_numPipelinesCreated;
+		perfStats.numPipelinesPrecached = m_numPipelinesPrecached;
+		perfStats.numGpuMemoryBlocks      = m_memoryAllocator.getNumBlocks();
+		perfStats.numGpuMemoryAllocations = m_memoryAllocator.m_numAllocations;
+		perfStats.numGpuMemoryDedicated   = m_memoryAllocator.m_numDedicated;
+		perfStats.gpuMemoryAllocated      = m_memoryAllocator.m_allocated;
+		perfStats.gpuMemoryBound          = m_memoryAllocator.m_used;
+		perfStats.numBarriers      = s_numBarriers;
+		perfStats.numImageBarriers = s_numImageBarriers;
+
+		m_numPipelinesCreated   = 0;
+		m_numPipelinesPrecached = 0;
+		s_numBarriers      = 0;
+		s_numImageBarriers = 0;
 
 		if (_render->m_debug & (BGFX_DEBUG_IFH|BGFX_DEBUG_STATS) )
 		{
@@ -9033,6 +11027,22 @@ VK_DESTROY
 					}
 				}
 
+				{
+					char allocated[16];
+					bx::prettify(allocated, BX_COUNTOF(allocated), uint64_t(m_memoryAllocator.m_allocated) );
+
+					char bound[16];
+					bx::prettify(bound, BX_COUNTOF(bound), uint64_t(m_memoryAllocator.m_used) );
+
+					tvm.printf(0, pos++, 0x8f, " Memory blocks: %3d, Allocations: %6d, Dedicated: %4d, Allocated: %12s, Bound: %12s"
+						, m_memoryAllocator.getNumBlocks()
+						, m_memoryAllocator.m_numAllocations
+						, m_memoryAllocator.m_numDedicated
+						, allocated
+						, bound
+						);
+				}
+
 				pos = 10;
 				tvm.printf(10, pos++, 0x8b, "       Frame: % 7.3f, % 7.3f \x1f, % 7.3f \x1e [ms] / % 6.2f FPS "
 					, double(frameTime)*toMs
@@ -9081,17 +11091,19 @@ VK_DESTROY
 //				tvm.printf(10, pos++, 0x8b, " Uniform size: %7d, Max: %7d ", _render->m_uniformEnd, _render->m_uniformMax);
 				tvm.printf(10, pos++, 0x8b, "     DVB size: %7d ", _render->m_vboffset);
 				tvm.printf(10, pos++, 0x8b, "     DIB size: %7d ", _render->m_iboffset);
+				tvm.printf(10, pos++, 0x8b, "     Barriers: %7d (image %5d) ", perfStats.numBarriers, perfStats.numImageBarriers);
 
 				pos++;
 				tvm.printf(10, pos++, 0x8b, " Occlusion queries: %3d ", m_occlusionQuery.m_control.available() );
 
 				pos++;
 				tvm.printf(10, pos++, 0x8b, " State cache:             ");
-				tvm.printf(10, pos++, 0x8b, " PSO    | DSL    |  DS    ");
-				tvm.printf(10, pos++, 0x8b, " %6d | %6d | %6d "
+				tvm.printf(10, pos++, 0x8b, " PSO    | DSL    |  DS    | DSC    ");
+				tvm.printf(10, pos++, 0x8b, " %6d | %6d | %6d | %6d "
 					, m_pipelineStateCache.getCount()
 					, m_descriptorSetLayoutCache.getCount()
 					, descriptorSetCount
+					, m_descriptorSetCache.getCount()
 					);
 				pos++;
 
@@ -9127,6 +11139,9 @@ VK_DESTROY
 
 		scratchBuffer.flush();
 
+		// Windows that were not acquired this frame might still be presenting.
+		waitPresent();
+
 		for (uint16_t ii = 0; ii < m_numWindows; ++ii)
 		{
 			FrameBufferVK& fb = isValid(m_windows[ii])
@@ -9134,6 +11149,9 @@ VK_DESTROY
 				: m_backBuffer
 				;
 
+			// Window was bound this frame, but nothing was rendered into it.
+			acquireFrameBuffer(fb);
+
 			if (fb.m_needPresent)
 			{
 				fb.resolve();
@@ -9144,11 +11162,24 @@ VK_DESTROY
 				m_cmd.addSignalSemaphore(fb.m_swapChain.m_lastImageRenderedSemaphore);
 				fb.m_swapChain.m_lastImageAcquiredSemaphore = VK_NULL_HANDLE;
 
-				fb.m_swapChain.m_backBufferFence[fb.m_swapChain.m_backBufferColorIdx] = m_cmd.m_currentFence;
+				fb.m_swapChain.m_backBufferSubmitted[fb.m_swapChain.m_backBufferColorIdx] = m_cmd.m_submitted + 1;
 			}
 		}
 
 		kick();
+
+		SubmittedFrame& submittedFrame = m_submittedFrame[m_numSubmittedFrames % BX_COUNTOF(m_submittedFrame)];
+		submittedFrame.m_frameNum  = _render->m_frameNum;
+		submittedFrame.m_submitted = m_cmd.m_submitted;
+		++m_numSubmittedFrames;
+
+		// Write pipeline cache once pipeline creation settles down, instead of
+		// after every new pipeline.
+		if (m_pipelineCacheDirty
+		&&  ++m_pipelineCacheIdleFrames >= BGFX_CONFIG_PIPELINE_CACHE_SAVE_IDLE_FRAMES)
+		{
+			savePipelineCache();
+		}
 	}
 
 } /* namespace vk */ } // namespace bgfx
@@ -150,6 +150,7 @@
 			VK_IMPORT_DEVICE_FUNC(false, vkQueueWaitIdle);                  \
 			VK_IMPORT_DEVICE_FUNC(false, vkDeviceWaitIdle);                 \
 			VK_IMPORT_DEVICE_FUNC(false, vkWaitForFences);                  \
+			VK_IMPORT_DEVICE_FUNC(false, vkGetFenceStatus);                 \
 			VK_IMPORT_DEVICE_FUNC(false, vkBeginCommandBuffer);             \
 			VK_IMPORT_DEVICE_FUNC(false, vkEndCommandBuffer);               \
 			VK_IMPORT_DEVICE_FUNC(false, vkCmdPipelineBarrier);             \
@@ -203,6 +204,12 @@
 			/* VK_KHR_draw_indirect_count */                                \
 			VK_IMPORT_DEVICE_FUNC(true,  vkCmdDrawIndirectCountKHR);        \
 			VK_IMPORT_DEVICE_FUNC(true,  vkCmdDrawIndexedIndirectCountKHR); \
+			/* VK_KHR_timeline_semaphore */                                 \
+			VK_IMPORT_DEVICE_FUNC(true,  vkGetSemaphoreCounterValueKHR);    \
+			VK_IMPORT_DEVICE_FUNC(true,  vkWaitSemaphoresKHR);              \
+			/* VK_KHR_get_memory_requirements2 */                           \
+			VK_IMPORT_DEVICE_FUNC(true,  vkGetBufferMemoryRequirements2KHR); \
+			VK_IMPORT_DEVICE_FUNC(true,  vkGetImageMemoryRequirements2KHR); \
 
 #define VK_DESTROY                                \
 			VK_DESTROY_FUNC(Buffer);              \
@@ -356,6 +363,207 @@ VK_DESTROY_FUNC(DescriptorSet);
 		HashMap m_hashMap;
 	};
 
+	class DescriptorSetCacheVK
+	{
+	public:
+		DescriptorSetCacheVK()
+			: m_frame(0)
+		{
+		}
+
+		void add(uint64_t _key, VkDescriptorSet _descriptorSet, uint8_t _numResources, const uint32_t* _resources)
+		{
+			Entry entry;
+			entry.m_descriptorSet = _descriptorSet;
+			entry.m_lastFrame     = m_frame;
+			entry.m_numResources  = bx::min<uint8_t>(_numResources, BX_COUNTOF(entry.m_resources) );
+			bx::memCopy(entry.m_resources, _resources, entry.m_numResources*sizeof(uint32_t) );
+
+			invalidate(_key);
+			m_hashMap.insert(stl::make_pair(_key, entry) );
+		}
+
+		VkDescriptorSet find(uint64_t _key)
+		{
+			HashMap::iterator it = m_hashMap.find(_key);
+			if (it != m_hashMap.end() )
+			{
+				it->second.m_lastFrame = m_frame;
+				return it->second.m_descriptorSet;
+			}
+
+			return VK_NULL_HANDLE;
+		}
+
+		void invalidate(uint64_t _key)
+		{
+			HashMap::iterator it = m_hashMap.find(_key);
+			if (it != m_hashMap.end() )
+			{
+				release(it->second.m_descriptorSet);
+				m_hashMap.erase(it);
+			}
+		}
+
+		// Invalidates all descriptor sets referencing resource.
+		void invalidateWithResource(uint32_t _resource)
+		{
+			for (HashMap::iterator it = m_hashMap.begin(); it != m_hashMap.end();)
+			{
+				const Entry& entry = it->second;
+
+				bool found = false;
+				for (uint8_t ii = 0; ii < entry.m_numResources && !found; ++ii)
+				{
+					found = _resource == entry.m_resources[ii];
+				}
+
+				if (found)
+				{
+					release(it->second.m_descriptorSet);
+
+					HashMap::iterator next = it;
+					++next;
+					m_hashMap.erase(it);
+					it = next;
+				}
+				else
+				{
+					++it;
+				}
+			}
+		}
+
+		// Advances frame, and releases descriptor sets that were not used in
+		// last _maxAge frames, or all unused ones when there is more than
+		// _maxCount cached.
+		void gc(uint32_t _maxAge, uint32_t _maxCount)
+		{
+			const uint32_t maxAge = m_hashMap.size() > _maxCount ? 0 : _maxAge;
+
+			for (HashMap::iterator it = m_hashMap.begin(); it != m_hashMap.end();)
+			{
+				if (m_frame - it->second.m_lastFrame > maxAge)
+				{
+					release(it->second.m_descriptorSet);
+
+					HashMap::iterator next = it;
+					++next;
+					m_hashMap.erase(it);
+					it = next;
+				}
+				else
+				{
+					++it;
+				}
+			}
+
+			++m_frame;
+		}
+
+		void invalidate()
+		{
+			for (HashMap::iterator it = m_hashMap.begin(), itEnd = m_hashMap.end(); it != itEnd; ++it)
+			{
+				release(it->second.m_descriptorSet);
+			}
+
+			m_hashMap.clear();
+		}
+
+		uint32_t getCount() const
+		{
+			return uint32_t(m_hashMap.size() );
+		}
+
+	private:
+		struct Entry
+		{
+			VkDescriptorSet m_descriptorSet;
+			uint32_t m_lastFrame;
+			uint8_t  m_numResources;
+			uint32_t m_resources[BGFX_CONFIG_MAX_TEXTURE_SAMPLERS];
+		};
+
+		typedef stl::unordered_map<uint64_t, Entry> HashMap;
+		HashMap  m_hashMap;
+		uint32_t m_frame;
+	};
+
+	struct DeviceMemoryAllocationVK
+	{
+		DeviceMemoryAllocationVK()
+			: m_memory(VK_NULL_HANDLE)
+			, m_offset(0)
+			, m_size(0)
+			, m_block(UINT32_MAX)
+		{
+		}
+
+		VkDeviceMemory m_memory;
+		VkDeviceSize   m_offset;
+		VkDeviceSize   m_size;
+		uint32_t       m_block; // UINT32_MAX when memory is dedicated allocation.
+	};
+
+	// Device local memory is allocated in large blocks per memory type, and resources
+	// are sub-allocated from free ranges within blocks. Buffers and images never share
+	// block, so bufferImageGranularity doesn't need to be considered between neighbors.
+	class MemoryAllocatorVK
+	{
+	public:
+		MemoryAllocatorVK()
+			: m_blockSize(0)
+			, m_dedicatedSize(0)
+			, m_numAllocations(0)
+			, m_numDedicated(0)
+			, m_allocated(0)
+			, m_used(0)
+		{
+		}
+
+		void init(VkDeviceSize _blockSize, VkDeviceSize _dedicatedSize);
+		void shutdown();
+
+		VkResult alloc(const VkMemoryRequirements& _requirements, uint32_t _memoryTypeIndex, bool _image, const VkMemoryDedicatedAllocateInfoKHR* _dedicated, DeviceMemoryAllocationVK& _allocation);
+		void free(const DeviceMemoryAllocationVK& _allocation);
+
+		uint32_t getNumBlocks() const;
+
+		struct Range
+		{
+			VkDeviceSize m_offset;
+			VkDeviceSize m_size;
+		};
+
+		typedef stl::vector<Range> RangeArray;
+
+		struct Block
+		{
+			VkDeviceMemory m_memory;
+			VkDeviceSize   m_size;
+			uint32_t       m_memoryTypeIndex;
+			uint32_t       m_numAllocations;
+			bool           m_image;
+			RangeArray     m_free; // Sorted by offset.
+		};
+
+		typedef stl::vector<Block> BlockArray;
+
+	private:
+		bool allocFromBlock(Block& _block, VkDeviceSize _size, VkDeviceSize _alignment, VkDeviceSize& _offset);
+
+		BlockArray   m_block;
+		VkDeviceSize m_blockSize;
+		VkDeviceSize m_dedicatedSize;
+
+	public:
+		uint32_t m_numAllocations;
+		uint32_t m_numDedicated;
+		int64_t  m_allocated;
+		int64_t  m_used;
+	};
+
 	class ScratchBufferVK
 	{
 	public:
@@ -380,11 +588,46 @@ VK_DESTROY_FUNC(DescriptorSet);
 		uint32_t m_pos;
 	};
 
+	struct StagingAllocationVK
+	{
+		VkBuffer m_buffer;
+		VkDeviceMemory m_memory; // Only set for temporary staging buffer.
+		uint32_t m_offset;
+		uint8_t* m_data;
+	};
+
+	// Persistently mapped upload buffer, split into one region per frame in flight.
+	// Region is reused once command buffer consuming it has completed.
+	class StagingRingVK
+	{
+	public:
+		StagingRingVK()
+			: m_buffer(VK_NULL_HANDLE)
+			, m_deviceMem(VK_NULL_HANDLE)
+			, m_data(NULL)
+			, m_regionSize(0)
+			, m_begin(0)
+			, m_pos(0)
+		{
+		}
+
+		VkResult create(uint32_t _size, uint32_t _numFramesInFlight);
+		void destroy();
+		void reset(uint32_t _frameInFlight);
+		bool alloc(uint32_t _size, uint32_t _align, StagingAllocationVK& _staging);
+
+		VkBuffer m_buffer;
+		VkDeviceMemory m_deviceMem;
+		uint8_t* m_data;
+		uint32_t m_regionSize;
+		uint32_t m_begin;
+		uint32_t m_pos;
+	};
+
 	struct BufferVK
 	{
 		BufferVK()
 			: m_buffer(VK_NULL_HANDLE)
-			, m_deviceMem(VK_NULL_HANDLE)
 			, m_size(0)
 			, m_flags(BGFX_BUFFER_NONE)
 			, m_dynamic(false)
@@ -396,7 +639,7 @@ VK_DESTROY_FUNC(DescriptorSet);
 		void destroy();
 
 		VkBuffer m_buffer;
-		VkDeviceMemory m_deviceMem;
+		DeviceMemoryAllocationVK m_deviceMem;
 		uint32_t m_size;
 		uint16_t m_flags;
 		bool m_dynamic;
@@ -454,6 +697,7 @@ VK_DESTROY_FUNC(DescriptorSet);
 			, m_numPredefined(0)
 			, m_uniformBinding(0)
 			, m_numBindings(0)
+			, m_numSpecializationConstants(0)
 			, m_oldBindingModel(false)
 		{
 		}
@@ -484,6 +728,9 @@ VK_DESTROY_FUNC(DescriptorSet);
 		uint16_t m_numBindings;
 		VkDescriptorSetLayoutBinding m_bindings[2 * BGFX_CONFIG_MAX_TEXTURE_SAMPLERS + 1];
 
+		uint32_t m_specializationConstantId[BGFX_CONFIG_MAX_SPECIALIZATION_CONSTANTS];
+		uint8_t m_numSpecializationConstants;
+
 		bool m_oldBindingModel;
 	};
 
@@ -492,12 +739,22 @@ VK_DESTROY_FUNC(DescriptorSet);
 		ProgramVK()
 			: m_vsh(NULL)
 			, m_fsh(NULL)
+			, m_specializationHash(0)
 			, m_descriptorSetLayout(VK_NULL_HANDLE)
 			, m_pipelineLayout(VK_NULL_HANDLE)
 		{
+			m_specializationInfo.mapEntryCount = 0;
 		}
 
-		void create(const ShaderVK* _vsh, const ShaderVK* _fsh);
+		void create(const ShaderVK* _vsh, const ShaderVK* _fsh, uint8_t _numConstants, const SpecializationConstant* _constants);
+
+		const VkSpecializationInfo* getSpecializationInfo() const
+		{
+			return 0 == m_specializationInfo.mapEntryCount
+				? NULL
+				: &m_specializationInfo
+				;
+		}
 		void destroy();
 
 		const ShaderVK* m_vsh;
@@ -511,6 +768,11 @@ VK_DESTROY_FUNC(DescriptorSet);
 		PredefinedUniform m_predefined[PredefinedUniform::Count * 2];
 		uint8_t m_numPredefined;
 
+		VkSpecializationMapEntry m_specializationEntry[BGFX_CONFIG_MAX_SPECIALIZATION_CONSTANTS];
+		uint32_t m_specializationData[BGFX_CONFIG_MAX_SPECIALIZATION_CONSTANTS];
+		VkSpecializationInfo m_specializationInfo;
+		uint32_t m_specializationHash;
+
 		VkDescriptorSetLayout m_descriptorSetLayout;
 		VkPipelineLayout m_pipelineLayout;
 	};
@@ -602,18 +864,50 @@ VK_DESTROY_FUNC(DescriptorSet);
 		TextureFormat::Enum  m_format;
 	};
 
+	// Image layout transitions and memory dependencies are gathered and recorded with
+	// single pipeline barrier on flush. Repeated transitions of same image are merged.
+	struct BarrierBatchVK
+	{
+		BarrierBatchVK()
+			: m_srcStageMask(0)
+			, m_dstStageMask(0)
+			, m_srcAccessMask(0)
+			, m_dstAccessMask(0)
+		{
+		}
+
+		void imageBarrier(VkImage _image, VkImageAspectFlags _aspectMask, VkImageLayout _oldLayout, VkImageLayout _newLayout);
+		void memoryBarrier(VkPipelineStageFlags _srcStages, VkAccessFlags _srcAccess, VkPipelineStageFlags _dstStages, VkAccessFlags _dstAccess);
+		void flush(VkCommandBuffer _commandBuffer);
+
+		bool isEmpty() const
+		{
+			return 0 == m_srcStageMask
+				&& 0 == m_dstStageMask
+				;
+		}
+
+		typedef stl::vector<VkImageMemoryBarrier> BarrierArray;
+		BarrierArray m_barriers;
+
+		VkPipelineStageFlags m_srcStageMask;
+		VkPipelineStageFlags m_dstStageMask;
+		VkAccessFlags m_srcAccessMask;
+		VkAccessFlags m_dstAccessMask;
+	};
+
 	struct TextureVK
 	{
 		TextureVK()
 			: m_directAccessPtr(NULL)
+			, m_residentMip(0)
 			, m_sampler({ 1, VK_SAMPLE_COUNT_1_BIT })
 			, m_format(VK_FORMAT_UNDEFINED)
 			, m_textureImage(VK_NULL_HANDLE)
-			, m_textureDeviceMem(VK_NULL_HANDLE)
 			, m_currentImageLayout(VK_IMAGE_LAYOUT_UNDEFINED)
 			, m_singleMsaaImage(VK_NULL_HANDLE)
-			, m_singleMsaaDeviceMem(VK_NULL_HANDLE)
 			, m_currentSingleMsaaImageLayout(VK_IMAGE_LAYOUT_UNDEFINED)
+			, m_uploadPending(false)
 		{
 		}
 
@@ -627,7 +921,9 @@ VK_DESTROY_FUNC(DescriptorSet);
 		void resolve(VkCommandBuffer _commandBuffer, uint8_t _resolve, uint32_t _layer, uint32_t _numLayers, uint32_t _mip);
 
 		void copyBufferToTexture(VkCommandBuffer _commandBuffer, VkBuffer _stagingBuffer, uint32_t _bufferImageCopyCount, VkBufferImageCopy* _bufferImageCopy);
+		uint32_t getStagingAlign() const;
 		VkImageLayout setImageMemoryBarrier(VkCommandBuffer _commandBuffer, VkImageLayout _newImageLayout, bool _singleMsaaImage = false);
+		VkImageLayout setImageMemoryBarrier(BarrierBatchVK& _batch, VkImageLayout _newImageLayout, bool _singleMsaaImage = false);
 
 		VkResult createView(uint32_t _layer, uint32_t _numLayers, uint32_t _mip, uint32_t _numMips, VkImageViewType _type, VkImageAspectFlags _aspectMask, bool _renderTarget, ::VkImageView* _view) const;
 
@@ -641,6 +937,7 @@ VK_DESTROY_FUNC(DescriptorSet);
 		uint8_t  m_requestedFormat;
 		uint8_t  m_textureFormat;
 		uint8_t  m_numMips;
+		uint8_t  m_residentMip;
 
 		MsaaSamplerVK m_sampler;
 
@@ -650,22 +947,70 @@ VK_DESTROY_FUNC(DescriptorSet);
 		VkImageAspectFlags m_aspectMask;
 
 		VkImage        m_textureImage;
-		VkDeviceMemory m_textureDeviceMem;
+		DeviceMemoryAllocationVK m_textureDeviceMem;
 		VkImageLayout  m_currentImageLayout;
 
 		VkImage        m_singleMsaaImage;
-		VkDeviceMemory m_singleMsaaDeviceMem;
+		DeviceMemoryAllocationVK m_singleMsaaDeviceMem;
 		VkImageLayout  m_currentSingleMsaaImageLayout;
 
 		VkImageLayout m_sampledLayout;
 
 		ReadbackVK m_readback;
 
+		bool m_uploadPending;
+
 	private:
 		VkResult createImages(VkCommandBuffer _commandBuffer);
 		static VkImageAspectFlags getAspectMask(VkFormat _format);
 	};
 
+	// Buffer and texture uploads recorded between flushes are batched together, so
+	// layout transitions of all destination images are done with single barrier
+	// before and single barrier after copies.
+	struct UploadBatchVK
+	{
+		struct BufferUpload
+		{
+			VkBuffer     m_src;
+			VkBuffer     m_dst;
+			VkBufferCopy m_region;
+		};
+
+		struct ImageUpload
+		{
+			TextureVK*    m_texture;
+			VkBuffer      m_src;
+			VkImageLayout m_layout;
+			uint32_t      m_firstRegion;
+			uint32_t      m_numRegions;
+		};
+
+		void uploadBuffer(VkCommandBuffer _commandBuffer, VkBuffer _src, VkBuffer _dst, const VkBufferCopy& _region);
+		void uploadImage(VkCommandBuffer _commandBuffer, TextureVK& _texture, VkBuffer _src, uint32_t _numRegions, const VkBufferImageCopy* _regions);
+		void flush(VkCommandBuffer _commandBuffer);
+		void discard();
+
+		bool isEmpty() const
+		{
+			return m_bufferUploads.empty()
+				&& m_imageUploads.empty()
+				;
+		}
+
+		typedef stl::vector<BufferUpload> BufferUploadArray;
+		BufferUploadArray m_bufferUploads;
+
+		typedef stl::vector<ImageUpload> ImageUploadArray;
+		ImageUploadArray m_imageUploads;
+
+		typedef stl::vector<VkBufferImageCopy> RegionArray;
+		RegionArray m_regions;
+
+		typedef stl::vector<VkImageMemoryBarrier> BarrierArray;
+		BarrierArray m_barriers;
+	};
+
 	constexpr uint32_t kMaxBackBuffers = bx::max(BGFX_CONFIG_MAX_BACK_BUFFERS, 10);
 
 	struct SwapChainVK
@@ -719,7 +1064,7 @@ VK_DESTROY_FUNC(DescriptorSet);
 		VkImage        m_backBufferColorImage[kMaxBackBuffers];
 		VkImageView    m_backBufferColorImageView[kMaxBackBuffers];
 		VkFramebuffer  m_backBufferFrameBuffer[kMaxBackBuffers];
-		VkFence        m_backBufferFence[kMaxBackBuffers];
+		uint64_t       m_backBufferSubmitted[kMaxBackBuffers];
 		uint32_t       m_backBufferColorIdx;
 
 		VkSemaphore m_presentDoneSemaphore[kMaxBackBuffers];
@@ -755,6 +1100,7 @@ VK_DESTROY_FUNC(DescriptorSet);
 			, m_numTh(0)
 			, m_nwh(NULL)
 			, m_needPresent(false)
+			, m_needAcquire(false)
 			, m_framebuffer(VK_NULL_HANDLE)
 		{
 		}
@@ -775,6 +1121,8 @@ VK_DESTROY_FUNC(DescriptorSet);
 
 		bool isRenderable() const;
 
+		VkResult getRenderPass(uint16_t _clearFlags, uint16_t _discardFlags, VkRenderPass* _renderPass) const;
+
 		TextureHandle m_texture[BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS];
 		TextureHandle m_depth;
 		uint32_t m_width;
@@ -787,6 +1135,7 @@ VK_DESTROY_FUNC(DescriptorSet);
 		SwapChainVK m_swapChain;
 		void* m_nwh;
 		bool m_needPresent;
+		bool m_needAcquire;
 		bool m_needResolve;
 
 		VkImageView m_textureImageViews[BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS];
@@ -799,7 +1148,7 @@ VK_DESTROY_FUNC(DescriptorSet);
 
 	struct CommandQueueVK
 	{
-		VkResult init(uint32_t _queueFamily, VkQueue _queue, uint32_t _numFramesInFlight);
+		VkResult init(uint32_t _queueFamily, VkQueue _queue, uint32_t _numFramesInFlight, bool _timelineSemaphore);
 		VkResult reset();
 		void shutdown();
 
@@ -809,7 +1158,13 @@ VK_DESTROY_FUNC(DescriptorSet);
 		void kick(bool _wait = false);
 		void finish(bool _finishAll = false);
 
+		// Submissions are numbered from 1, m_submitted is the last one. With
+		// timeline semaphore, submission number is the value it signals.
+		uint64_t getCompleted();
+		VkResult wait(uint64_t _submitted);
+
 		void release(uint64_t _handle, VkObjectType _type);
+		void release(const DeviceMemoryAllocationVK& _allocation);
 		void consume();
 
 		uint32_t m_queueFamily;
@@ -822,25 +1177,32 @@ VK_DESTROY_FUNC(DescriptorSet);
 
 		VkCommandBuffer m_activeCommandBuffer;
 
-		VkFence m_currentFence;
-		VkFence m_completedFence;
+		bool m_timelineSemaphoreSupport;
+		VkSemaphore m_timelineSemaphore;
 
 		uint64_t m_submitted;
+		uint64_t m_completed;
 
 		struct CommandList
 		{
 			VkCommandPool m_commandPool = VK_NULL_HANDLE;
 			VkCommandBuffer m_commandBuffer = VK_NULL_HANDLE;
 			VkFence m_fence = VK_NULL_HANDLE;
+			uint64_t m_submitted = 0;
 		};
 
 		CommandList m_commandList[BGFX_CONFIG_MAX_FRAME_LATENCY];
 
+		// Queue access must be externally synchronized, presents can be
+		// issued from present thread while render thread submits.
+		bx::Mutex m_queueMutex;
+
 		uint32_t             m_numWaitSemaphores;
 		VkSemaphore          m_waitSemaphores[BGFX_CONFIG_MAX_FRAME_BUFFERS];
 		VkPipelineStageFlags m_waitSemaphoreStages[BGFX_CONFIG_MAX_FRAME_BUFFERS];
 		uint32_t             m_numSignalSemaphores;
-		VkSemaphore          m_signalSemaphores[BGFX_CONFIG_MAX_FRAME_BUFFERS];
+		VkSemaphore          m_signalSemaphores[BGFX_CONFIG_MAX_FRAME_BUFFERS + 1];
+		uint64_t             m_signalSemaphoreValues[BGFX_CONFIG_MAX_FRAME_BUFFERS + 1];
 
 		struct Resource
 		{
@@ -851,6 +1213,9 @@ VK_DESTROY_FUNC(DescriptorSet);
 		typedef stl::vector<Resource> ResourceArray;
 		ResourceArray m_release[BGFX_CONFIG_MAX_FRAME_LATENCY];
 
+		typedef stl::vector<DeviceMemoryAllocationVK> AllocationArray;
+		AllocationArray m_releaseMemory[BGFX_CONFIG_MAX_FRAME_LATENCY];
+
 	private:
 		template<typename Ty>
 		void destroy(uint64_t _handle)
@@ -861,6 +1226,99 @@ VK_DESTROY_FUNC(DescriptorSet);
 		}
 	};
 
+	struct PipelinePrecacheVK
+	{
+		static constexpr uint32_t kMaxThreads = 8;
+
+		struct Job
+		{
+			uint64_t      m_state;
+			uint32_t      m_hash;
+			ProgramHandle m_program;
+			uint8_t       m_numStreams;
+			VertexLayout  m_layout;
+			VkRenderPass  m_renderPass;
+			VkSampleCountFlagBits m_samples;
+			uint32_t      m_numAttachments;
+			VkPipeline    m_pipeline;
+		};
+
+		PipelinePrecacheVK()
+			: m_numThreads(0)
+			, m_numActive(0)
+			, m_exit(false)
+		{
+		}
+
+		void init(uint32_t _numThreads);
+		void shutdown();
+
+		void push(const Job& _job);
+		bool pop(Job& _job);
+		void wait();
+
+		int32_t run();
+
+		typedef stl::vector<Job> JobArray;
+		JobArray m_pending;
+		JobArray m_done;
+
+		bx::Mutex     m_mutex;
+		bx::Semaphore m_sem;
+		bx::Thread    m_thread[kMaxThreads];
+		uint32_t      m_numThreads;
+		uint32_t      m_numActive;
+		bool          m_exit;
+	};
+
+	// Presenting is handed over to present thread, so that vkQueuePresentKHR of
+	// previous frame, which can block on vsync, overlaps with translation of the
+	// next frame on render thread. Render thread waits for pending present only
+	// before it touches swap chain state again.
+	struct PresentThreadVK
+	{
+		PresentThreadVK()
+			: m_numFrameBuffers(0)
+			, m_elapsed(0)
+			, m_pending(false)
+			, m_exit(false)
+			, m_enabled(false)
+		{
+		}
+
+		void init(bool _enabled);
+		void shutdown();
+
+		void push(FrameBufferVK* _frameBuffer);
+		void kick();
+		int64_t wait();
+
+		int32_t run();
+
+		FrameBufferVK* m_frameBuffer[BGFX_CONFIG_MAX_FRAME_BUFFERS];
+		uint32_t       m_numFrameBuffers;
+		int64_t        m_elapsed;
+
+		bx::Semaphore m_sem;
+		bx::Semaphore m_done;
+		bx::Thread    m_thread;
+		bool          m_pending;
+		bool          m_exit;
+		bool          m_enabled;
+	};
+
+	// Consecutive views rendering into the same frame buffer share one render pass
+	// instance. Plan is built per frame before submit, clears of the first view are
+	// folded into attachment load ops, and discards of the last view into store ops.
+	struct RenderPassPlanVK
+	{
+		Rect     m_rect;
+		uint16_t m_clearFlags;
+		uint16_t m_discardFlags;
+		bool     m_merge;
+		bool     m_standaloneClear;
+	};
+
 } /* namespace bgfx */ } // namespace vk
 
 #endif // BGFX_RENDERER_VK_H_HEADER_GUARD
@@ -832,7 +832,7 @@ namespace bgfx { namespace webgpu
 			m_shaders[_handle.idx].destroy();
 		}
 
-		void createProgram(ProgramHandle _handle, ShaderHandle _vsh, ShaderHandle _fsh) override
+		void createProgram(ProgramHandle _handle, ShaderHandle _vsh, ShaderHandle _fsh, uint8_t /*_numConstants*/, const SpecializationConstant* /*_constants*/) override
 		{
 			m_program[_handle.idx].create(&m_shaders[_vsh.idx], isValid(_fsh) ? &m_shaders[_fsh.idx] : NULL);
 		}
@@ -842,6 +842,10 @@ namespace bgfx { namespace webgpu
 			m_program[_handle.idx].destroy();
 		}
 
+		void precachePipelines(ProgramHandle /*_handle*/, uint16_t /*_numStates*/, const uint64_t* /*_states*/, uint16_t /*_numLayouts*/, const VertexLayout* /*_layouts*/, uint16_t /*_numFrameBuffers*/, const FrameBufferHandle* /*_frameBuffers*/) override
+		{
+		}
+
 		void* createTexture(TextureHandle _handle, const Memory* _mem, uint64_t _flags, uint8_t _skip) override
 		{
 			m_textures[_handle.idx].create(_handle, _mem, _flags, _skip);
@@ -956,6 +960,11 @@ namespace bgfx { namespace webgpu
 			release(mem);
 		}
 
+		void setTextureResidentMips(TextureHandle _handle, uint8_t _minMip) override
+		{
+			m_textures[_handle.idx].m_residentMip = _minMip;
+		}
+
 		void overrideInternal(TextureHandle _handle, uintptr_t _ptr) override
 		{
 			BX_UNUSED(_handle, _ptr);
@@ -1233,6 +1242,11 @@ namespace bgfx { namespace webgpu
 			return false;
 		}
 
+		bool getGpuCompletedFrame(uint32_t& /*_outFrameNum*/) override
+		{
+			return false;
+		}
+
 		void flip() override
 		{
 			for (uint32_t ii = 0, num = m_numWindows; ii < num; ++ii)
@@ -1413,7 +1427,8 @@ namespace bgfx { namespace webgpu
 							uint32_t flags = bind.m_samplerFlags;
 
 							wgpu::TextureViewDescriptor viewDesc = defaultDescriptor<wgpu::TextureViewDescriptor>();
-							viewDesc.dimension = program.m_textures[bindInfo.m_index].texture.viewDimension;
+							viewDesc.dimension    = program.m_textures[bindInfo.m_index].texture.viewDimension;
+							viewDesc.baseMipLevel = texture.m_residentMip;
 
 							wgpu::BindGroupEntry& textureEntry = b.m_entries[b.numEntries++];
 							textureEntry.binding = bindInfo.m_binding;
@@ -3072,6 +3087,7 @@ namespace bgfx { namespace webgpu
 			m_numSides  = ti.numLayers * (imageContainer.m_cubeMap ? 6 : 1);
 			m_requestedFormat  = TextureFormat::Enum(imageContainer.m_format);
 			m_textureFormat    = getViableTextureFormat(imageContainer);
+			m_residentMip      = 0;
 
 			if (m_requestedFormat == bgfx::TextureFormat::D16)
 				m_textureFormat = bgfx::TextureFormat::D32F;
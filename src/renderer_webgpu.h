@@ -399,6 +399,7 @@ namespace bgfx { namespace webgpu
 		TextureFormat::Enum m_requestedFormat;
 		TextureFormat::Enum m_textureFormat;
 		uint8_t m_numMips = 0;
+		uint8_t m_residentMip = 0;
 		uint8_t m_numLayers;
 		uint32_t m_numSides;
 		uint8_t m_sampleCount;
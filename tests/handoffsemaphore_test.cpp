@@ -0,0 +1,97 @@
+/*
+ * Copyright 2011-2023 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include "handoffsemaphore.h"
+
+#include <bx/debug.h>
+
+namespace bgfx
+{
+	struct HandoffSemaphoreTest
+	{
+		// Waiter times out with nothing posted.
+		static bool timeout()
+		{
+			HandoffSemaphore sem;
+
+			if (sem.wait(0, 0) )
+			{
+				return false;
+			}
+
+			if (0 != sem.m_count)
+			{
+				return false;
+			}
+
+			sem.post();
+
+			return sem.wait(0, 0)
+				&& 0 == sem.m_count
+				;
+		}
+
+		// Post arrives after OS semaphore wait timed out, but before waiter gave
+		// its count back. Waiter must consume that post, and must not leave
+		// phantom count behind.
+		static bool timeoutRacesWithPost()
+		{
+			HandoffSemaphore sem;
+
+			// Waiter found nothing and is about to block.
+			bx::atomicFetchAndSub<int32_t>(&sem.m_count, 1);
+
+			// OS semaphore wait times out.
+			if (sem.m_sem.wait(0) )
+			{
+				return false;
+			}
+
+			// Post moves count from -1 to 0 and posts OS semaphore.
+			sem.post();
+
+			// Waiter handles time out.
+			if (!sem.timedOut() )
+			{
+				return false;
+			}
+
+			if (0 != sem.m_count)
+			{
+				return false;
+			}
+
+			// Next wait must not return without new post.
+			return !sem.wait(0, 0);
+		}
+	};
+
+} // namespace bgfx
+
+int main(int /*_argc*/, const char* /*_argv*/[])
+{
+	struct Test
+	{
+		const char* name;
+		bool (*func)();
+	};
+
+	static const Test s_tests[] =
+	{
+		{ "HandoffSemaphore timeout",                 bgfx::HandoffSemaphoreTest::timeout              },
+		{ "HandoffSemaphore timeout races with post", bgfx::HandoffSemaphoreTest::timeoutRacesWithPost },
+	};
+
+	int32_t numFailed = 0;
+
+	for (uint32_t ii = 0; ii < BX_COUNTOF(s_tests); ++ii)
+	{
+		const bool ok = s_tests[ii].func();
+		bx::debugPrintf("%s: %s\n", ok ? "PASS" : "FAIL", s_tests[ii].name);
+		numFailed += !ok;
+	}
+
+	return 0 == numFailed ? 0 : 1;
+}
@@ -867,6 +867,33 @@ namespace bgfx { namespace spirv
 					}
 
 					bx::write(_writer, size, &err);
+
+					// Specialization constants, declared in shader with
+					// `layout(constant_id = N) const`, are appended after
+					// uniform block size. Renderers not reading them stop
+					// parsing shader binary before this table.
+					spirv_cross::SmallVector<spirv_cross::SpecializationConstant> constants = refl.get_specialization_constants();
+
+					const uint8_t numConstants = uint8_t(bx::min<size_t>(constants.size(), UINT8_MAX) );
+					bx::write(_writer, numConstants, &err);
+
+					for (uint8_t ii = 0; ii < numConstants; ++ii)
+					{
+						const spirv_cross::SpecializationConstant& constant = constants[ii];
+
+						const std::string name = refl.get_name(constant.id);
+						const uint8_t nameSize = uint8_t(bx::min<size_t>(name.size(), UINT8_MAX) );
+						bx::write(_writer, nameSize, &err);
+						bx::write(_writer, name.c_str(), nameSize, &err);
+
+						const uint32_t id = constant.constant_id;
+						bx::write(_writer, id, &err);
+
+						const uint32_t value = refl.get_constant(constant.id).scalar();
+						bx::write(_writer, value, &err);
+
+						BX_TRACE("specialization constant: %s, id %d, default 0x%08x", name.c_str(), id, value);
+					}
 				}
 			}
 		}